@@ -6,12 +6,71 @@
 #include "IfcGeometryLoader.h"
 #include "operations/curve-utils.h"
 #include "operations/geometryutils.h"
+#include "../schema/type_dispatch.h"
 #ifdef DEBUG_DUMP_SVG
 #include "../test/io_helpers.h"
 #endif
 
 namespace webifc::geometry
 {
+  namespace
+  {
+    // the types ComputeCurve handles, in the order of its switch
+    constexpr std::array<uint32_t, 13> CURVE_TYPES = {
+      schema::IFCPOLYLINE,
+      schema::IFCCOMPOSITECURVE,
+      schema::IFCCOMPOSITECURVESEGMENT,
+      schema::IFCLINE,
+      schema::IFCTRIMMEDCURVE,
+      schema::IFCINDEXEDPOLYCURVE,
+      schema::IFCELLIPSE,
+      schema::IFCCIRCLE,
+      schema::IFCGRADIENTCURVE,
+      schema::IFCCURVESEGMENT,
+      schema::IFCBSPLINECURVE,
+      schema::IFCBSPLINECURVEWITHKNOTS,
+      schema::IFCRATIONALBSPLINECURVEWITHKNOTS
+    };
+    const schema::TypeDispatch CURVE_DISPATCH(CURVE_TYPES);
+
+    // the types GetProfileByLine handles, in the order of its switch
+    constexpr std::array<uint32_t, 19> PROFILE_TYPES = {
+      schema::IFCARBITRARYOPENPROFILEDEF,
+      schema::IFCARBITRARYCLOSEDPROFILEDEF,
+      schema::IFCARBITRARYPROFILEDEFWITHVOIDS,
+      schema::IFCRECTANGLEPROFILEDEF,
+      schema::IFCROUNDEDRECTANGLEPROFILEDEF,
+      schema::IFCRECTANGLEHOLLOWPROFILEDEF,
+      schema::IFCCIRCLEPROFILEDEF,
+      schema::IFCELLIPSEPROFILEDEF,
+      schema::IFCCIRCLEHOLLOWPROFILEDEF,
+      schema::IFCISHAPEPROFILEDEF,
+      schema::IFCLSHAPEPROFILEDEF,
+      schema::IFCTSHAPEPROFILEDEF,
+      schema::IFCUSHAPEPROFILEDEF,
+      schema::IFCCSHAPEPROFILEDEF,
+      schema::IFCZSHAPEPROFILEDEF,
+      schema::IFCDERIVEDPROFILEDEF,
+      schema::IFCCOMPOSITEPROFILEDEF,
+      schema::IFCOPENCROSSPROFILEDEF,
+      schema::IFCTRAPEZIUMPROFILEDEF
+    };
+    const schema::TypeDispatch PROFILE_DISPATCH(PROFILE_TYPES);
+
+    // the types GetLocalPlacement handles, in the order of its switch
+    constexpr std::array<uint32_t, 9> PLACEMENT_TYPES = {
+      schema::IFCPOINTBYDISTANCEEXPRESSION,
+      schema::IFCAXIS1PLACEMENT,
+      schema::IFCAXIS2PLACEMENT3D,
+      schema::IFCAXIS2PLACEMENT2D,
+      schema::IFCLOCALPLACEMENT,
+      schema::IFCCARTESIANTRANSFORMATIONOPERATOR3D,
+      schema::IFCCARTESIANTRANSFORMATIONOPERATOR3DNONUNIFORM,
+      schema::IFCAXIS2PLACEMENTLINEAR,
+      schema::IFCLINEARPLACEMENT
+    };
+    const schema::TypeDispatch PLACEMENT_DISPATCH(PLACEMENT_TYPES);
+  }
 
   IfcGeometryLoader::IfcGeometryLoader(const webifc::parsing::IfcLoader &loader, const webifc::schema::IfcSchemaManager &schemaManager, uint16_t circleSegments)
       : _loader(loader), _schemaManager(schemaManager), _relVoidRel(PopulateRelVoidsRelMap()), _relVoids(PopulateRelVoidsMap()), _relAggregates(PopulateRelAggregatesMap()),
@@ -1409,9 +1468,9 @@ namespace webifc::geometry
   {
     spdlog::debug("[ComputeCurve({})]",expressID);
     auto lineType = _loader.GetLineType(expressID);
-    switch (lineType)
+    switch (CURVE_DISPATCH[_loader.GetLineTypeOrdinal(expressID)])
     {
-    case schema::IFCPOLYLINE:
+    case schema::TypeCase(CURVE_TYPES, schema::IFCPOLYLINE):
       {
         _loader.MoveToArgumentOffset(expressID, 0);
         auto points = _loader.GetSetArgument();
@@ -1434,7 +1493,7 @@ namespace webifc::geometry
 
         break;
       }
-    case schema::IFCCOMPOSITECURVE:
+    case schema::TypeCase(CURVE_TYPES, schema::IFCCOMPOSITECURVE):
       {
         _loader.MoveToArgumentOffset(expressID, 0);
         auto segments = _loader.GetSetArgument();
@@ -1459,7 +1518,7 @@ namespace webifc::geometry
 
         break;
       }
-    case schema::IFCCOMPOSITECURVESEGMENT:
+    case schema::TypeCase(CURVE_TYPES, schema::IFCCOMPOSITECURVESEGMENT):
       {
         _loader.MoveToArgumentOffset(expressID, 0);
         auto transition = _loader.GetStringArgument();
@@ -1474,7 +1533,7 @@ namespace webifc::geometry
       }
 
       // TODO: review and simplify
-    case schema::IFCLINE:
+    case schema::TypeCase(CURVE_TYPES, schema::IFCLINE):
       {
         bool condition = sameSense == 1 || sameSense == -1;
         if (edge)
@@ -1572,7 +1631,7 @@ namespace webifc::geometry
         }
       break;
       }
-    case schema::IFCTRIMMEDCURVE:
+    case schema::TypeCase(CURVE_TYPES, schema::IFCTRIMMEDCURVE):
       {
         _loader.MoveToArgumentOffset(expressID, 0);
         auto basisCurveID = _loader.GetRefArgument();
@@ -1602,7 +1661,7 @@ namespace webifc::geometry
 
         break;
       }
-    case schema::IFCINDEXEDPOLYCURVE:
+    case schema::TypeCase(CURVE_TYPES, schema::IFCINDEXEDPOLYCURVE):
       {
         _loader.MoveToArgumentOffset(expressID, 0);
         auto ptsRef = _loader.GetRefArgument();
@@ -1703,8 +1762,8 @@ namespace webifc::geometry
 
       // TODO: review and simplify
       // TODO: review and simplify
-      case schema::IFCELLIPSE:
-      case schema::IFCCIRCLE:
+      case schema::TypeCase(CURVE_TYPES, schema::IFCELLIPSE):
+      case schema::TypeCase(CURVE_TYPES, schema::IFCCIRCLE):
       {
         _loader.MoveToArgumentOffset(expressID, 0);
         auto positionID = _loader.GetRefArgument();
@@ -1872,7 +1931,7 @@ namespace webifc::geometry
 
         break;
       }
-      case schema::IFCGRADIENTCURVE:
+      case schema::TypeCase(CURVE_TYPES, schema::IFCGRADIENTCURVE):
       {
         _loader.MoveToArgumentOffset(expressID, 0);
         auto tokens = _loader.GetSetArgument();
@@ -1892,7 +1951,7 @@ namespace webifc::geometry
         // #endif
         break;
       }
-      case schema::IFCCURVESEGMENT:
+      case schema::TypeCase(CURVE_TYPES, schema::IFCCURVESEGMENT):
       {
         _loader.MoveToArgumentOffset(expressID, 0);
         auto type = _loader.GetStringArgument();
@@ -1920,7 +1979,7 @@ namespace webifc::geometry
         }
         break;
       }
-      case schema::IFCBSPLINECURVE:
+      case schema::TypeCase(CURVE_TYPES, schema::IFCBSPLINECURVE):
       {
         bool condition = sameSense == 0;
         if (edge)
@@ -1987,7 +2046,7 @@ namespace webifc::geometry
 
         break;
       }
-    case schema::IFCBSPLINECURVEWITHKNOTS:
+    case schema::TypeCase(CURVE_TYPES, schema::IFCBSPLINECURVEWITHKNOTS):
       {
         bool condition = sameSense == 0;
         if (edge)
@@ -2077,7 +2136,7 @@ namespace webifc::geometry
 
     break;
   }
-case schema::IFCRATIONALBSPLINECURVEWITHKNOTS:
+case schema::TypeCase(CURVE_TYPES, schema::IFCRATIONALBSPLINECURVEWITHKNOTS):
   {
 
     bool condition = sameSense == 0;
@@ -2232,10 +2291,10 @@ IfcProfile IfcGeometryLoader::GetProfile(uint32_t expressID) const
   {
     spdlog::debug("[GetProfileByLine({})]",expressID);
     auto lineType = _loader.GetLineType(expressID);
-    switch (lineType)
+    switch (PROFILE_DISPATCH[_loader.GetLineTypeOrdinal(expressID)])
     {
-    case schema::IFCARBITRARYOPENPROFILEDEF:
-    case schema::IFCARBITRARYCLOSEDPROFILEDEF:
+    case schema::TypeCase(PROFILE_TYPES, schema::IFCARBITRARYOPENPROFILEDEF):
+    case schema::TypeCase(PROFILE_TYPES, schema::IFCARBITRARYCLOSEDPROFILEDEF):
     {
       IfcProfile profile;
 
@@ -2247,7 +2306,7 @@ IfcProfile IfcGeometryLoader::GetProfile(uint32_t expressID) const
 
       return profile;
     }
-    case schema::IFCARBITRARYPROFILEDEFWITHVOIDS:
+    case schema::TypeCase(PROFILE_TYPES, schema::IFCARBITRARYPROFILEDEFWITHVOIDS):
     {
       IfcProfile profile;
 
@@ -2268,8 +2327,8 @@ IfcProfile IfcGeometryLoader::GetProfile(uint32_t expressID) const
 
       return profile;
     }
-    case schema::IFCRECTANGLEPROFILEDEF:
-    case schema::IFCROUNDEDRECTANGLEPROFILEDEF:
+    case schema::TypeCase(PROFILE_TYPES, schema::IFCRECTANGLEPROFILEDEF):
+    case schema::TypeCase(PROFILE_TYPES, schema::IFCROUNDEDRECTANGLEPROFILEDEF):
     {
       IfcProfile profile;
 
@@ -2297,7 +2356,7 @@ IfcProfile IfcGeometryLoader::GetProfile(uint32_t expressID) const
       }
       return profile;
     }
-    case schema::IFCRECTANGLEHOLLOWPROFILEDEF:
+    case schema::TypeCase(PROFILE_TYPES, schema::IFCRECTANGLEHOLLOWPROFILEDEF):
     {
       IfcProfile profile;
 
@@ -2321,7 +2380,7 @@ IfcProfile IfcGeometryLoader::GetProfile(uint32_t expressID) const
 
       return profile;
     }
-    case schema::IFCCIRCLEPROFILEDEF:
+    case schema::TypeCase(PROFILE_TYPES, schema::IFCCIRCLEPROFILEDEF):
     {
       IfcProfile profile;
 
@@ -2344,7 +2403,7 @@ IfcProfile IfcGeometryLoader::GetProfile(uint32_t expressID) const
 
       return profile;
     }
-    case schema::IFCELLIPSEPROFILEDEF:
+    case schema::TypeCase(PROFILE_TYPES, schema::IFCELLIPSEPROFILEDEF):
     {
       IfcProfile profile;
 
@@ -2363,7 +2422,7 @@ IfcProfile IfcGeometryLoader::GetProfile(uint32_t expressID) const
 
       return profile;
     }
-    case schema::IFCCIRCLEHOLLOWPROFILEDEF:
+    case schema::TypeCase(PROFILE_TYPES, schema::IFCCIRCLEHOLLOWPROFILEDEF):
     {
       IfcProfile profile;
 
@@ -2384,7 +2443,7 @@ IfcProfile IfcGeometryLoader::GetProfile(uint32_t expressID) const
 
       return profile;
     }
-    case schema::IFCISHAPEPROFILEDEF:
+    case schema::TypeCase(PROFILE_TYPES, schema::IFCISHAPEPROFILEDEF):
     {
       IfcProfile profile;
 
@@ -2426,7 +2485,7 @@ IfcProfile IfcGeometryLoader::GetProfile(uint32_t expressID) const
 
       return profile;
     }
-    case schema::IFCLSHAPEPROFILEDEF:
+    case schema::TypeCase(PROFILE_TYPES, schema::IFCLSHAPEPROFILEDEF):
     {
       IfcProfile profile;
 
@@ -2474,7 +2533,7 @@ IfcProfile IfcGeometryLoader::GetProfile(uint32_t expressID) const
 
       return profile;
     }
-    case schema::IFCTSHAPEPROFILEDEF:
+    case schema::TypeCase(PROFILE_TYPES, schema::IFCTSHAPEPROFILEDEF):
     {
       IfcProfile profile;
 
@@ -2523,7 +2582,7 @@ IfcProfile IfcGeometryLoader::GetProfile(uint32_t expressID) const
 
       return profile;
     }
-    case schema::IFCUSHAPEPROFILEDEF:
+    case schema::TypeCase(PROFILE_TYPES, schema::IFCUSHAPEPROFILEDEF):
     {
       IfcProfile profile;
 
@@ -2562,7 +2621,7 @@ IfcProfile IfcGeometryLoader::GetProfile(uint32_t expressID) const
 
       return profile;
     }
-    case schema::IFCCSHAPEPROFILEDEF:
+    case schema::TypeCase(PROFILE_TYPES, schema::IFCCSHAPEPROFILEDEF):
     {
       IfcProfile profile;
 
@@ -2596,7 +2655,7 @@ IfcProfile IfcGeometryLoader::GetProfile(uint32_t expressID) const
 
       return profile;
     }
-    case schema::IFCZSHAPEPROFILEDEF:
+    case schema::TypeCase(PROFILE_TYPES, schema::IFCZSHAPEPROFILEDEF):
     {
       IfcProfile profile;
 
@@ -2631,7 +2690,7 @@ IfcProfile IfcGeometryLoader::GetProfile(uint32_t expressID) const
 
       return profile;
     }
-    case schema::IFCDERIVEDPROFILEDEF:
+    case schema::TypeCase(PROFILE_TYPES, schema::IFCDERIVEDPROFILEDEF):
     {
       _loader.MoveToArgumentOffset(expressID, 2);
       uint32_t profileID = _loader.GetRefArgument();
@@ -2661,7 +2720,7 @@ IfcProfile IfcGeometryLoader::GetProfile(uint32_t expressID) const
 
       return profile;
     }
-    case schema::IFCCOMPOSITEPROFILEDEF:
+    case schema::TypeCase(PROFILE_TYPES, schema::IFCCOMPOSITEPROFILEDEF):
     {
       IfcProfile profile = IfcProfile();
 
@@ -2689,7 +2748,7 @@ IfcProfile IfcGeometryLoader::GetProfile(uint32_t expressID) const
 
       return profile;
     }
-    case schema::IFCOPENCROSSPROFILEDEF:
+    case schema::TypeCase(PROFILE_TYPES, schema::IFCOPENCROSSPROFILEDEF):
     {
       IfcProfile profile = IfcProfile();
 
@@ -2759,7 +2818,7 @@ IfcProfile IfcGeometryLoader::GetProfile(uint32_t expressID) const
 
       return profile;
     }
-    case schema::IFCTRAPEZIUMPROFILEDEF:
+    case schema::TypeCase(PROFILE_TYPES, schema::IFCTRAPEZIUMPROFILEDEF):
     {
       IfcProfile profile;
 
@@ -2945,9 +3004,9 @@ IfcProfile IfcGeometryLoader::GetProfile(uint32_t expressID) const
   {
     spdlog::debug("[GetLocalPlacement({})]",expressID);
     auto lineType = _loader.GetLineType(expressID);
-    switch (lineType)
+    switch (PLACEMENT_DISPATCH[_loader.GetLineTypeOrdinal(expressID)])
     {
-    case schema::IFCPOINTBYDISTANCEEXPRESSION:
+    case schema::TypeCase(PLACEMENT_TYPES, schema::IFCPOINTBYDISTANCEEXPRESSION):
     {
       _loader.MoveToArgumentOffset(expressID, 0);
       IfcCurve curve;
@@ -2977,7 +3036,7 @@ IfcProfile IfcGeometryLoader::GetProfile(uint32_t expressID) const
         ;
       }
     }
-    case schema::IFCAXIS1PLACEMENT:
+    case schema::TypeCase(PLACEMENT_TYPES, schema::IFCAXIS1PLACEMENT):
     {
       glm::dvec3 zAxis(0, 0, 1);
       glm::dvec3 xAxis(1, 0, 0);
@@ -3005,7 +3064,7 @@ IfcProfile IfcGeometryLoader::GetProfile(uint32_t expressID) const
 
       return result;
     }
-  case schema::IFCAXIS2PLACEMENT3D:
+  case schema::TypeCase(PLACEMENT_TYPES, schema::IFCAXIS2PLACEMENT3D):
     {
       glm::dvec3 zAxis(0, 0, 1);
       glm::dvec3 xAxis(1, 0, 0);
@@ -3040,7 +3099,7 @@ IfcProfile IfcGeometryLoader::GetProfile(uint32_t expressID) const
         glm::dvec4(zAxis, 0),
         glm::dvec4(pos, 1));
     }
-    case schema::IFCAXIS2PLACEMENT2D:
+    case schema::TypeCase(PLACEMENT_TYPES, schema::IFCAXIS2PLACEMENT2D):
     {
       glm::dvec3 xAxis(1, 0, 0);
       glm::dvec3 zAxis(0, 0, 1);
@@ -3068,7 +3127,7 @@ IfcProfile IfcGeometryLoader::GetProfile(uint32_t expressID) const
           glm::dvec4(zAxis, 0),
           glm::dvec4(pos, 1));
     }
-    case schema::IFCLOCALPLACEMENT:
+    case schema::TypeCase(PLACEMENT_TYPES, schema::IFCLOCALPLACEMENT):
     {
       glm::dmat4 relPlacement(1);
 
@@ -3088,8 +3147,8 @@ IfcProfile IfcGeometryLoader::GetProfile(uint32_t expressID) const
       auto result = relPlacement * axis2Placement;
       return result;
     }
-    case schema::IFCCARTESIANTRANSFORMATIONOPERATOR3D:
-    case schema::IFCCARTESIANTRANSFORMATIONOPERATOR3DNONUNIFORM:
+    case schema::TypeCase(PLACEMENT_TYPES, schema::IFCCARTESIANTRANSFORMATIONOPERATOR3D):
+    case schema::TypeCase(PLACEMENT_TYPES, schema::IFCCARTESIANTRANSFORMATIONOPERATOR3DNONUNIFORM):
     {
       double scale1 = 1.0;
       double scale2 = 1.0;
@@ -3159,7 +3218,7 @@ IfcProfile IfcGeometryLoader::GetProfile(uint32_t expressID) const
           glm::dvec4(Axis3 * scale3, 0),
           glm::dvec4(pos, 1));
     }
-    case schema::IFCAXIS2PLACEMENTLINEAR:
+    case schema::TypeCase(PLACEMENT_TYPES, schema::IFCAXIS2PLACEMENTLINEAR):
     {
       glm::dvec3 vector = glm::dvec3(0, 0, 1);
       _loader.MoveToArgumentOffset(expressID, 0);
@@ -3171,7 +3230,7 @@ IfcProfile IfcGeometryLoader::GetProfile(uint32_t expressID) const
       }
       return GetLocalPlacement(posID, vector);
     }
-    case schema::IFCLINEARPLACEMENT:
+    case schema::TypeCase(PLACEMENT_TYPES, schema::IFCLINEARPLACEMENT):
     {
       _loader.MoveToArgumentOffset(expressID, 1);
       uint32_t posID = _loader.GetRefArgument();
@@ -15,9 +15,44 @@
 #include "operations/curve-utils.h"
 #include "operations/mesh_utils.h"
 #include <fuzzy/fuzzy-bools.h>
+#include "../schema/type_dispatch.h"
 
 namespace webifc::geometry
 {
+    namespace
+    {
+        // the types GetMesh handles, in the order of its switch
+        constexpr std::array<uint32_t, 26> MESH_TYPES = {
+            schema::IFCSECTIONEDSOLIDHORIZONTAL,
+            schema::IFCSECTIONEDSOLID,
+            schema::IFCSECTIONEDSURFACE,
+            schema::IFCMAPPEDITEM,
+            schema::IFCBOOLEANCLIPPINGRESULT,
+            schema::IFCBOOLEANRESULT,
+            schema::IFCHALFSPACESOLID,
+            schema::IFCPOLYGONALBOUNDEDHALFSPACE,
+            schema::IFCREPRESENTATIONMAP,
+            schema::IFCFACEBASEDSURFACEMODEL,
+            schema::IFCSHELLBASEDSURFACEMODEL,
+            schema::IFCADVANCEDBREP,
+            schema::IFCFACETEDBREP,
+            schema::IFCPRODUCTREPRESENTATION,
+            schema::IFCPRODUCTDEFINITIONSHAPE,
+            schema::IFCSHAPEREPRESENTATION,
+            schema::IFCPOLYGONALFACESET,
+            schema::IFCTRIANGULATEDFACESET,
+            schema::IFCSURFACECURVESWEPTAREASOLID,
+            schema::IFCSWEPTDISKSOLID,
+            schema::IFCREVOLVEDAREASOLID,
+            schema::IFCEXTRUDEDAREASOLID,
+            schema::IFCGEOMETRICSET,
+            schema::IFCPOLYLINE,
+            schema::IFCINDEXEDPOLYCURVE,
+            schema::IFCTRIMMEDCURVE
+        };
+        const schema::TypeDispatch MESH_DISPATCH(MESH_TYPES);
+    }
+
     IfcGeometryProcessor::IfcGeometryProcessor(const webifc::parsing::IfcLoader &loader, const webifc::schema::IfcSchemaManager &schemaManager, uint16_t circleSegments, bool coordinateToOrigin, bool optimizeprofiles)
         : _geometryLoader(loader, schemaManager, circleSegments), _loader(loader), _schemaManager(schemaManager), _coordinateToOrigin(coordinateToOrigin), _optimize_profiles(optimizeprofiles), _circleSegments(circleSegments)
     {
@@ -254,11 +289,11 @@ namespace webifc::geometry
         }
         else
         {
-            switch (lineType)
+            switch (MESH_DISPATCH[_loader.GetLineTypeOrdinal(expressID)])
             {
-            case schema::IFCSECTIONEDSOLIDHORIZONTAL:
-            case schema::IFCSECTIONEDSOLID:
-            case schema::IFCSECTIONEDSURFACE:
+            case schema::TypeCase(MESH_TYPES, schema::IFCSECTIONEDSOLIDHORIZONTAL):
+            case schema::TypeCase(MESH_TYPES, schema::IFCSECTIONEDSOLID):
+            case schema::TypeCase(MESH_TYPES, schema::IFCSECTIONEDSURFACE):
             {
                 auto geom = SectionedSurface(_geometryLoader.GetCrossSections3D(expressID));
                 mesh.transformation = glm::dmat4(1);
@@ -275,7 +310,7 @@ namespace webifc::geometry
 
                 break;
             }
-            case schema::IFCMAPPEDITEM:
+            case schema::TypeCase(MESH_TYPES, schema::IFCMAPPEDITEM):
             {
                 _loader.MoveToArgumentOffset(expressID, 0);
                 uint32_t ifcPresentation = _loader.GetRefArgument();
@@ -286,7 +321,7 @@ namespace webifc::geometry
 
                 return mesh;
             }
-            case schema::IFCBOOLEANCLIPPINGRESULT:
+            case schema::TypeCase(MESH_TYPES, schema::IFCBOOLEANCLIPPINGRESULT):
             {
                 _loader.MoveToArgumentOffset(expressID, 1);
                 uint32_t firstOperandID = _loader.GetRefArgument();
@@ -315,7 +350,7 @@ namespace webifc::geometry
 
                 return mesh;
             }
-            case schema::IFCBOOLEANRESULT:
+            case schema::TypeCase(MESH_TYPES, schema::IFCBOOLEANRESULT):
             {
                 // @Refactor: duplicate of above
 
@@ -367,7 +402,7 @@ namespace webifc::geometry
 
                 return mesh;
             }
-            case schema::IFCHALFSPACESOLID:
+            case schema::TypeCase(MESH_TYPES, schema::IFCHALFSPACESOLID):
             {
                 _loader.MoveToArgumentOffset(expressID, 0);
                 uint32_t surfaceID = _loader.GetRefArgument();
@@ -412,7 +447,7 @@ namespace webifc::geometry
 
                 return mesh;
             }
-            case schema::IFCPOLYGONALBOUNDEDHALFSPACE:
+            case schema::TypeCase(MESH_TYPES, schema::IFCPOLYGONALBOUNDEDHALFSPACE):
             {
                 _loader.MoveToArgumentOffset(expressID, 0);
                 uint32_t surfaceID = _loader.GetRefArgument();
@@ -481,7 +516,7 @@ namespace webifc::geometry
 
                 return mesh;
             }
-            case schema::IFCREPRESENTATIONMAP:
+            case schema::TypeCase(MESH_TYPES, schema::IFCREPRESENTATIONMAP):
             {
                 _loader.MoveToArgumentOffset(expressID, 0);
                 uint32_t axis2Placement = _loader.GetRefArgument();
@@ -492,8 +527,8 @@ namespace webifc::geometry
 
                 return mesh;
             }
-            case schema::IFCFACEBASEDSURFACEMODEL:
-            case schema::IFCSHELLBASEDSURFACEMODEL:
+            case schema::TypeCase(MESH_TYPES, schema::IFCFACEBASEDSURFACEMODEL):
+            case schema::TypeCase(MESH_TYPES, schema::IFCSHELLBASEDSURFACEMODEL):
             {
                 _loader.MoveToArgumentOffset(expressID, 0);
                 auto shells = _loader.GetSetArgument();
@@ -511,7 +546,7 @@ namespace webifc::geometry
 
                 return mesh;
             }
-            case schema::IFCADVANCEDBREP:
+            case schema::TypeCase(MESH_TYPES, schema::IFCADVANCEDBREP):
             {
                 _loader.MoveToArgumentOffset(expressID, 0);
                 uint32_t ifcPresentation = _loader.GetRefArgument();
@@ -521,7 +556,7 @@ namespace webifc::geometry
 
                 return mesh;
             }
-            case schema::IFCFACETEDBREP:
+            case schema::TypeCase(MESH_TYPES, schema::IFCFACETEDBREP):
             {
                 _loader.MoveToArgumentOffset(expressID, 0);
                 uint32_t ifcPresentation = _loader.GetRefArgument();
@@ -531,8 +566,8 @@ namespace webifc::geometry
 
                 return mesh;
             }
-            case schema::IFCPRODUCTREPRESENTATION:
-            case schema::IFCPRODUCTDEFINITIONSHAPE:
+            case schema::TypeCase(MESH_TYPES, schema::IFCPRODUCTREPRESENTATION):
+            case schema::TypeCase(MESH_TYPES, schema::IFCPRODUCTDEFINITIONSHAPE):
             {
                 _loader.MoveToArgumentOffset(expressID, 2);
                 auto representations = _loader.GetSetArgument();
@@ -545,7 +580,7 @@ namespace webifc::geometry
 
                 return mesh;
             }
-            case schema::IFCSHAPEREPRESENTATION:
+            case schema::TypeCase(MESH_TYPES, schema::IFCSHAPEREPRESENTATION):
             {
                 _loader.MoveToArgumentOffset(expressID, 1);
                 auto type = _loader.GetStringArgument();
@@ -561,7 +596,7 @@ namespace webifc::geometry
 
                 return mesh;
             }
-            case schema::IFCPOLYGONALFACESET:
+            case schema::TypeCase(MESH_TYPES, schema::IFCPOLYGONALFACESET):
             {
                 _loader.MoveToArgumentOffset(expressID, 0);
 
@@ -599,7 +634,7 @@ namespace webifc::geometry
 
                 return mesh;
             }
-            case schema::IFCTRIANGULATEDFACESET:
+            case schema::TypeCase(MESH_TYPES, schema::IFCTRIANGULATEDFACESET):
             {
                 _loader.MoveToArgumentOffset(expressID, 0);
 
@@ -642,7 +677,7 @@ namespace webifc::geometry
 
                 return mesh;
             }
-            case schema::IFCSURFACECURVESWEPTAREASOLID:
+            case schema::TypeCase(MESH_TYPES, schema::IFCSURFACECURVESWEPTAREASOLID):
             {
 
                 // TODO: closed sweeps not implemented
@@ -724,7 +759,7 @@ namespace webifc::geometry
 
                 return mesh;
             }
-            case schema::IFCSWEPTDISKSOLID:
+            case schema::TypeCase(MESH_TYPES, schema::IFCSWEPTDISKSOLID):
             {
                 _expressIDToGeometry[expressIdCyl] = predefinedCylinder;
                 _expressIDToGeometry[expressIdRect] = predefinedCube;
@@ -774,7 +809,7 @@ namespace webifc::geometry
 
                 return mesh;
             }
-            case schema::IFCREVOLVEDAREASOLID:
+            case schema::TypeCase(MESH_TYPES, schema::IFCREVOLVEDAREASOLID):
             {
                 IfcComposedMesh mesh;
 
@@ -824,7 +859,7 @@ namespace webifc::geometry
                     mesh.color = styledItemColor.value();
                 return mesh;
             }
-            case schema::IFCEXTRUDEDAREASOLID:
+            case schema::TypeCase(MESH_TYPES, schema::IFCEXTRUDEDAREASOLID):
             {
                 _expressIDToGeometry[expressIdCyl] = predefinedCylinder;
                 _expressIDToGeometry[expressIdRect] = predefinedCube;
@@ -1036,7 +1071,7 @@ namespace webifc::geometry
 
                 return mesh;
             }
-            case schema::IFCGEOMETRICSET:
+            case schema::TypeCase(MESH_TYPES, schema::IFCGEOMETRICSET):
             {
                 _loader.MoveToArgumentOffset(expressID, 0);
                 auto items = _loader.GetSetArgument();
@@ -1049,9 +1084,9 @@ namespace webifc::geometry
 
                 return mesh;
             }
-            case schema::IFCPOLYLINE:
-            case schema::IFCINDEXEDPOLYCURVE:
-            case schema::IFCTRIMMEDCURVE:
+            case schema::TypeCase(MESH_TYPES, schema::IFCPOLYLINE):
+            case schema::TypeCase(MESH_TYPES, schema::IFCINDEXEDPOLYCURVE):
+            case schema::TypeCase(MESH_TYPES, schema::IFCTRIMMEDCURVE):
                 // ignore polylines as meshes
                 return mesh;
             default:
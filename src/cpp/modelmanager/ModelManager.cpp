@@ -5,13 +5,16 @@
 #include <vector>
 #include <spdlog/spdlog.h>
 #include <sstream>
+#include <thread>
 #include "ModelManager.h"
 #include "../schema/IfcSchemaManager.h"
 #include "../geometry/IfcGeometryProcessor.h"
 #include "../parsing/IfcLoader.h"
 #include "../version.h"
 
-webifc::manager::ModelManager::ModelManager(bool _mt_enabled) {
+// one worker less than there are cores, so the workers and the thread calling into the manager fit the cores
+// (and the prestarted pthreads of the wasm build); background loads of the models run on these workers as well
+webifc::manager::ModelManager::ModelManager(bool _mt_enabled) : _workers(_mt_enabled ? webifc::parsing::AvailableThreads(std::thread::hardware_concurrency()) - 1 : 0) {
     mt_enabled = _mt_enabled;
 }
 
@@ -78,7 +81,15 @@ uint32_t webifc::manager::ModelManager::CreateModel(LoaderSettings settings) {
         spdlog::info(str.str());
         header_shown = true;
     }
-    webifc::parsing::IfcLoader * loader = new webifc::parsing::IfcLoader(settings.TAPE_SIZE,settings.MEMORY_LIMIT,settings.LINEWRITER_BUFFER,_schemaManager);
+    webifc::parsing::IfcLoaderSettings loaderSettings;
+    loaderSettings.TAPE_SIZE = settings.TAPE_SIZE;
+    loaderSettings.MEMORY_LIMIT = settings.MEMORY_LIMIT;
+    loaderSettings.LINEWRITER_BUFFER = settings.LINEWRITER_BUFFER;
+    loaderSettings.ARGUMENT_INDEX_BUDGET = settings.ARGUMENT_INDEX_BUDGET;
+    loaderSettings.TAPE_SPILL_LIMIT = settings.TAPE_SPILL_LIMIT;
+    loaderSettings.INVERSE_INDEX = settings.INVERSE_INDEX;
+    loaderSettings.TAPE_GARBAGE_RATIO = settings.TAPE_GARBAGE_RATIO;
+    webifc::parsing::IfcLoader * loader = new webifc::parsing::IfcLoader(loaderSettings,_schemaManager,&_workers);
     _loaders.push_back(loader);
     _settings.push_back(settings);
     return _loaders.size()-1;
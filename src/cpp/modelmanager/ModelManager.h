@@ -22,6 +22,10 @@ namespace webifc::manager {
         uint32_t TAPE_SIZE = 67108864 ; // probably no need for anyone other than web-ifc devs to change this
         uint32_t MEMORY_LIMIT = 2147483648;
         uint16_t LINEWRITER_BUFFER = 10000;
+        uint32_t ARGUMENT_INDEX_BUDGET = 16777216;
+        uint32_t TAPE_SPILL_LIMIT = 268435456;
+        bool INVERSE_INDEX = false;
+        uint32_t TAPE_GARBAGE_RATIO = 50;
     };
 
     class ModelManager {
@@ -38,6 +42,8 @@ namespace webifc::manager {
             void SetLogLevel(uint8_t levelArg);
         private: 
             const webifc::schema::IfcSchemaManager _schemaManager; 
+            // shared by the loaders of all models
+            webifc::parsing::WorkerPool _workers;
             std::vector<webifc::parsing::IfcLoader*> _loaders;
             std::vector<LoaderSettings> _settings;
             std::map<uint32_t,webifc::geometry::IfcGeometryProcessor*> _geometryProcessors;
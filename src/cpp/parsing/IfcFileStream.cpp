@@ -12,13 +12,28 @@
      load();
    }
 
+   IfcTokenStream::IfcFileStream::IfcFileStream(const char *data, const size_t size) : _size(size), _mappedData(data)
+   {
+     // the source is already in memory (or mapped), so the window is just a view into it
+     _buffer = nullptr;
+     load();
+   }
+
    IfcTokenStream::IfcFileStream::~IfcFileStream() 
    {
-    delete _buffer;
+    Clear();
    }
    
    void IfcTokenStream::IfcFileStream::load()
    {
+     if (_mappedData != nullptr)
+     {
+       prev = _startRef > 0 ? _mappedData[_startRef-1] : 0;
+       _buffer = const_cast<char*>(_mappedData) + _startRef;
+       _currentSize = _startRef < _size ? _size - _startRef : 0;
+       _pointer = 0;
+       return;
+     }
      if (_buffer == nullptr) _buffer = new char[_size];
      else if (_currentSize > 0) prev=_buffer[_currentSize-1];
      _currentSize = _dataSource(_buffer, _startRef, _size);
@@ -27,6 +42,14 @@
        
    void IfcTokenStream::IfcFileStream::Go(uint32_t ref)
    {
+      if (_mappedData == nullptr && ref > 0)
+      {
+        // also fetch the char before ref, the tokenizer looks back at it for signs and comment starts
+        _startRef=ref-1;
+        load();
+        Forward();
+        return;
+      }
       _startRef=ref;
       load();
    }
@@ -41,6 +64,27 @@
      }
    }
 
+   void IfcTokenStream::IfcFileStream::Forward(const size_t size) 
+   { 
+     // size must not exceed Available()
+     _pointer+=size;
+     if (_pointer == _currentSize && _currentSize != 0)
+     {
+       _startRef += _currentSize;
+       load();
+     }
+   }
+
+   const char * IfcTokenStream::IfcFileStream::Data() 
+   {
+     return _buffer + _pointer;
+   }
+
+   size_t IfcTokenStream::IfcFileStream::Available() 
+   {
+     return _currentSize - _pointer;
+   }
+
    void IfcTokenStream::IfcFileStream::Back()
    {
       if (_pointer == 0)
@@ -48,7 +92,7 @@
         if (_startRef > 0) {
           _startRef--;
           load();
-          _pointer = _currentSize - 1;
+          _pointer = 0;
         }
       } 
       else
@@ -59,7 +103,7 @@
 
    void IfcTokenStream::IfcFileStream::Clear() 
    {
-      delete[] _buffer;
+      if (_mappedData == nullptr) delete[] _buffer;
       _buffer=nullptr;
    }
    
@@ -81,6 +125,7 @@
    
    char IfcTokenStream::IfcFileStream::Get()
    { 
+     if (_pointer >= _currentSize) return 0;
      return _buffer[_pointer]; 
    }
  }
\ No newline at end of file
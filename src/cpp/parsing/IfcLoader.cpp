@@ -6,198 +6,1059 @@
 #include <string>
 #include <cmath>
 #include <algorithm>
+#include <cstring>
+#include <functional>
 #include <format>
 #include <fast_float/fast_float.h>
 #include <spdlog/spdlog.h>
+#if !defined(__EMSCRIPTEN__) && !defined(_WIN32)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#endif
 #include "IfcLoader.h"
+#include "parallel.h"
+#include "step_writer.h"
+#include "token_scan.h"
 #include "../version.h"
 #include "../schema/IfcSchemaManager.h" 
 
 namespace webifc::parsing {
 
-  void p21encode(std::string_view input, std::ostringstream &output);
+  // tape offset of expressIDs without a line
+  constexpr uint32_t NO_LINE = UINT32_MAX;
+
+  // approximate bookkeeping cost of one line in the argument offset index, besides its offsets
+  constexpr size_t ARGUMENT_INDEX_ENTRY_SIZE = sizeof(uint32_t) + sizeof(std::vector<uint32_t>) + 2 * sizeof(void*);
+
+  // a snapshot starts with this header, followed by the chunk sizes, the header lines, the non-empty line pages
+  // (each behind its page index), the type index and finally the tape, every section padded to 8 bytes
+  constexpr char SNAPSHOT_MAGIC[8] = {'W', 'I', 'F', 'C', 'S', 'N', 'A', 'P'};
+  // version 2 stores schema labels on the tape as type codes, version 3 adds the type ordinals to the line pages
+  constexpr uint32_t SNAPSHOT_VERSION = 3;
+
+  struct SnapshotHeader
+  {
+    char magic[8];
+    uint32_t version;
+    uint32_t maxExpressId;
+    uint64_t chunkCount;
+    uint64_t headerLineCount;
+    uint64_t pageCount;
+    uint64_t typeCount;
+    uint64_t typeExpressIDCount;
+    uint64_t tapeSize;
+  };
+
+  // levels of a reference closure are split into blocks of this many lines for the workers
+  constexpr size_t CLOSURE_BLOCK_SIZE = 4096;
+
+  // text is handed to the output of SaveFile in pieces of this size
+  constexpr size_t SAVE_BUFFER_SIZE = 1 << 20;
+  // tape bytes a running compaction copies with every edit
+  constexpr size_t COMPACT_STEP_SIZE = 1 << 16;
+
   std::string p21decode(std::string_view & str);    
  
-   IfcLoader::IfcLoader(uint32_t tapeSize, uint32_t memoryLimit,uint32_t lineWriterBuffer, const schema::IfcSchemaManager &schemaManager) :_lineWriterBuffer(lineWriterBuffer), _schemaManager(schemaManager)
+   IfcLoader::IfcLoader(const IfcLoaderSettings &settings, const schema::IfcSchemaManager &schemaManager, WorkerPool *workers) :_tapeSize(settings.TAPE_SIZE), _lineWriterBuffer(settings.LINEWRITER_BUFFER), _argumentIndexBudget(settings.ARGUMENT_INDEX_BUDGET), _inverseIndex(settings.INVERSE_INDEX), _tapeGarbageRatio(settings.TAPE_GARBAGE_RATIO), _schemaManager(schemaManager)
    { 
-     _tokenStream = new IfcTokenStream(tapeSize,memoryLimit/tapeSize);
-     _nullLine = new IfcLine();
-     _nullLine->ifcType=0;
-     _nullLine->tapeOffset=0;
+     _tokenStream = new IfcTokenStream(settings.TAPE_SIZE,settings.MEMORY_LIMIT/settings.TAPE_SIZE,settings.TAPE_SPILL_LIMIT,settings.THREADS,workers);
    }  
    
-   const std::vector<uint32_t> IfcLoader::GetExpressIDsWithType(const uint32_t type) const
+   std::span<const uint32_t> IfcLoader::GetExpressIDsWithType(const uint32_t type) const
    { 
-      if (_ifcTypeToExpressID.count(type)==0) return {};
-      return _ifcTypeToExpressID.at(type);
+      // the span stays valid until lines are added
+      if (!_pendingTypeLines.empty()) freezeTypeIndex();
+      auto it = std::lower_bound(_types.begin(), _types.end(), type);
+      if (it == _types.end() || *it != type) return {};
+      const size_t ordinal = it - _types.begin();
+      return std::span<const uint32_t>(_typeExpressIDs.data() + _typeOffsets[ordinal], _typeOffsets[ordinal + 1] - _typeOffsets[ordinal]);
+   }
+
+   std::span<const uint32_t> IfcLoader::GetExpressIDsWithTypeAndSubtypes(const uint32_t type) const
+   {
+      // valid as long as the spans of GetExpressIDsWithType
+      if (!_pendingTypeLines.empty()) freezeTypeIndex();
+      auto cached = _subtypeExpressIDs.find(type);
+      if (cached != _subtypeExpressIDs.end()) return cached->second;
+
+      // reading the schema moves the tape, callers may be in the middle of a line
+      const size_t readOffset = _tokenStream->GetReadOffset();
+      const IFC_SCHEMA schema = GetSchema();
+      _tokenStream->MoveTo(readOffset);
+
+      std::vector<uint32_t> &expressIDs = _subtypeExpressIDs[type];
+      auto lines = GetExpressIDsWithType(type);
+      expressIDs.insert(expressIDs.end(), lines.begin(), lines.end());
+      for (const uint32_t subtype : schema::IfcSchemaManager::GetSubtypes(schema, type))
+      {
+        lines = GetExpressIDsWithType(subtype);
+        expressIDs.insert(expressIDs.end(), lines.begin(), lines.end());
+      }
+      std::sort(expressIDs.begin(), expressIDs.end());
+      return expressIDs;
+   }
+
+   void IfcLoader::freezeTypeIndex() const
+   {
+      // merges the pending lines into the index, appending them to their type in the order they were added
+      std::vector<uint32_t> types = _types;
+      for (auto &line : _pendingTypeLines) types.push_back(line.first);
+      std::sort(types.begin(), types.end());
+      types.erase(std::unique(types.begin(), types.end()), types.end());
+
+      const auto ordinal = [&](const uint32_t type) { return std::lower_bound(types.begin(), types.end(), type) - types.begin(); };
+      std::vector<uint32_t> offsets(types.size() + 1, 0);
+      for (size_t i = 0; i < _types.size(); i++) offsets[ordinal(_types[i]) + 1] = _typeOffsets[i + 1] - _typeOffsets[i];
+      // consecutive lines are often of the same type, so skip the search for those
+      uint32_t lastType = 0;
+      size_t lastOrdinal = 0;
+      for (size_t i = 0; i < _pendingTypeLines.size(); i++)
+      {
+        if (i == 0 || _pendingTypeLines[i].first != lastType) lastOrdinal = ordinal(_pendingTypeLines[i].first);
+        lastType = _pendingTypeLines[i].first;
+        offsets[lastOrdinal + 1]++;
+      }
+      for (size_t i = 1; i < offsets.size(); i++) offsets[i] += offsets[i - 1];
+
+      std::vector<uint32_t> expressIDs(offsets.back());
+      std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+      for (size_t i = 0; i < _types.size(); i++)
+      {
+        const size_t o = ordinal(_types[i]);
+        std::copy(_typeExpressIDs.begin() + _typeOffsets[i], _typeExpressIDs.begin() + _typeOffsets[i + 1], expressIDs.begin() + cursor[o]);
+        cursor[o] += _typeOffsets[i + 1] - _typeOffsets[i];
+      }
+      lastType = 0;
+      for (size_t i = 0; i < _pendingTypeLines.size(); i++)
+      {
+        if (i == 0 || _pendingTypeLines[i].first != lastType) lastOrdinal = ordinal(_pendingTypeLines[i].first);
+        lastType = _pendingTypeLines[i].first;
+        expressIDs[cursor[lastOrdinal]++] = _pendingTypeLines[i].second;
+      }
+
+      _types = std::move(types);
+      _typeOffsets = std::move(offsets);
+      _typeExpressIDs = std::move(expressIDs);
+      std::vector<std::pair<uint32_t, uint32_t>>().swap(_pendingTypeLines);
+      _subtypeExpressIDs.clear();
    }
    
+   bool IfcLoader::HasInverseIndex() const
+   {
+      return _inverseIndex;
+   }
+
+   std::span<const IfcLoader::InverseReference> IfcLoader::GetInverseReferences(const uint32_t expressID) const
+   {
+      // the span stays valid until lines are written or removed
+      if (!_inverseIndex) return {};
+      if (!_inverseBuilt || !_pendingInverseLines.empty()) freezeInverseIndex();
+      return indexRow(_inversePages, expressID);
+   }
+
+   template <typename T> std::span<const T> IfcLoader::indexRow(const std::vector<RowPage<T>*> &pages, const uint32_t expressID)
+   {
+      const size_t p = (expressID - 1) >> LINE_PAGE_BITS;
+      if (expressID == 0 || p >= pages.size() || pages[p] == nullptr) return {};
+      const RowPage<T> * page = pages[p];
+      const uint32_t i = (expressID - 1) & (LINE_PAGE_SIZE - 1);
+      return std::span<const T>(page->values.data() + page->offsets[i], page->offsets[i + 1] - page->offsets[i]);
+   }
+
+   template <typename T, typename Matches> void IfcLoader::patchRows(std::vector<RowPage<T>*> &pages, std::vector<std::pair<uint32_t, uint32_t>> &removals, std::vector<std::pair<uint32_t, T>> &additions, Matches matches) const
+   {
+      // a removal (row, key) drops the values of the row that match key, additions are appended after that. Rows of lines that
+      // cannot exist are ignored, a row lists each value once and sorted. Only the pages of the touched rows are rebuilt
+      const auto ignored = [&](const uint32_t expressID) { return expressID == 0 || expressID > _maxExpressId; };
+      const size_t pageCount = (_maxExpressId >> LINE_PAGE_BITS) + 1;
+      if (pages.size() < pageCount) pages.resize(pageCount, nullptr);
+
+      // both lists are bucketed by page first
+      std::vector<uint32_t> removalOffsets(pageCount + 1, 0);
+      std::vector<uint32_t> additionOffsets(pageCount + 1, 0);
+      for (auto &removal : removals) if (!ignored(removal.first)) removalOffsets[((removal.first - 1) >> LINE_PAGE_BITS) + 1]++;
+      for (auto &addition : additions) if (!ignored(addition.first)) additionOffsets[((addition.first - 1) >> LINE_PAGE_BITS) + 1]++;
+      for (size_t p = 1; p <= pageCount; p++)
+      {
+        removalOffsets[p] += removalOffsets[p - 1];
+        additionOffsets[p] += additionOffsets[p - 1];
+      }
+      std::vector<std::pair<uint32_t, uint32_t>> pageRemovals(removalOffsets.back());
+      std::vector<std::pair<uint32_t, T>> pageAdditions(additionOffsets.back());
+      std::vector<uint32_t> cursor(removalOffsets.begin(), removalOffsets.end() - 1);
+      for (auto &removal : removals) if (!ignored(removal.first)) pageRemovals[cursor[(removal.first - 1) >> LINE_PAGE_BITS]++] = {(removal.first - 1) & (LINE_PAGE_SIZE - 1), removal.second};
+      cursor.assign(additionOffsets.begin(), additionOffsets.end() - 1);
+      for (auto &addition : additions) if (!ignored(addition.first)) pageAdditions[cursor[(addition.first - 1) >> LINE_PAGE_BITS]++] = {(addition.first - 1) & (LINE_PAGE_SIZE - 1), addition.second};
+      std::vector<std::pair<uint32_t, uint32_t>>().swap(removals);
+      std::vector<std::pair<uint32_t, T>>().swap(additions);
+
+      for (size_t p = 0; p < pageCount; p++)
+      {
+        if (removalOffsets[p] == removalOffsets[p + 1] && additionOffsets[p] == additionOffsets[p + 1]) continue;
+        auto removed = pageRemovals.begin() + removalOffsets[p];
+        const auto removedEnd = pageRemovals.begin() + removalOffsets[p + 1];
+        auto added = pageAdditions.begin() + additionOffsets[p];
+        const auto addedEnd = pageAdditions.begin() + additionOffsets[p + 1];
+        std::sort(removed, removedEnd);
+        std::sort(added, addedEnd);
+
+        const RowPage<T> * old = pages[p];
+        RowPage<T> * page = new RowPage<T>();
+        page->values.reserve((old ? old->values.size() : 0) + (addedEnd - added));
+        for (uint32_t i = 0; i < LINE_PAGE_SIZE; i++)
+        {
+          const size_t begin = page->values.size();
+          page->offsets[i] = begin;
+          const auto rowRemoved = removed;
+          while (removed != removedEnd && removed->first == i) removed++;
+          if (old)
+          {
+            for (uint32_t v = old->offsets[i]; v < old->offsets[i + 1]; v++)
+            {
+              const T &value = old->values[v];
+              if (std::none_of(rowRemoved, removed, [&](const std::pair<uint32_t, uint32_t> &removal) { return matches(value, removal.second); })) page->values.push_back(value);
+            }
+          }
+          for (; added != addedEnd && added->first == i; added++) page->values.push_back(added->second);
+          std::sort(page->values.begin() + begin, page->values.end());
+          page->values.erase(std::unique(page->values.begin() + begin, page->values.end()), page->values.end());
+        }
+        page->offsets[LINE_PAGE_SIZE] = page->values.size();
+        delete old;
+        if (page->values.empty())
+        {
+          delete page;
+          page = nullptr;
+        }
+        else page->values.shrink_to_fit();
+        pages[p] = page;
+      }
+   }
+
+   void IfcLoader::freezeInverseIndex() const
+   {
+      // the old references of the changed lines are dropped and their current ones read from the tape, the first time all lines count as changed
+      std::vector<uint32_t> changed;
+      std::vector<std::pair<uint32_t, uint32_t>> removals;
+      if (!_inverseBuilt) changed = GetAllLines();
+      else
+      {
+        changed = std::move(_pendingInverseLines);
+        std::sort(changed.begin(), changed.end());
+        changed.erase(std::unique(changed.begin(), changed.end()), changed.end());
+        removals = std::move(_pendingInverseRemovals);
+      }
+
+      // callers may be in the middle of a line
+      std::vector<std::pair<uint32_t, InverseReference>> references;
+      const size_t readOffset = _tokenStream->GetReadOffset();
+      for (const uint32_t expressID : changed)
+      {
+        if (IsValidExpressID(expressID) && GetLineType(expressID) != 0) lineReferences(expressID, references);
+      }
+      _tokenStream->MoveTo(readOffset);
+      patchRows(_inversePages, removals, references, [](const InverseReference &reference, const uint32_t expressID) { return reference.expressID == expressID; });
+      _inverseBuilt = true;
+      std::vector<uint32_t>().swap(_pendingInverseLines);
+      std::vector<std::pair<uint32_t, uint32_t>>().swap(_pendingInverseRemovals);
+   }
+
+   void IfcLoader::queueIndexEdit(const uint32_t expressID)
+   {
+      // the rows the old version of the line is listed in are only known while it is still on the tape
+      if (_inverseBuilt)
+      {
+        _pendingInverseLines.push_back(expressID);
+        if (IsValidExpressID(expressID) && GetLineType(expressID) != 0)
+        {
+          std::vector<std::pair<uint32_t, InverseReference>> references;
+          lineReferences(expressID, references);
+          for (auto &reference : references) _pendingInverseRemovals.push_back({reference.first, expressID});
+        }
+      }
+      if (_referencesBuilt) _pendingReferenceLines.push_back(expressID);
+   }
+
+   std::span<const uint32_t> IfcLoader::GetReferences(const uint32_t expressID) const
+   {
+      // the span stays valid until lines are written or removed
+      if (!_referencesBuilt || !_pendingReferenceLines.empty()) freezeReferenceIndex();
+      return indexRow(_referencePages, expressID);
+   }
+
+   void IfcLoader::freezeReferenceIndex() const
+   {
+      std::vector<std::pair<uint32_t, uint32_t>> removals;
+      std::vector<std::pair<uint32_t, uint32_t>> references;
+      if (!_referencesBuilt && _inverseIndex)
+      {
+        // the inverse index already holds every reference
+        if (!_inverseBuilt || !_pendingInverseLines.empty()) freezeInverseIndex();
+        for (size_t p = 0; p < _inversePages.size(); p++)
+        {
+          const RowPage<InverseReference> * page = _inversePages[p];
+          if (page == nullptr) continue;
+          for (uint32_t i = 0; i < LINE_PAGE_SIZE; i++)
+          {
+            for (uint32_t r = page->offsets[i]; r < page->offsets[i + 1]; r++) references.push_back({page->values[r].expressID, static_cast<uint32_t>((p << LINE_PAGE_BITS) + i + 1)});
+          }
+        }
+      }
+      else
+      {
+        // lines that did not change keep their row, the rows of all others are read again from the tape
+        std::vector<uint32_t> changed;
+        if (!_referencesBuilt) changed = GetAllLines();
+        else
+        {
+          changed = std::move(_pendingReferenceLines);
+          std::sort(changed.begin(), changed.end());
+          changed.erase(std::unique(changed.begin(), changed.end()), changed.end());
+        }
+        std::vector<std::pair<uint32_t, InverseReference>> found;
+        const size_t readOffset = _tokenStream->GetReadOffset();
+        for (const uint32_t expressID : changed)
+        {
+          removals.push_back({expressID, 0});
+          if (!IsValidExpressID(expressID) || GetLineType(expressID) == 0) continue;
+          found.clear();
+          lineReferences(expressID, found);
+          for (auto &reference : found)
+          {
+            if (reference.first != 0 && reference.first <= _maxExpressId) references.push_back({expressID, reference.first});
+          }
+        }
+        _tokenStream->MoveTo(readOffset);
+      }
+      patchRows(_referencePages, removals, references, [](const uint32_t, const uint32_t) { return true; });
+      _referencesBuilt = true;
+      std::vector<uint32_t>().swap(_pendingReferenceLines);
+   }
+
+   std::vector<uint32_t> IfcLoader::GetReferenceClosure(const std::vector<uint32_t> &expressIDs) const
+   {
+      // breadth first one level at a time, the lines of a level are split over the workers and each line is claimed by the first worker reaching it
+      if (!_referencesBuilt || !_pendingReferenceLines.empty()) freezeReferenceIndex();
+      const auto isLine = [&](const uint32_t expressID) { return IsValidExpressID(expressID) && GetLineType(expressID) != 0; };
+      // claimed lines are marked in a bitmap holding a block of words for each line page that exists
+      constexpr uint32_t PAGE_WORDS = LINE_PAGE_SIZE / 64;
+      std::vector<uint32_t> pageBlocks(_linePages.size(), 0);
+      size_t pageBlockCount = 0;
+      for (size_t p = 0; p < _linePages.size(); p++)
+      {
+        if (_linePages[p] != nullptr) pageBlocks[p] = pageBlockCount++;
+      }
+      std::vector<std::atomic<uint64_t>> visited(pageBlockCount * PAGE_WORDS);
+      const auto claim = [&](const uint32_t expressID)
+      {
+        const uint32_t i = expressID - 1;
+        const uint64_t bit = uint64_t(1) << (i & 63);
+        return (visited[pageBlocks[i >> LINE_PAGE_BITS] * PAGE_WORDS + ((i & (LINE_PAGE_SIZE - 1)) >> 6)].fetch_or(bit, std::memory_order_relaxed) & bit) == 0;
+      };
+      std::vector<uint32_t> closure;
+      std::vector<uint32_t> level;
+      for (const uint32_t expressID : expressIDs)
+      {
+        if (isLine(expressID) && claim(expressID)) level.push_back(expressID);
+      }
+      while (!level.empty())
+      {
+        closure.insert(closure.end(), level.begin(), level.end());
+        const size_t blocks = (level.size() + CLOSURE_BLOCK_SIZE - 1) / CLOSURE_BLOCK_SIZE;
+        std::vector<std::vector<uint32_t>> next(blocks);
+        _tokenStream->GetWorkers().ParallelFor(blocks, [&](size_t block)
+        {
+          const size_t end = std::min(level.size(), (block + 1) * CLOSURE_BLOCK_SIZE);
+          for (size_t i = block * CLOSURE_BLOCK_SIZE; i < end; i++)
+          {
+            for (const uint32_t reference : indexRow(_referencePages, level[i]))
+            {
+              if (isLine(reference) && claim(reference)) next[block].push_back(reference);
+            }
+          }
+        });
+        level.clear();
+        for (auto &lines : next) level.insert(level.end(), lines.begin(), lines.end());
+      }
+      std::sort(closure.begin(), closure.end());
+      return closure;
+   }
+
+   std::vector<uint32_t> IfcLoader::GetInversePropertyForItem(const uint32_t expressID, const std::vector<uint32_t> &types, const uint32_t position, const bool all) const
+   {
+      // the inverse index only narrows down the lines to read, they are read and listed just as a scan over the types finds them
+      std::vector<uint32_t> inverseIDs;
+      const auto visit = [&](const uint32_t line)
+      {
+        if (GetLineType(line) == 0) return false;
+        const uint32_t count = argumentReferences(line, position, expressID, all);
+        inverseIDs.insert(inverseIDs.end(), count, line);
+        return !all && count > 0;
+      };
+      if (!_inverseIndex)
+      {
+        for (const uint32_t type : types)
+        {
+          for (const uint32_t line : GetExpressIDsWithType(type)) if (visit(line)) return inverseIDs;
+        }
+        return inverseIDs;
+      }
+
+      // a row is sorted by expressID and lists a line once per argument
+      std::vector<uint32_t> candidates;
+      for (auto &reference : GetInverseReferences(expressID))
+      {
+        if (reference.argument == position) candidates.push_back(reference.expressID);
+      }
+      std::vector<uint32_t> lines;
+      for (const uint32_t type : types)
+      {
+        lines.clear();
+        for (const uint32_t line : candidates) if (GetLineType(line) == type) lines.push_back(line);
+        if (lines.size() > 1)
+        {
+          // the type index lists lines in the order they were added, which need not be the order of their expressIDs
+          std::vector<uint32_t> ordered;
+          for (const uint32_t line : GetExpressIDsWithType(type)) if (std::binary_search(lines.begin(), lines.end(), line)) ordered.push_back(line);
+          lines.swap(ordered);
+        }
+        for (const uint32_t line : lines) if (visit(line)) return inverseIDs;
+      }
+      return inverseIDs;
+   }
+
+   uint32_t IfcLoader::argumentReferences(const uint32_t line, const uint32_t position, const uint32_t expressID, const bool all) const
+   {
+      // how often the argument holds expressID, as a reference or among the members of a set, sets in that set are skipped
+      MoveToLineArgument(line, position);
+      IfcTokenType t = GetTokenType();
+      if (t == IfcTokenType::REF)
+      {
+        StepBack();
+        return GetRefArgument() == expressID ? 1 : 0;
+      }
+      if (t != IfcTokenType::SET_BEGIN) return 0;
+      uint32_t count = 0;
+      uint32_t setDepth = 1;
+      while (setDepth > 0 && !_tokenStream->IsAtEnd())
+      {
+        t = static_cast<IfcTokenType>(_tokenStream->Read<char>());
+        switch (t)
+        {
+          case IfcTokenType::SET_BEGIN:
+            setDepth++;
+            break;
+          case IfcTokenType::SET_END:
+            setDepth--;
+            break;
+          case IfcTokenType::REF:
+            if (_tokenStream->Read<uint32_t>() == expressID && setDepth == 1)
+            {
+              count++;
+              if (!all) return count;
+            }
+            break;
+          case IfcTokenType::INTEGER:
+          case IfcTokenType::REAL:
+            _tokenStream->Forward(sizeof(double));
+            [[fallthrough]];
+          case IfcTokenType::STRING:
+          case IfcTokenType::ENUM:
+          case IfcTokenType::LABEL:
+            _tokenStream->Forward(_tokenStream->Read<uint16_t>());
+            break;
+          case IfcTokenType::TYPE_CODE:
+            _tokenStream->Read<uint32_t>();
+            break;
+          case IfcTokenType::LINE_END:
+            return count;
+          default:
+            break;
+        }
+      }
+      return count;
+   }
+
    const std::vector<uint32_t> IfcLoader::GetHeaderLinesWithType(const uint32_t type) const
    { 
      std::vector<uint32_t> ret;
      for (size_t i=0; i < _headerLines.size();i++)
      {
-        if (_headerLines[i]->ifcType==type) ret.push_back(i);
+        if (_headerLines[i].ifcType==type) ret.push_back(i);
      }
      return ret;
    }
    
-   void IfcLoader::LoadFile(const std::function<uint32_t(char *, size_t, size_t)> &requestData)
+   bool IfcLoader::LoadFile(const std::function<uint32_t(char *, size_t, size_t)> &requestData)
    { 
+     if (IfcZipSource::IsZip(requestData)) return loadZip(requestData);
      _tokenStream->SetTokenSource(requestData);
      ParseLines();
+     return true;
+   }
+
+   bool IfcLoader::loadZip(const std::function<uint32_t(char *, size_t, size_t)> &requestData)
+   {
+     // the tokenizer reads the inflated .ifc, so only the compressed container and the tape are ever in memory
+     _zipSource = new IfcZipSource(requestData);
+     if (!_zipSource->Open()) return false;
+     _tokenStream->SetTokenSource([this](char *dest, size_t sourceOffset, size_t destSize) { return _zipSource->Read(dest, sourceOffset, destSize); });
+     ParseLines();
+     return true;
    }
 
    IFC_SCHEMA IfcLoader::GetSchema() const
    { 
-      auto line = GetHeaderLinesWithType(schema::FILE_SCHEMA)[0];
-      MoveToHeaderLineArgument(line, 0);
+      auto lines = GetHeaderLinesWithType(schema::FILE_SCHEMA);
+      if (lines.empty()) return IFC2X3;
+      MoveToHeaderLineArgument(lines[0], 0);
       auto schemas = _schemaManager.GetAvailableSchemas();
 
       while (!_tokenStream->IsAtEnd()) {
-          IfcTokenType t = static_cast<IfcTokenType>(_tokenStream->Read<char>());
+          IfcTokenType t = GetTokenType();
           if (t == IfcTokenType::LINE_END) break;
-          if (t == IfcTokenType::LABEL) 
+          if (t == IfcTokenType::LABEL || t == IfcTokenType::STRING) 
           {
-            std::string_view schemaName = _tokenStream->ReadString();
+            StepBack();
+            std::string_view schemaName = GetStringArgument();
+            // releases without their own tables (IFC4X1, IFC4X3_ADD2, ...) are read as the schema their name starts with
+            size_t best = schemas.size();
             for (size_t i = 0; i < schemas.size();i++) 
             {
-              if (_schemaManager.GetSchemaName(schemas[i]) == schemaName) return schemas[i];
+              std::string_view name = _schemaManager.GetSchemaName(schemas[i]);
+              if (schemaName.starts_with(name) && (best == schemas.size() || name.size() > _schemaManager.GetSchemaName(schemas[best]).size())) best = i;
             }
+            if (best != schemas.size()) return schemas[best];
           }
       }
       return IFC2X3;
    }
    
-   void IfcLoader::LoadFile(std::istream &requestData)
+   bool IfcLoader::LoadFile(std::istream &requestData)
    { 
-     _tokenStream->SetTokenSource(requestData);
+     return LoadFile([&](char* dest, size_t sourceOffset, size_t destSize) -> uint32_t { requestData.clear(); requestData.seekg(sourceOffset); requestData.read(dest, destSize); return requestData.gcount();});
+   }
+
+   bool IfcLoader::LoadFile(const char *data, const size_t size)
+   { 
+     const auto requestData = [data, size](char *dest, size_t sourceOffset, size_t destSize) -> uint32_t
+     {
+       if (sourceOffset >= size) return 0;
+       const size_t length = std::min(destSize, size - sourceOffset);
+       std::memcpy(dest, data + sourceOffset, length);
+       return length;
+     };
+     if (IfcZipSource::IsZip(requestData)) return loadZip(requestData);
+     _tokenStream->SetTokenSource(data, size);
      ParseLines();
+     return true;
+   }
+
+   bool IfcLoader::LoadFile(const std::string &path)
+   {
+     if (!mapFile(path)) return false;
+     return LoadFile(static_cast<const char*>(_mappedFile), _mappedFileSize);
+   }
+
+   bool IfcLoader::mapFile(const std::string &path)
+   {
+#if !defined(__EMSCRIPTEN__) && !defined(_WIN32)
+     int fd = open(path.c_str(), O_RDONLY);
+     if (fd < 0)
+     {
+       spdlog::error("[mapFile()] unable to open {}", path);
+       return false;
+     }
+     struct stat st;
+     if (fstat(fd, &st) != 0 || st.st_size == 0)
+     {
+       spdlog::error("[mapFile()] unable to read {}", path);
+       close(fd);
+       return false;
+     }
+     void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+     close(fd);
+     if (data == MAP_FAILED)
+     {
+       spdlog::error("[mapFile()] unable to map {}", path);
+       return false;
+     }
+     _mappedFile = data;
+     _mappedFileSize = st.st_size;
+#else
+     // no mmap here, hold the file in memory instead so chunks can still be reloaded without copies
+     std::ifstream file(path, std::ios::binary | std::ios::ate);
+     if (!file.is_open() || file.tellg() <= 0)
+     {
+       spdlog::error("[mapFile()] unable to open {}", path);
+       return false;
+     }
+     _mappedFileSize = file.tellg();
+     _mappedFile = new char[_mappedFileSize];
+     file.seekg(0);
+     file.read(static_cast<char*>(_mappedFile), _mappedFileSize);
+#endif
+     return true;
+   }
+
+   void IfcLoader::unmapFile()
+   {
+     if (_mappedFile == nullptr) return;
+#if !defined(__EMSCRIPTEN__) && !defined(_WIN32)
+     munmap(_mappedFile, _mappedFileSize);
+#else
+     delete[] static_cast<char*>(_mappedFile);
+#endif
+     _mappedFile = nullptr;
+     _mappedFileSize = 0;
    }
    
+   namespace
+   {
+     // read access to the tape straight from its loaded chunks, which is safe from several threads at once
+     struct TapeView
+     {
+       std::vector<std::string_view> chunks;
+       std::vector<size_t> chunkRefs;
+       size_t chunk = 0;
+       size_t pos = 0;
+
+       void MoveTo(const size_t offset)
+       {
+         chunk = std::upper_bound(chunkRefs.begin(), chunkRefs.end(), offset) - chunkRefs.begin() - 1;
+         pos = offset - chunkRefs[chunk];
+         next();
+       }
+
+       template <typename T> T Read()
+       {
+         T v;
+         std::memcpy(&v, chunks[chunk].data() + pos, sizeof(T));
+         Forward(sizeof(T));
+         return v;
+       }
+
+       std::string_view ReadString()
+       {
+         const uint16_t length = Read<uint16_t>();
+         const std::string_view str = chunks[chunk].substr(pos, length);
+         Forward(length);
+         return str;
+       }
+
+       void Forward(const size_t size)
+       {
+         pos += size;
+         next();
+       }
+
+       bool IsAtEnd() const
+       {
+         return chunk + 1 >= chunks.size() && pos >= chunks.back().size();
+       }
+
+       // tokens never straddle chunks, so a read that ends a chunk continues in the next one
+       void next()
+       {
+         while (pos >= chunks[chunk].size() && chunk + 1 < chunks.size())
+         {
+           pos -= chunks[chunk].size();
+           chunk++;
+         }
+       }
+     };
+
+     // renumbering lists the renumbered expressIDs in ascending order, the one at position i becomes i + 1. Others keep their number
+     uint32_t Renumber(const std::vector<uint32_t> &renumbering, const uint32_t expressID)
+     {
+       auto it = std::lower_bound(renumbering.begin(), renumbering.end(), expressID);
+       return it != renumbering.end() && *it == expressID ? (it - renumbering.begin()) + 1 : expressID;
+     }
+
+     // writes the line at the read position of tape, the token stream or a TapeView
+     template <typename Tape> void WriteLine(Tape &tape, StepWriter &writer, const std::vector<uint32_t> &renumbering)
+     {
+       bool newLine = true;
+       bool insideSet = false;
+       IfcTokenType prev = IfcTokenType::EMPTY;
+       while (!tape.IsAtEnd())
+       {
+         IfcTokenType t = static_cast<IfcTokenType>(tape.template Read<char>());
+         std::string_view label;
+         if (t == IfcTokenType::TYPE_CODE)
+         {
+           label = schema::IfcSchemaManager::IfcTypeCodeToLabel(tape.template Read<uint32_t>());
+           t = IfcTokenType::LABEL;
+         }
+         else if (t == IfcTokenType::LABEL) label = tape.ReadString();
+
+         if (t != IfcTokenType::SET_END && t != IfcTokenType::LINE_END)
+         {
+           if (insideSet && prev != IfcTokenType::SET_BEGIN && prev != IfcTokenType::LABEL && prev != IfcTokenType::LINE_END) writer.Put(',');
+         }
+
+         switch (t)
+         {
+           case IfcTokenType::LINE_END:
+             writer.Put(";\n");
+             return;
+           case IfcTokenType::UNKNOWN:
+             writer.Put('*');
+             break;
+           case IfcTokenType::EMPTY:
+             writer.Put('$');
+             break;
+           case IfcTokenType::SET_BEGIN:
+             writer.Put('(');
+             insideSet = true;
+             break;
+           case IfcTokenType::SET_END:
+             writer.Put(')');
+             break;
+           case IfcTokenType::STRING:
+             writer.Put('\'');
+             writer.PutEncoded(tape.ReadString());
+             writer.Put('\'');
+             break;
+           case IfcTokenType::ENUM:
+             writer.Put('.');
+             writer.Put(tape.ReadString());
+             writer.Put('.');
+             break;
+           case IfcTokenType::REF:
+           {
+             const uint32_t ref = tape.template Read<uint32_t>();
+             writer.Put('#');
+             writer.PutNumber(Renumber(renumbering, ref));
+             if (newLine) writer.Put('=');
+             break;
+           }
+           case IfcTokenType::LABEL:
+             writer.Put(label);
+             break;
+           case IfcTokenType::REAL:
+           case IfcTokenType::INTEGER:
+             tape.Forward(sizeof(double));
+             writer.Put(tape.ReadString());
+             break;
+           default:
+             break;
+         }
+         newLine = false;
+         prev = t;
+       }
+     }
+
+     // copies STEP text from the source to a writer, fed window by window. The statements are followed through strings
+     // and comments so the ones of some lines can be replaced: replace is asked for every line and returns true when it
+     // wrote the line itself, dataEnd is called before the end of the data section
+     struct SourceSplice
+     {
+       enum class State { BETWEEN, STATEMENT, STRING, COMMENT };
+       SourceSplice(StepWriter &writer, const std::function<bool(uint32_t)> &replace, const std::function<void()> &dataEnd) : writer(writer), replace(replace), dataEnd(dataEnd) {}
+       StepWriter &writer;
+       std::function<bool(uint32_t)> replace;
+       std::function<void()> dataEnd;
+       State state = State::BETWEEN;
+       State commentReturn = State::BETWEEN;
+       // the start of a statement, held back until it is known whether the statement is copied
+       std::string head;
+       bool deciding = false;
+       bool skipping = false;
+       bool dropNewline = false;
+       bool slash = false;
+       bool star = false;
+       bool inData = false;
+
+       void Feed(const char *data, const size_t size)
+       {
+         size_t run = 0;
+         const auto emit = [&](const size_t end)
+         {
+           if (!skipping && end > run) writer.Put(std::string_view(data + run, end - run));
+           run = end;
+         };
+         for (size_t i = 0; i < size; i++)
+         {
+           if (state == State::STRING)
+           {
+             const char *quote = static_cast<const char*>(std::memchr(data + i, '\'', size - i));
+             if (quote == nullptr) break;
+             // a doubled quote simply starts the next string
+             i = quote - data;
+             state = State::STATEMENT;
+             continue;
+           }
+           if (state == State::STATEMENT && !slash && !deciding)
+           {
+             // only quotes, the end of the statement and comments matter inside it
+             i += scan::UntilAny(data + i, size - i, '\'', ';', '/');
+             if (i == size) break;
+           }
+           const char c = data[i];
+           if (state == State::COMMENT)
+           {
+             if (star && c == '/') state = commentReturn;
+             star = c == '*';
+             continue;
+           }
+           if (deciding)
+           {
+             const bool id = head[0] == '#';
+             if (id ? scan::IsDigit(c) : scan::IsLabelChar(c) || c == '-')
+             {
+               head.push_back(c);
+               run = i + 1;
+               continue;
+             }
+             deciding = false;
+             decide();
+             run = i;
+           }
+           if (slash && c == '*')
+           {
+             commentReturn = state;
+             state = State::COMMENT;
+             star = false;
+             slash = false;
+             continue;
+           }
+           slash = c == '/';
+           if (state == State::BETWEEN)
+           {
+             if (dropNewline && (c == '\r' || c == '\n'))
+             {
+               dropNewline = c == '\r';
+               run = i + 1;
+               continue;
+             }
+             dropNewline = false;
+             if (scan::IsWhitespace(c) || c == '/') continue;
+             state = State::STATEMENT;
+             if (c == '#' || scan::IsLabelChar(c))
+             {
+               emit(i);
+               deciding = true;
+               head.assign(1, c);
+               run = i + 1;
+               continue;
+             }
+           }
+           if (c == '\'') state = State::STRING;
+           else if (c == ';')
+           {
+             state = State::BETWEEN;
+             if (skipping)
+             {
+               skipping = false;
+               dropNewline = true;
+               run = i + 1;
+             }
+           }
+         }
+         emit(size);
+       }
+
+       // a statement start at the very end of the source is still pending
+       void Finish()
+       {
+         if (!deciding) return;
+         deciding = false;
+         decide();
+       }
+
+       void decide()
+       {
+         if (head[0] == '#')
+         {
+           uint32_t expressID = 0;
+           std::from_chars(head.data() + 1, head.data() + head.size(), expressID);
+           skipping = replace(expressID);
+           if (!skipping) writer.Put(head);
+           return;
+         }
+         if (head == "DATA") inData = true;
+         else if (head == "ENDSEC" && inData)
+         {
+           dataEnd();
+           inData = false;
+         }
+         writer.Put(head);
+       }
+     };
+   }
+
    void IfcLoader::SaveFile(const std::function<void(char *, size_t)> &outputData) const
    { 
-      std::ostringstream output;
-      output << "ISO-10303-21;"<<std::endl<<"HEADER;"<<std::endl;
-      output << "/******************************************************" << std::endl;
-      output << "* STEP Physical File produced by: That Open Engine WebIfc " << WEB_IFC_VERSION_NUMBER << std::endl;
-      output << "* Module: web-ifc/IfcLoader" << std::endl;
-      output << "* Version: " << WEB_IFC_VERSION_NUMBER << std::endl;
-      output << "* Source: https://github.com/ThatOpen/engine_web-ifc" << std::endl;
-      output << "* Issues: https://github.com/ThatOpen/engine_web-ifc/issues" << std::endl;
-      output << "******************************************************/" << std::endl;
-      
-      const std::vector<IfcLine*> *totalLines[2] = {&_headerLines, &_lines};
-      uint32_t linesWritten = 0;
-      for (uint8_t z=0; z < 2; z++)
+      saveLines(outputData, nullptr, {});
+   }
+
+   void IfcLoader::SaveFileIncremental(const std::function<void(char *, size_t)> &outputData) const
+   {
+      // the source is copied as it is except for the lines edited since loading: those are written again from the tape in place,
+      // removed ones are left out and new ones are added at the end of the data section. Without a source or with edited
+      // header lines everything is written again
+      if (_headerEdited)
+      {
+        SaveFile(outputData);
+        return;
+      }
+      std::vector<uint32_t> edited = _editedLines;
+      std::sort(edited.begin(), edited.end());
+      edited.erase(std::unique(edited.begin(), edited.end()), edited.end());
+      std::vector<bool> inSource(edited.size(), false);
+      const auto isLine = [&](const uint32_t expressID) { return IsValidExpressID(expressID) && GetLineType(expressID) != 0; };
+      const auto write = [&](StepWriter &writer, const uint32_t expressID)
       {
-        const std::vector<IfcLine*>* currentLines = totalLines[z];
-        for(uint32_t i=0; i < currentLines->size();i++)
+        _tokenStream->MoveTo(lineOffset(expressID));
+        WriteLine(*_tokenStream, writer, {});
+      };
+
+      StepWriter writer(SAVE_BUFFER_SIZE, &outputData);
+      bool added = false;
+      const auto addNewLines = [&]()
+      {
+        for (size_t i = 0; i < edited.size(); i++)
         {
-          IfcLine * line = (*currentLines)[i];
-
-          if (line == _nullLine || line->ifcType == 0) continue;
-          _tokenStream->MoveTo(line->tapeOffset);
-          bool newLine = true;
-          bool insideSet = false;
-          IfcTokenType prev = IfcTokenType::EMPTY;
-          while (!_tokenStream->IsAtEnd())
-          {
-            IfcTokenType t = static_cast<IfcTokenType>(_tokenStream->Read<char>());
+          if (!inSource[i] && isLine(edited[i])) write(writer, edited[i]);
+        }
+        added = true;
+      };
+      SourceSplice splice(writer, [&](const uint32_t expressID)
+      {
+        auto it = std::lower_bound(edited.begin(), edited.end(), expressID);
+        if (it == edited.end() || *it != expressID) return false;
+        inSource[it - edited.begin()] = true;
+        if (isLine(expressID)) write(writer, expressID);
+        return true;
+      }, addNewLines);
+      if (!_tokenStream->ReadSource([&](const char *data, size_t size) { splice.Feed(data, size); }))
+      {
+        SaveFile(outputData);
+        return;
+      }
+      splice.Finish();
+      if (!added) addNewLines();
+      writer.Flush();
+   }
 
-            if (t != IfcTokenType::SET_END && t != IfcTokenType::LINE_END)
-            {
-              if (insideSet && prev != IfcTokenType::SET_BEGIN && prev != IfcTokenType::LABEL && prev != IfcTokenType::LINE_END)
-              {
-                output << ",";
-              }
-            }
+   void IfcLoader::SaveFileIncremental(std::ostream &outputData) const
+   {
+     SaveFileIncremental([&](char* src, size_t srcSize)
+      {
+          outputData.write(src,srcSize);
+      }
+    );
+   }
 
-            if (t == IfcTokenType::LINE_END)
-            {
-              output << ";" << std::endl;
-              break;
-            }
+   void IfcLoader::SaveSubset(const std::vector<uint32_t> &expressIDs, const std::function<void(char *, size_t)> &outputData, const bool renumber) const
+   {
+      // the closure is written, so the subset refers to no line it leaves out. Renumbered lines keep their order
+      const std::vector<uint32_t> closure = GetReferenceClosure(expressIDs);
+      saveLines(outputData, &closure, renumber ? closure : std::vector<uint32_t>());
+   }
 
-            switch (t)
-            {
-              case IfcTokenType::UNKNOWN:
-              {
-                output << "*";
-                break;
-              }
-              case IfcTokenType::EMPTY:
-              {
-                output << "$";
-                break;
-              }
-              case IfcTokenType::SET_BEGIN:
-              {
-                output << "(";
-                insideSet = true;
-                break;
-              }
-              case IfcTokenType::SET_END:
-              {
-                output << ")";
-                break;
-              }
-              case IfcTokenType::STRING:
-              {
-                output << "'";
-                p21encode(_tokenStream->ReadString(),output);
-                output << "'";
-                break;
-              }
-              case IfcTokenType::ENUM:
-              {
-                output << "." << _tokenStream->ReadString() << ".";
-                break;
-              }
-              case IfcTokenType::REF:
-              {
-                output << "#" << _tokenStream->Read<uint32_t>();
-                if (newLine) output << "=";
-                break;
-              }
-              case IfcTokenType::LABEL:
-              case IfcTokenType::REAL:
-              case IfcTokenType::INTEGER:
-              { 
-                output << _tokenStream->ReadString();
-                break;
-              }
-              default:
-                break;
-            }
+   void IfcLoader::SaveSubset(const std::vector<uint32_t> &expressIDs, std::ostream &outputData, const bool renumber) const
+   {
+     SaveSubset(expressIDs, [&](char* src, size_t srcSize)
+      {
+          outputData.write(src,srcSize);
+      }, renumber
+    );
+   }
 
-            if (t == IfcTokenType::LINE_END)
-            {
-              newLine = true;
-              insideSet = false;
-            }
-            else
+   void IfcLoader::saveLines(const std::function<void(char *, size_t)> &outputData, const std::vector<uint32_t> *expressIDs, const std::vector<uint32_t> &renumbering) const
+   {
+      // writes the header lines and either all lines or the given ones, references are written through renumbering unless it is empty
+      StepWriter writer(SAVE_BUFFER_SIZE, &outputData);
+      writer.Put("ISO-10303-21;\nHEADER;\n");
+      writer.Put("/******************************************************\n");
+      writer.Put("* STEP Physical File produced by: That Open Engine WebIfc ");
+      writer.Put(WEB_IFC_VERSION_NUMBER);
+      writer.Put("\n* Module: web-ifc/IfcLoader\n* Version: ");
+      writer.Put(WEB_IFC_VERSION_NUMBER);
+      writer.Put("\n* Source: https://github.com/ThatOpen/engine_web-ifc\n");
+      writer.Put("* Issues: https://github.com/ThatOpen/engine_web-ifc/issues\n");
+      writer.Put("******************************************************/\n");
+      for (auto &line : _headerLines)
+      {
+        if (line.tapeOffset == NO_LINE || line.ifcType == 0) continue;
+        _tokenStream->MoveTo(line.tapeOffset);
+        WriteLine(*_tokenStream, writer, renumbering);
+      }
+      writer.Put("ENDSEC;\nDATA;\n");
+
+      std::vector<uint32_t> tapeOffsets;
+      const auto addLine = [&](const LinePage *page, const uint32_t slot)
+      {
+        const uint32_t i = slot & (LINE_PAGE_SIZE - 1);
+        if (page->tapeOffset[i] != NO_LINE && page->ifcType[i] != 0) tapeOffsets.push_back(page->tapeOffset[i]);
+      };
+      if (expressIDs != nullptr)
+      {
+        for (const uint32_t expressID : *expressIDs)
+        {
+          const LinePage *page = linePage(expressID);
+          if (page != nullptr) addLine(page, expressID - 1);
+        }
+      }
+      else
+      {
+        for (size_t p = 0; p < _linePages.size(); p++)
+        {
+          if (_linePages[p] == nullptr) continue;
+          for (uint32_t i = 0; i < LINE_PAGE_SIZE; i++) addLine(_linePages[p], i);
+        }
+      }
+
+      WorkerPool &workers = _tokenStream->GetWorkers();
+      const size_t threads = workers.Size() + 1;
+      const size_t rangeSize = std::max<size_t>(1, _lineWriterBuffer);
+      bool allLoaded = threads > 1 && tapeOffsets.size() > rangeSize;
+      for (size_t i = 0; i < _tokenStream->GetChunkCount() && allLoaded; i++) allLoaded = _tokenStream->IsChunkLoaded(i);
+      if (allLoaded)
+      {
+        // ranges of lines are written by the workers into buffers of their own, a few ranges per worker at a time, and emitted in order
+        TapeView tape;
+        for (size_t i = 0; i < _tokenStream->GetChunkCount(); i++)
+        {
+          tape.chunks.push_back(_tokenStream->GetLoadedChunkTokens(i));
+          tape.chunkRefs.push_back(_tokenStream->GetChunkTokenRef(i));
+        }
+        writer.Flush();
+        const size_t rangeCount = (tapeOffsets.size() + rangeSize - 1) / rangeSize;
+        for (size_t first = 0; first < rangeCount; first += threads * 4)
+        {
+          std::vector<std::string> ranges(std::min(threads * 4, rangeCount - first));
+          workers.ParallelFor(ranges.size(), [&](size_t r)
+          {
+            TapeView rangeTape = tape;
+            StepWriter rangeWriter(0, nullptr);
+            const size_t end = std::min(tapeOffsets.size(), (first + r + 1) * rangeSize);
+            for (size_t i = (first + r) * rangeSize; i < end; i++)
             {
-              newLine = false;
+              rangeTape.MoveTo(tapeOffsets[i]);
+              WriteLine(rangeTape, rangeWriter, renumbering);
             }
-            prev = t;
-          }
-        
-          linesWritten++;
-          if (linesWritten > _lineWriterBuffer ) 
-          {
-            std::string tmp = output.str();
-            outputData((char*)tmp.c_str(),tmp.size());
-            output.str("");
-            output.clear();
-            linesWritten=0;
-          }
+            ranges[r] = std::move(rangeWriter.Buffer());
+          });
+          for (auto &range : ranges) outputData(range.data(), range.size());
+        }
+      }
+      else
+      {
+        for (const uint32_t tapeOffset : tapeOffsets)
+        {
+          _tokenStream->MoveTo(tapeOffset);
+          WriteLine(*_tokenStream, writer, renumbering);
         }
-        if (z==0) output << "ENDSEC;"<<std::endl<<"DATA;"<<std::endl;
       }
-      output << "ENDSEC;"<<std::endl<<"END-ISO-10303-21;";
-      std::string tmp = output.str();
-      outputData((char*)tmp.c_str(),tmp.size());
+      writer.Put("ENDSEC;\nEND-ISO-10303-21;");
+      writer.Flush();
    }
    
    void IfcLoader::SaveFile(std::ostream &outputData) const
@@ -209,131 +1070,504 @@ namespace webifc::parsing {
     );
    }
       
+   void IfcLoader::SaveSnapshot(std::ostream &outputData) const
+   {
+      // the tape is written as it is, so loading the snapshot needs neither the tokenizer nor ParseLines
+      if (!_pendingTypeLines.empty()) freezeTypeIndex();
+      size_t written = 0;
+      const auto write = [&](const void *src, const size_t srcSize)
+      {
+        outputData.write(static_cast<const char*>(src), srcSize);
+        written += srcSize;
+      };
+      const auto pad = [&]()
+      {
+        const uint64_t zero = 0;
+        if (written % sizeof(zero) != 0) write(&zero, sizeof(zero) - written % sizeof(zero));
+      };
+
+      const size_t chunkCount = _tokenStream->GetChunkCount();
+      SnapshotHeader header = {};
+      std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+      header.version = SNAPSHOT_VERSION;
+      header.maxExpressId = _maxExpressId;
+      header.chunkCount = chunkCount;
+      header.headerLineCount = _headerLines.size();
+      header.pageCount = std::count_if(_linePages.begin(), _linePages.end(), [](const LinePage *page) { return page != nullptr; });
+      header.typeCount = _types.size();
+      header.typeExpressIDCount = _typeExpressIDs.size();
+      header.tapeSize = _tokenStream->GetTotalSize();
+      write(&header, sizeof(header));
+
+      for (size_t i = 0; i < chunkCount; i++)
+      {
+        const uint64_t next = i + 1 < chunkCount ? _tokenStream->GetChunkTokenRef(i + 1) : header.tapeSize;
+        const uint64_t chunkSize = next - _tokenStream->GetChunkTokenRef(i);
+        write(&chunkSize, sizeof(chunkSize));
+      }
+      write(_headerLines.data(), _headerLines.size() * sizeof(IfcLine));
+      pad();
+      for (uint32_t i = 0; i < _linePages.size(); i++)
+      {
+        if (_linePages[i] == nullptr) continue;
+        const uint64_t pageIndex = i;
+        write(&pageIndex, sizeof(pageIndex));
+        write(_linePages[i], sizeof(LinePage));
+      }
+      write(_types.data(), _types.size() * sizeof(uint32_t));
+      write(_typeOffsets.data(), _typeOffsets.size() * sizeof(uint32_t));
+      write(_typeExpressIDs.data(), _typeExpressIDs.size() * sizeof(uint32_t));
+      pad();
+      for (size_t i = 0; i < chunkCount; i++)
+      {
+        std::string_view tokens = _tokenStream->GetChunkTokens(i);
+        write(tokens.data(), tokens.size());
+      }
+   }
+
+   bool IfcLoader::LoadSnapshot(const std::string &path)
+   {
+     if (!mapFile(path)) return false;
+     if (LoadSnapshot(static_cast<const char*>(_mappedFile), _mappedFileSize)) return true;
+     unmapFile();
+     return false;
+   }
+
+   bool IfcLoader::LoadSnapshot(const char *data, const size_t size)
+   {
+      // data must stay valid for the lifetime of the loader, tape chunks are copied out of it when they are read
+      size_t pos = 0;
+      const auto take = [&](const uint64_t count, const size_t elementSize) -> const char*
+      {
+        if (count > size || count * elementSize > size - pos) return nullptr;
+        const char *src = data + pos;
+        pos += count * elementSize;
+        return src;
+      };
+      const auto pad = [&]() { pos = std::min(size, (pos + 7) & ~size_t(7)); };
+
+      SnapshotHeader header;
+      const char *src = take(1, sizeof(header));
+      if (src == nullptr)
+      {
+        spdlog::error("[LoadSnapshot()] not a snapshot");
+        return false;
+      }
+      std::memcpy(&header, src, sizeof(header));
+      if (std::memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0 || header.version != SNAPSHOT_VERSION)
+      {
+        spdlog::error("[LoadSnapshot()] not a snapshot of version {}", SNAPSHOT_VERSION);
+        return false;
+      }
+      if (header.typeCount >= size)
+      {
+        spdlog::error("[LoadSnapshot()] snapshot is truncated");
+        return false;
+      }
+      const size_t pageSlots = header.maxExpressId == 0 ? 0 : ((header.maxExpressId - 1) >> LINE_PAGE_BITS) + 1;
+
+      const char *chunkSizesSrc = take(header.chunkCount, sizeof(uint64_t));
+      const char *headerLinesSrc = take(header.headerLineCount, sizeof(IfcLine));
+      pad();
+      const char *pagesSrc = take(header.pageCount, sizeof(uint64_t) + sizeof(LinePage));
+      const char *typesSrc = take(header.typeCount, sizeof(uint32_t));
+      const char *typeOffsetsSrc = take(header.typeCount + 1, sizeof(uint32_t));
+      const char *typeExpressIDsSrc = take(header.typeExpressIDCount, sizeof(uint32_t));
+      pad();
+      const char *tapeSrc = take(header.tapeSize, 1);
+      if (chunkSizesSrc == nullptr || headerLinesSrc == nullptr || pagesSrc == nullptr || typesSrc == nullptr || typeOffsetsSrc == nullptr || typeExpressIDsSrc == nullptr || tapeSrc == nullptr)
+      {
+        spdlog::error("[LoadSnapshot()] snapshot is truncated");
+        return false;
+      }
+
+      std::vector<uint64_t> chunkSizes(header.chunkCount);
+      if (header.chunkCount > 0) std::memcpy(chunkSizes.data(), chunkSizesSrc, chunkSizes.size() * sizeof(uint64_t));
+      uint64_t tapeSize = 0;
+      for (uint64_t chunkSize : chunkSizes) tapeSize += chunkSize;
+      std::vector<IfcLine> headerLines(header.headerLineCount);
+      if (header.headerLineCount > 0) std::memcpy(headerLines.data(), headerLinesSrc, headerLines.size() * sizeof(IfcLine));
+      std::vector<uint32_t> types(header.typeCount);
+      if (header.typeCount > 0) std::memcpy(types.data(), typesSrc, types.size() * sizeof(uint32_t));
+      std::vector<uint32_t> typeOffsets(header.typeCount + 1);
+      std::memcpy(typeOffsets.data(), typeOffsetsSrc, typeOffsets.size() * sizeof(uint32_t));
+      std::vector<uint32_t> typeExpressIDs(header.typeExpressIDCount);
+      if (header.typeExpressIDCount > 0) std::memcpy(typeExpressIDs.data(), typeExpressIDsSrc, typeExpressIDs.size() * sizeof(uint32_t));
+
+      // every offset and expressID read later is checked here, so a damaged snapshot fails to load instead of reading past the tape
+      const auto onTape = [&](const uint32_t tapeOffset) { return tapeOffset < header.tapeSize; };
+      const auto isExpressID = [&](const uint32_t expressID) { return expressID > 0 && expressID <= header.maxExpressId; };
+      bool valid = tapeSize == header.tapeSize && typeOffsets.front() == 0 && typeOffsets.back() == header.typeExpressIDCount
+        && std::is_sorted(typeOffsets.begin(), typeOffsets.end())
+        && std::adjacent_find(types.begin(), types.end(), std::greater_equal<uint32_t>()) == types.end()
+        && std::all_of(typeExpressIDs.begin(), typeExpressIDs.end(), isExpressID)
+        && std::all_of(headerLines.begin(), headerLines.end(), [&](const IfcLine &line) { return onTape(line.tapeOffset); });
+
+      // pages are only put in the line table once all of them are read
+      std::vector<std::pair<uint64_t, LinePage*>> pages;
+      pages.reserve(valid ? header.pageCount : 0);
+      for (uint64_t i = 0; valid && i < header.pageCount; i++)
+      {
+        const char *pageSrc = pagesSrc + i * (sizeof(uint64_t) + sizeof(LinePage));
+        uint64_t pageIndex;
+        std::memcpy(&pageIndex, pageSrc, sizeof(pageIndex));
+        valid = pageIndex < pageSlots && (pageIndex >= _linePages.size() || _linePages[pageIndex] == nullptr)
+          && (pages.empty() || pages.back().first < pageIndex);
+        if (!valid) break;
+        LinePage *page = new LinePage();
+        std::memcpy(page, pageSrc + sizeof(pageIndex), sizeof(LinePage));
+        pages.emplace_back(pageIndex, page);
+        valid = std::all_of(page->tapeOffset, page->tapeOffset + LINE_PAGE_SIZE, [&](const uint32_t tapeOffset) { return tapeOffset == NO_LINE || onTape(tapeOffset); });
+      }
+      if (!valid)
+      {
+        for (auto &[pageIndex, page] : pages) delete page;
+        spdlog::error("[LoadSnapshot()] snapshot is corrupt");
+        return false;
+      }
+
+      _linePages.resize(std::max(_linePages.size(), pageSlots), nullptr);
+      for (auto &[pageIndex, page] : pages) _linePages[pageIndex] = page;
+      _maxExpressId = header.maxExpressId;
+      _headerLines = std::move(headerLines);
+      _types = std::move(types);
+      _typeOffsets = std::move(typeOffsets);
+      _typeExpressIDs = std::move(typeExpressIDs);
+      _tokenStream->SetTokenSnapshot(tapeSrc, chunkSizes);
+      return true;
+   }
+
    bool IfcLoader::IsAtEnd() const
    {
      return _tokenStream->IsAtEnd();
    }
   
+   namespace
+   {
+     struct ParsedLine
+     {
+       uint32_t expressID;
+       uint32_t ifcType;
+       uint32_t tapeOffset;
+     };
+
+     // the lines found in a single tape chunk. A line can start in one chunk and end in a later one,
+     // so the first ref and type before the first line end are kept apart to complete the line left open before
+     struct ChunkLines
+     {
+       bool hasLineEnd = false;
+       uint32_t leadingExpressID = 0;
+       uint32_t leadingIfcType = 0;
+       std::vector<ParsedLine> lines;
+       ParsedLine trailing = {0, 0, 0};
+       uint32_t maxExpressID = 0;
+       // the end of the first line end, and the (referenced expressID, reference) pairs found in the chunk
+       size_t leadingEnd = 0;
+       std::vector<std::pair<uint32_t, IfcLoader::InverseReference>> references;
+     };
+
+     // follows a line token by token, counting its arguments the way ArgumentOffset does, so a reference is listed
+     // under the argument MoveToArgumentOffset reaches it by. References in sets of sets and typed values are not listed
+     struct ReferenceScan
+     {
+       uint32_t expressID = 0;
+       uint32_t setDepth = 0;
+       uint32_t argument = 0;
+       // false while the start of the line was scanned apart, until its line end
+       bool known = true;
+
+       void Token(const IfcTokenType t, const uint32_t ref, std::vector<std::pair<uint32_t, IfcLoader::InverseReference>> &references)
+       {
+         if (setDepth == 1) argument++;
+         switch (t)
+         {
+           case IfcTokenType::SET_BEGIN:
+             setDepth++;
+             break;
+           case IfcTokenType::SET_END:
+             if (setDepth > 0) setDepth--;
+             break;
+           case IfcTokenType::REF:
+             if (setDepth == 0 && expressID == 0) expressID = ref;
+             else if (known && expressID != 0 && (setDepth == 1 || setDepth == 2)) references.push_back({ref, {expressID, argument - 1}});
+             break;
+           case IfcTokenType::LINE_END:
+             *this = ReferenceScan();
+             break;
+           default:
+             break;
+         }
+       }
+     };
+
+     // references is null when the inverse index is not kept, it carries the state of the open line from chunk to chunk
+     void ScanChunkLines(const std::string_view tokens, const uint32_t tokenRef, const schema::IfcSchemaManager &schemaManager, ChunkLines &result, ReferenceScan *references)
+     {
+       ParsedLine current = {0, 0, 0};
+       bool leading = true;
+       size_t pos = 0;
+       while (pos < tokens.size())
+       {
+         IfcTokenType t = static_cast<IfcTokenType>(tokens[pos++]);
+         uint32_t ref = 0;
+         if (t == IfcTokenType::REF) std::memcpy(&ref, tokens.data() + pos, sizeof(uint32_t));
+         if (references != nullptr) references->Token(t, ref, result.references);
+         switch (t)
+         {
+           case IfcTokenType::LINE_END:
+           {
+             if (leading)
+             {
+               result.hasLineEnd = true;
+               result.leadingExpressID = current.expressID;
+               result.leadingIfcType = current.ifcType;
+               result.leadingEnd = pos;
+               leading = false;
+             }
+             else if (current.ifcType != 0)
+             {
+               result.lines.push_back(current);
+               result.maxExpressID = std::max(result.maxExpressID, current.expressID);
+             }
+             current = {0, 0, static_cast<uint32_t>(tokenRef + pos)};
+             break;
+           }
+           case IfcTokenType::REAL:
+           case IfcTokenType::INTEGER:
+             pos += sizeof(double);
+             [[fallthrough]];
+           case IfcTokenType::STRING:
+           case IfcTokenType::ENUM:
+           case IfcTokenType::LABEL:
+           {
+             uint16_t size;
+             std::memcpy(&size, tokens.data() + pos, sizeof(uint16_t));
+             pos += sizeof(uint16_t);
+             if (t == IfcTokenType::LABEL && current.ifcType == 0) current.ifcType = schemaManager.IfcTypeToTypeCode(tokens.substr(pos, size));
+             pos += size;
+             break;
+           }
+           case IfcTokenType::REF:
+           {
+             if (current.expressID == 0) current.expressID = ref;
+             pos += sizeof(uint32_t);
+             break;
+           }
+           case IfcTokenType::TYPE_CODE:
+           {
+             if (current.ifcType == 0) std::memcpy(&current.ifcType, tokens.data() + pos, sizeof(uint32_t));
+             pos += sizeof(uint32_t);
+             break;
+           }
+           default:
+             break;
+         }
+       }
+       if (leading)
+       {
+         result.leadingExpressID = current.expressID;
+         result.leadingIfcType = current.ifcType;
+       }
+       else result.trailing = current;
+     }
+   }
+
    void IfcLoader::ParseLines() 
    {
-        uint32_t maxExpressId = 0;
-  			uint32_t currentIfcType = 0;
-  			uint32_t currentExpressID = 0;
-  			uint32_t currentTapeOffset = 0;
-  			while (!_tokenStream->IsAtEnd())
-  			{
-          IfcTokenType t = static_cast<IfcTokenType>(_tokenStream->Read<char>());
-  				switch (t)
-  				{
-  				case IfcTokenType::LINE_END:
-  				{
-            if (currentIfcType !=0)
-  					{
-  						IfcLine* l = new IfcLine();
-  						l->ifcType = currentIfcType;
-  						l->tapeOffset = currentTapeOffset;
-  						if(currentIfcType == webifc::schema::FILE_DESCRIPTION || currentIfcType == webifc::schema::FILE_NAME || currentIfcType == webifc::schema::FILE_SCHEMA )
-              {
-                _headerLines.push_back(l);
-              }
-              else if (currentExpressID != 0)
-              {
-                _ifcTypeToExpressID[currentIfcType].push_back(currentExpressID);
-                maxExpressId = std::max(maxExpressId, currentExpressID);
-                _lines.resize(maxExpressId,_nullLine);
-                _lines[currentExpressID-1]=l;
-                currentExpressID = 0;
-              }
-              currentIfcType = 0;
-  					}
-  					currentTapeOffset = _tokenStream->GetReadOffset();
-  					break;
-  				}
-  				case IfcTokenType::UNKNOWN:
-  				case IfcTokenType::EMPTY:
-  				case IfcTokenType::SET_BEGIN:
-  				case IfcTokenType::SET_END:
-  					break;
-  				case IfcTokenType::STRING:
-          case IfcTokenType::REAL:
-          case IfcTokenType::INTEGER:
-  				case IfcTokenType::ENUM:
-  				{
-  					auto size = _tokenStream->Read<uint16_t>();
-            _tokenStream->Forward(size);
-  					break;
-  				}
-  				case IfcTokenType::LABEL:
-  				{
-  					std::string_view s = _tokenStream->ReadString();
-  					if (currentIfcType == 0) currentIfcType = _schemaManager.IfcTypeToTypeCode(s);
-  					break;
-  				}
-  				case IfcTokenType::REF:
-  				{
-  					uint32_t ref = _tokenStream->Read<uint32_t>();
-  					if (currentExpressID == 0) currentExpressID = ref;
-  					break;
-  				}
-  				default:
-  					break;
-  				}
-  			}
+      // lines are discovered per chunk, concurrently when the whole tape is in memory, then merged in file order
+      const size_t chunkCount = _tokenStream->GetChunkCount();
+      std::vector<ChunkLines> chunkLines(chunkCount);
+      bool allLoaded = true;
+      for (size_t i = 0; i < chunkCount && allLoaded; i++) allLoaded = _tokenStream->IsChunkLoaded(i);
+      // concurrent chunks do not know the arguments of the line they start in, its references are collected in file order below
+      std::vector<ReferenceScan> referenceScans(allLoaded ? chunkCount : 1, ReferenceScan{0, 0, 0, !allLoaded});
+      const auto scan = [&](size_t i)
+      {
+        const std::string_view tokens = allLoaded ? _tokenStream->GetLoadedChunkTokens(i) : _tokenStream->GetChunkTokens(i);
+        ScanChunkLines(tokens, _tokenStream->GetChunkTokenRef(i), _schemaManager, chunkLines[i], _inverseIndex ? &referenceScans[allLoaded ? i : 0] : nullptr);
+      };
+      if (allLoaded) _tokenStream->GetWorkers().ParallelFor(chunkCount, scan);
+      else for (size_t i = 0; i < chunkCount; i++) scan(i);
+      if (_inverseIndex && allLoaded)
+      {
+        ReferenceScan openLine;
+        for (size_t i = 0; i < chunkCount; i++)
+        {
+          const std::string_view tokens = _tokenStream->GetLoadedChunkTokens(i);
+          ChunkLines leading;
+          ScanChunkLines(tokens.substr(0, chunkLines[i].hasLineEnd ? chunkLines[i].leadingEnd : tokens.size()), 0, _schemaManager, leading, &openLine);
+          chunkLines[i].references.insert(chunkLines[i].references.end(), leading.references.begin(), leading.references.end());
+          if (chunkLines[i].hasLineEnd) openLine = referenceScans[i];
+        }
+      }
+
+      uint32_t maxExpressId = 0;
+      for (auto &chunk : chunkLines) maxExpressId = std::max(maxExpressId, chunk.maxExpressID);
+      if (maxExpressId > 0) _linePages.resize(std::max<size_t>(_linePages.size(), ((maxExpressId - 1) >> LINE_PAGE_BITS) + 1), nullptr);
+      size_t lineCount = 0;
+      for (auto &chunk : chunkLines) lineCount += chunk.lines.size() + 1;
+      _pendingTypeLines.reserve(_pendingTypeLines.size() + lineCount);
+
+      const auto addLine = [&](const ParsedLine &line)
+      {
+        if (line.ifcType == 0) return;
+        if (line.ifcType == webifc::schema::FILE_DESCRIPTION || line.ifcType == webifc::schema::FILE_NAME || line.ifcType == webifc::schema::FILE_SCHEMA)
+        {
+          _headerLines.push_back({line.ifcType, line.tapeOffset});
+        }
+        else if (line.expressID != 0)
+        {
+          _pendingTypeLines.push_back({line.ifcType, line.expressID});
+          // lines completed across chunks are not part of the per chunk maximum
+          setLine(line.expressID, line.ifcType, line.tapeOffset);
+        }
+      };
+
+      ParsedLine open = {0, 0, 0};
+      for (auto &chunk : chunkLines)
+      {
+        if (open.expressID == 0) open.expressID = chunk.leadingExpressID;
+        if (open.ifcType == 0) open.ifcType = chunk.leadingIfcType;
+        if (!chunk.hasLineEnd) continue;
+        addLine(open);
+        for (auto &line : chunk.lines) addLine(line);
+        open = chunk.trailing;
+        std::vector<ParsedLine>().swap(chunk.lines);
+      }
+      freezeTypeIndex();
+
+      if (!_inverseIndex) return;
+      size_t referenceCount = 0;
+      for (auto &chunk : chunkLines) referenceCount += chunk.references.size();
+      std::vector<std::pair<uint32_t, InverseReference>> references;
+      references.reserve(referenceCount);
+      for (auto &chunk : chunkLines)
+      {
+        references.insert(references.end(), chunk.references.begin(), chunk.references.end());
+        std::vector<std::pair<uint32_t, InverseReference>>().swap(chunk.references);
+      }
+      std::vector<std::pair<uint32_t, uint32_t>> removals;
+      patchRows(_inversePages, removals, references, [](const InverseReference &, const uint32_t) { return false; });
+      _inverseBuilt = true;
    }
    
+   IfcLoader::LinePage * IfcLoader::linePage(const uint32_t expressID) const
+   {
+      const size_t page = (expressID - 1) >> LINE_PAGE_BITS;
+      if (expressID == 0 || page >= _linePages.size()) return nullptr;
+      return _linePages[page];
+   }
+
+   void IfcLoader::setLine(const uint32_t expressID, const uint32_t type, const uint32_t tapeOffset)
+   {
+      const size_t page = (expressID - 1) >> LINE_PAGE_BITS;
+      if (page >= _linePages.size()) _linePages.resize(page + 1, nullptr);
+      if (_linePages[page] == nullptr)
+      {
+        _linePages[page] = new LinePage();
+        std::fill_n(_linePages[page]->tapeOffset, LINE_PAGE_SIZE, NO_LINE);
+        std::fill_n(_linePages[page]->typeOrdinal, LINE_PAGE_SIZE, schema::SCHEMA_TYPE_COUNT);
+      }
+      if (!_offsetToExpressID.empty()) std::vector<std::pair<uint32_t, uint32_t>>().swap(_offsetToExpressID);
+      _linePages[page]->ifcType[(expressID - 1) & (LINE_PAGE_SIZE - 1)] = type;
+      _linePages[page]->typeOrdinal[(expressID - 1) & (LINE_PAGE_SIZE - 1)] = schema::IfcSchemaManager::IfcTypeCodeToOrdinal(type);
+      _linePages[page]->tapeOffset[(expressID - 1) & (LINE_PAGE_SIZE - 1)] = tapeOffset;
+      _maxExpressId = std::max(_maxExpressId, expressID);
+   }
+
+   uint32_t IfcLoader::lineOffset(const uint32_t expressID) const
+   {
+      const LinePage * page = linePage(expressID);
+      if (page == nullptr) return NO_LINE;
+      return page->tapeOffset[(expressID - 1) & (LINE_PAGE_SIZE - 1)];
+   }
+
    uint32_t IfcLoader::GetMaxExpressId() const
    { 
-      return _lines.size();
+      return _maxExpressId;
    }
    
    bool IfcLoader::IsValidExpressID(const uint32_t expressID) const
    {  
-   	 if (expressID == 0 || expressID > _lines.size() || _lines[expressID-1]==_nullLine) return false;
+   	 if (expressID == 0 || expressID > _maxExpressId || lineOffset(expressID)==NO_LINE) return false;
      else return true;
    }
    
    uint32_t IfcLoader::GetLineType(const uint32_t expressID) const
    { 
-      if (expressID == 0 || expressID > _lines.size()) {
+      if (expressID == 0 || expressID > _maxExpressId) {
         spdlog::error("[GetLineType()] Attempt to Access Invalid ExpressID {}", expressID);
         return 0;
       }
-      return _lines[expressID-1]->ifcType;
+      const LinePage * page = linePage(expressID);
+      if (page == nullptr) return 0;
+      return page->ifcType[(expressID - 1) & (LINE_PAGE_SIZE - 1)];
+   }
+
+   uint32_t IfcLoader::GetLineTypeOrdinal(const uint32_t expressID) const
+   { 
+      if (expressID == 0 || expressID > _maxExpressId) {
+        spdlog::error("[GetLineTypeOrdinal()] Attempt to Access Invalid ExpressID {}", expressID);
+        return schema::SCHEMA_TYPE_COUNT;
+      }
+      const LinePage * page = linePage(expressID);
+      if (page == nullptr) return schema::SCHEMA_TYPE_COUNT;
+      return page->typeOrdinal[(expressID - 1) & (LINE_PAGE_SIZE - 1)];
    }
    
    IfcLoader::~IfcLoader()
    { 
       delete _tokenStream;
-      for (size_t i=0; i < _lines.size();i++) {
-        if (_lines[i] == _nullLine) {
-          continue;
-        }
-        delete _lines[i];
-      }
-      for (size_t i=0; i < _headerLines.size();i++) delete _headerLines[i];
-      _lines.clear();
-      _headerLines.clear();
-      delete _nullLine;
+      delete _zipSource;
+      unmapFile();
+      for (LinePage * page : _linePages) delete page;
+      _linePages.clear();
+      for (auto * page : _inversePages) delete page;
+      for (auto * page : _referencePages) delete page;
    }
    
    void IfcLoader::MoveToLineArgument(const uint32_t expressID, const uint32_t argumentIndex) const
    { 
-     _tokenStream->MoveTo(_lines[expressID-1]->tapeOffset);
-     ArgumentOffset(argumentIndex);
+     MoveToIndexedArgument(expressID, argumentIndex);
    }
    
    void IfcLoader::MoveToHeaderLineArgument(const uint32_t lineID, const uint32_t argumentIndex) const
    { 
-     _tokenStream->MoveTo(_headerLines[lineID]->tapeOffset);
+     _tokenStream->MoveTo(_headerLines[lineID].tapeOffset);
    	 ArgumentOffset(argumentIndex);	
    }
    
    std::string_view IfcLoader::GetStringArgument() const
    { 
-   	 _tokenStream->Read<char>(); // string type
+   	 IfcTokenType t = static_cast<IfcTokenType>(_tokenStream->Read<char>());
+     if (t == IfcTokenType::TYPE_CODE) return schema::IfcSchemaManager::IfcTypeCodeToLabel(_tokenStream->Read<uint32_t>());
+     // numbers carry their binary value in front of the lexeme
+     if (t == IfcTokenType::REAL || t == IfcTokenType::INTEGER) _tokenStream->Forward(sizeof(double));
      return _tokenStream->ReadString();
    }
 
+   uint32_t IfcLoader::GetTypeCodeArgument() const
+   {
+     // labels the tokenizer did not resolve are hashed here
+     IfcTokenType t = static_cast<IfcTokenType>(_tokenStream->Read<char>());
+     if (t == IfcTokenType::TYPE_CODE) return _tokenStream->Read<uint32_t>();
+     return schema::IfcSchemaManager::IfcTypeToTypeCode(_tokenStream->ReadString());
+   }
+
+   void IfcLoader::PushLabel(const std::string_view label)
+   {
+     const uint32_t typeCode = schema::IfcSchemaManager::IfcTypeToTypeCode(label);
+     if (schema::IfcSchemaManager::IfcTypeCodeToLabel(typeCode) == label)
+     {
+       Push<uint8_t>(IfcTokenType::TYPE_CODE);
+       Push<uint32_t>(typeCode);
+       return;
+     }
+     Push<uint8_t>(IfcTokenType::LABEL);
+     Push<uint16_t>((uint16_t)label.size());
+     Push((void*)label.data(), label.size());
+   }
+
    std::string IfcLoader::GetDecodedStringArgument() const
    { 
       std::string_view str = GetStringArgument();
@@ -342,6 +1576,7 @@ namespace webifc::parsing {
 
    void IfcLoader::PushDouble(double input)
    {             
+      Push<double>(input);
       std::string numberString = std::format("{}", input);
       size_t eLoc = numberString.find_first_of('e');
       if (eLoc != std::string::npos) numberString[eLoc]='E';
@@ -353,6 +1588,7 @@ namespace webifc::parsing {
 
    void IfcLoader::PushInt(int input)
    {
+    Push<int64_t>(input);
     std::string numberString = std::to_string(input);
     uint16_t length = numberString.size();
     Push<uint16_t>((uint16_t)length);
@@ -361,8 +1597,15 @@ namespace webifc::parsing {
    
    double IfcLoader::GetDoubleArgument() const
    { 
-      std::string_view str = GetStringArgument();
-      double number_value;
+      IfcTokenType t = static_cast<IfcTokenType>(_tokenStream->Read<char>());
+      if (t == IfcTokenType::REAL || t == IfcTokenType::INTEGER)
+      {
+        double number_value = t == IfcTokenType::REAL ? _tokenStream->Read<double>() : static_cast<double>(_tokenStream->Read<int64_t>());
+        _tokenStream->Forward(_tokenStream->Read<uint16_t>());
+        return number_value;
+      }
+      std::string_view str = _tokenStream->ReadString();
+      double number_value = 0;
       fast_float::from_chars(str.data(), str.data() +str.size(), number_value);
       return number_value;
    }
@@ -374,7 +1617,14 @@ namespace webifc::parsing {
 
    long IfcLoader::GetIntArgument() const
    {
-       std::string_view str = GetStringArgument();
+       IfcTokenType t = static_cast<IfcTokenType>(_tokenStream->Read<char>());
+       if (t == IfcTokenType::REAL || t == IfcTokenType::INTEGER)
+       {
+         long number_value = t == IfcTokenType::INTEGER ? static_cast<long>(_tokenStream->Read<int64_t>()) : static_cast<long>(_tokenStream->Read<double>());
+         _tokenStream->Forward(_tokenStream->Read<uint16_t>());
+         return number_value;
+       }
+       std::string_view str = _tokenStream->ReadString();
        return std::stol(std::string(str));
    }
 
@@ -386,16 +1636,24 @@ namespace webifc::parsing {
 
   uint32_t IfcLoader::GetCurrentLineExpressID() const
   {
-      if (_lines.size()==0) return 0;
-      uint32_t pos = _tokenStream->GetReadOffset();
-      uint32_t prevLine = 0;
-      for (size_t i=0; i < _lines.size();i++)
+      if (_maxExpressId==0) return 0;
+      if (_offsetToExpressID.empty())
       {
-        if (_lines[i] == _nullLine) continue;
-        if (_lines[i]->tapeOffset > pos) break;
-        prevLine = i;
+        // built on first use, the line that starts last at or before the read position is the current one
+        for (size_t p=0; p < _linePages.size();p++)
+        {
+          if (_linePages[p] == nullptr) continue;
+          for (uint32_t i=0; i < LINE_PAGE_SIZE;i++)
+          {
+            if (_linePages[p]->tapeOffset[i] != NO_LINE) _offsetToExpressID.push_back({_linePages[p]->tapeOffset[i], static_cast<uint32_t>((p << LINE_PAGE_BITS) + i + 1)});
+          }
+        }
+        std::sort(_offsetToExpressID.begin(), _offsetToExpressID.end());
       }
-      return prevLine+1;
+      uint32_t pos = _tokenStream->GetReadOffset();
+      auto it = std::upper_bound(_offsetToExpressID.begin(), _offsetToExpressID.end(), std::make_pair(pos, UINT32_MAX));
+      if (it == _offsetToExpressID.begin()) return 0;
+      return std::prev(it)->second;
   }
    
    uint32_t IfcLoader::GetRefArgument() const
@@ -420,40 +1678,211 @@ namespace webifc::parsing {
 		return GetDoubleArgument();
 	}
 
+  void IfcLoader::lineReferences(const uint32_t expressID, std::vector<std::pair<uint32_t, InverseReference>> &references) const
+  {
+      ReferenceScan scan;
+      scan.expressID = expressID;
+      _tokenStream->MoveTo(lineOffset(expressID));
+      while (!_tokenStream->IsAtEnd())
+      {
+        IfcTokenType t = static_cast<IfcTokenType>(_tokenStream->Read<char>());
+        uint32_t ref = 0;
+        switch (t)
+        {
+          case IfcTokenType::INTEGER:
+          case IfcTokenType::REAL:
+            _tokenStream->Forward(sizeof(double));
+            [[fallthrough]];
+          case IfcTokenType::STRING:
+          case IfcTokenType::ENUM:
+          case IfcTokenType::LABEL:
+            _tokenStream->Forward(_tokenStream->Read<uint16_t>());
+            break;
+          case IfcTokenType::REF:
+            ref = _tokenStream->Read<uint32_t>();
+            break;
+          case IfcTokenType::TYPE_CODE:
+            _tokenStream->Read<uint32_t>();
+            break;
+          default:
+            break;
+        }
+        scan.Token(t, ref, references);
+        if (t == IfcTokenType::LINE_END) return;
+      }
+  }
+
   void IfcLoader::RemoveLine(const uint32_t expressID)
   {
-      _lines[expressID-1]->ifcType = 0;
+      ForgetArgumentOffsets(expressID);
+      queueIndexEdit(expressID);
+      _editedLines.push_back(expressID);
+      LinePage * page = linePage(expressID);
+      if (page == nullptr) return;
+      if (page->ifcType[(expressID - 1) & (LINE_PAGE_SIZE - 1)] != 0) addTapeGarbage(lineOffset(expressID));
+      page->ifcType[(expressID - 1) & (LINE_PAGE_SIZE - 1)] = 0;
+      page->typeOrdinal[(expressID - 1) & (LINE_PAGE_SIZE - 1)] = schema::SCHEMA_TYPE_COUNT;
+      stepCompaction();
   }
 
   void IfcLoader::ExtendLineStorage(uint32_t lineStorageSize)
   {
-    _lines.reserve(_lines.size()+lineStorageSize);
+    _linePages.reserve(((_maxExpressId + lineStorageSize) >> LINE_PAGE_BITS) + 1);
   }
   
   void IfcLoader::UpdateLineTape(const uint32_t expressID, const uint32_t type, const uint32_t start)
   {
-    if (expressID > _lines.size())
+    ForgetArgumentOffsets(expressID);
+    queueIndexEdit(expressID);
+    _editedLines.push_back(expressID);
+    if (lineOffset(expressID) == NO_LINE)
   	{
-      // create line object
-  		IfcLine * line = new IfcLine();
-  		// fill line data
-  		line->ifcType = type;
-      line->tapeOffset = start;
-      //place in vector
-      _lines.resize(expressID,_nullLine);
-      _lines[expressID-1]=line;
-  		_ifcTypeToExpressID[type].push_back(expressID);
-
-  	} else _lines[expressID-1]->tapeOffset = start;
+      // new line, gaps below the highest expressID are filled in as well
+  		setLine(expressID, type, start);
+  		_pendingTypeLines.push_back({type, expressID});
+  	}
+    else
+    {
+      if (GetLineType(expressID) != 0) addTapeGarbage(lineOffset(expressID));
+      setLine(expressID, GetLineType(expressID), start);
+    }
+    stepCompaction();
+  }
+
+  size_t IfcLoader::lineSize(const uint32_t tapeOffset) const
+  {
+    _tokenStream->MoveTo(tapeOffset);
+    while (!_tokenStream->IsAtEnd())
+    {
+      IfcTokenType t = static_cast<IfcTokenType>(_tokenStream->Read<char>());
+      switch (t)
+      {
+        case IfcTokenType::INTEGER:
+        case IfcTokenType::REAL:
+          _tokenStream->Forward(sizeof(double));
+          [[fallthrough]];
+        case IfcTokenType::STRING:
+        case IfcTokenType::ENUM:
+        case IfcTokenType::LABEL:
+          _tokenStream->Forward(_tokenStream->Read<uint16_t>());
+          break;
+        case IfcTokenType::REF:
+        case IfcTokenType::TYPE_CODE:
+          _tokenStream->Forward(sizeof(uint32_t));
+          break;
+        default:
+          break;
+      }
+      if (t == IfcTokenType::LINE_END) break;
+    }
+    return _tokenStream->GetReadOffset() - tapeOffset;
+  }
+
+  void IfcLoader::addTapeGarbage(const uint32_t tapeOffset)
+  {
+    // only pushed tokens count, source chunks are reloaded as they are anyway. Neither do lines a running compaction drops
+    if (tapeOffset < _tokenStream->GetPushedTokenRef() || (_compacting && tapeOffset < _compactEnd)) return;
+    _tapeGarbage += lineSize(tapeOffset);
+  }
+
+  size_t IfcLoader::moveLine(uint32_t &tapeOffset)
+  {
+    const size_t size = lineSize(tapeOffset);
+    const uint32_t start = _tokenStream->GetTotalSize();
+    _tokenStream->CopyTokens(tapeOffset, tapeOffset + size);
+    tapeOffset = start;
+    return size;
+  }
+
+  void IfcLoader::stepCompaction()
+  {
+    // a compaction must free at least a chunk to be worth it
+    if (!_compacting)
+    {
+      if (_tapeGarbageRatio == 0 || _tapeGarbage < _tapeSize) return;
+      if (_tapeGarbage * 100 < (_tokenStream->GetTotalSize() - _tokenStream->GetPushedTokenRef()) * _tapeGarbageRatio) return;
+    }
+    CompactTape(COMPACT_STEP_SIZE);
+  }
+
+  void IfcLoader::CompactTape()
+  {
+    CompactTape(SIZE_MAX);
+  }
+
+  bool IfcLoader::CompactTape(const size_t budget)
+  {
+    if (!_compacting)
+    {
+      _compactStart = _tokenStream->GetPushedTokenRef();
+      _compactEnd = _tokenStream->GetTotalSize();
+      if (_compactStart == _compactEnd) return true;
+      // the copies and all tokens pushed until the compaction is done go behind the compacted ones
+      _tokenStream->CloseChunk();
+      _compacting = true;
+      _compactCursor = 1;
+      _compactRemoved = NO_LINE;
+      _tapeGarbage = 0;
+      for (IfcLine &line : _headerLines)
+      {
+        if (line.tapeOffset >= _compactStart) moveLine(line.tapeOffset);
+      }
+    }
+    size_t copied = 0;
+    for (; _compactCursor <= _maxExpressId && copied < budget; _compactCursor++)
+    {
+      LinePage * page = linePage(_compactCursor);
+      if (page == nullptr)
+      {
+        // on to the start of the next page
+        _compactCursor = (((_compactCursor - 1) >> LINE_PAGE_BITS) + 1) << LINE_PAGE_BITS;
+        continue;
+      }
+      const uint32_t slot = (_compactCursor - 1) & (LINE_PAGE_SIZE - 1);
+      uint32_t &tapeOffset = page->tapeOffset[slot];
+      if (tapeOffset == NO_LINE || tapeOffset < _compactStart || tapeOffset >= _compactEnd) continue;
+      ForgetArgumentOffsets(_compactCursor);
+      if (page->ifcType[slot] != 0)
+      {
+        copied += moveLine(tapeOffset);
+        continue;
+      }
+      // removed lines keep their place in the line table but not their tokens, they all point at one empty line
+      if (_compactRemoved == NO_LINE)
+      {
+        _compactRemoved = _tokenStream->GetTotalSize();
+        _tokenStream->Push<uint8_t>(IfcTokenType::LINE_END);
+      }
+      tapeOffset = _compactRemoved;
+    }
+    if (!_offsetToExpressID.empty()) std::vector<std::pair<uint32_t, uint32_t>>().swap(_offsetToExpressID);
+    if (_compactCursor <= _maxExpressId) return false;
+
+    // nothing refers to the compacted tokens any more, the ones behind them move down
+    const uint32_t dropped = _compactEnd - _compactStart;
+    _tokenStream->DropTokens(_compactStart, _compactEnd);
+    for (LinePage *page : _linePages)
+    {
+      if (page == nullptr) continue;
+      for (uint32_t &tapeOffset : page->tapeOffset)
+      {
+        if (tapeOffset != NO_LINE && tapeOffset >= _compactEnd) tapeOffset -= dropped;
+      }
+    }
+    for (IfcLine &line : _headerLines)
+    {
+      if (line.tapeOffset >= _compactEnd) line.tapeOffset -= dropped;
+    }
+    _argumentOffsets.clear();
+    _argumentOffsetsSize = 0;
+    _compacting = false;
+    return true;
   }
 
   void IfcLoader::AddHeaderLineTape(const uint32_t type, const uint32_t start)
   {
-    
-      IfcLine *l = new IfcLine();
-      l->ifcType = type;
-      l->tapeOffset = start;
-      _headerLines.push_back(l);
+      _headerEdited = true;
+      _headerLines.push_back({type, start});
   }
   
   IfcTokenType IfcLoader::GetTokenType(uint32_t tapeOffset) const
@@ -482,7 +1911,8 @@ namespace webifc::parsing {
    
    IfcTokenType IfcLoader::GetTokenType() const
    { 
-     return static_cast<IfcTokenType>(_tokenStream->Read<char>());
+     IfcTokenType t = static_cast<IfcTokenType>(_tokenStream->Read<char>());
+     return t == IfcTokenType::TYPE_CODE ? IfcTokenType::LABEL : t;
    }
 
    void IfcLoader::Push(void *v, uint64_t size)
@@ -494,6 +1924,11 @@ namespace webifc::parsing {
    {
      return _tokenStream->GetTotalSize();
    }
+
+   const TapeCacheStats &IfcLoader::GetTapeCacheStats() const
+   {
+     return _tokenStream->GetCacheStats();
+   }
      
    const std::vector<uint32_t> IfcLoader::GetSetArgument() const
    { 
@@ -517,12 +1952,13 @@ namespace webifc::parsing {
        {
          tapeOffsets.push_back(offset);
 
-         if (t == IfcTokenType::REF)
+         if (t == IfcTokenType::REF || t == IfcTokenType::TYPE_CODE)
          {
            _tokenStream->Read<uint32_t>();
          }
          else if (t == IfcTokenType::STRING || t == IfcTokenType::INTEGER || t == IfcTokenType::REAL || t == IfcTokenType::LABEL || t == IfcTokenType::ENUM)
          {
+           if (t == IfcTokenType::INTEGER || t == IfcTokenType::REAL) _tokenStream->Forward(sizeof(double));
            uint16_t length = _tokenStream->Read<uint16_t>();
            _tokenStream->Forward(length);
          }
@@ -571,12 +2007,13 @@ namespace webifc::parsing {
      		{
      			tempSet.push_back(offset);
 
-     			if (t == IfcTokenType::REF)
+     			if (t == IfcTokenType::REF || t == IfcTokenType::TYPE_CODE)
      			{
      				_tokenStream->Read<uint32_t>();
      			}
      			else if (t == IfcTokenType::STRING || t == IfcTokenType::INTEGER || t == IfcTokenType::REAL || t == IfcTokenType::LABEL || t == IfcTokenType::ENUM)
      			{
+     				if (t == IfcTokenType::INTEGER || t == IfcTokenType::REAL) _tokenStream->Forward(sizeof(double));
      				uint16_t length = _tokenStream->Read<uint16_t>();
      				_tokenStream->Forward(length);
      			}
@@ -597,13 +2034,19 @@ namespace webifc::parsing {
     
    void IfcLoader::ArgumentOffset(const uint32_t argumentIndex) const
    {
+   	ArgumentOffset(argumentIndex, 0, nullptr);
+   }
+
+   void IfcLoader::ArgumentOffset(const uint32_t argumentIndex, uint32_t setDepth, std::vector<uint32_t> *offsets) const
+   {
+   	// setDepth is 1 when starting at an argument inside the argument list, whose offset is then already known
    	uint32_t movedOver = 0;
-   	uint32_t setDepth = 0;
    	while (true)
    	{
    		if (setDepth == 1)
    		{
    			movedOver++;
+   			if (offsets != nullptr && (offsets->empty() || movedOver > 1)) offsets->push_back(_tokenStream->GetReadOffset());
 
    			if (movedOver-1 == argumentIndex)
    			{
@@ -633,17 +2076,20 @@ namespace webifc::parsing {
    				return;
    			}
    			break;
+      case IfcTokenType::INTEGER:
+      case IfcTokenType::REAL:
+   			_tokenStream->Forward(sizeof(double));
+   			[[fallthrough]];
    		case IfcTokenType::STRING:
    		case IfcTokenType::ENUM:
    		case IfcTokenType::LABEL:
-      case IfcTokenType::INTEGER:
-      case IfcTokenType::REAL:
    		{
    			uint16_t length = _tokenStream->Read<uint16_t>();
    			_tokenStream->Forward(length);
    			break;
    		}
    		case IfcTokenType::REF:
+   		case IfcTokenType::TYPE_CODE:
    		{
    			_tokenStream->Read<uint32_t>();
    			break;
@@ -656,8 +2102,57 @@ namespace webifc::parsing {
    
    void IfcLoader::MoveToArgumentOffset(const uint32_t expressID, const uint32_t argumentIndex) const
    {
-    _tokenStream->MoveTo(_lines[expressID-1]->tapeOffset);
-   	ArgumentOffset(argumentIndex);
+   	MoveToIndexedArgument(expressID, argumentIndex);
+   }
+
+   void IfcLoader::MoveToIndexedArgument(const uint32_t expressID, const uint32_t argumentIndex) const
+   {
+   	auto it = _argumentOffsets.find(expressID);
+   	if (it != _argumentOffsets.end() && argumentIndex < it->second.size())
+   	{
+   		_tokenStream->MoveTo(it->second[argumentIndex]);
+   		return;
+   	}
+   	if (_argumentIndexBudget == 0)
+   	{
+   		_tokenStream->MoveTo(lineOffset(expressID));
+   		ArgumentOffset(argumentIndex);
+   		return;
+   	}
+   	if (it == _argumentOffsets.end())
+   	{
+   		// once the budget is used up the index starts over, so it keeps the lines that are in use now
+   		if (_argumentOffsetsSize >= _argumentIndexBudget)
+   		{
+   			_argumentOffsets.clear();
+   			_argumentOffsetsSize = 0;
+   		}
+   		it = _argumentOffsets.emplace(expressID, std::vector<uint32_t>()).first;
+   		_argumentOffsetsSize += ARGUMENT_INDEX_ENTRY_SIZE;
+   	}
+
+   	// continue the walk from the last argument already indexed
+   	std::vector<uint32_t> &offsets = it->second;
+   	const size_t previousCapacity = offsets.capacity();
+   	if (offsets.empty())
+   	{
+   		_tokenStream->MoveTo(lineOffset(expressID));
+   		ArgumentOffset(argumentIndex, 0, &offsets);
+   	}
+   	else
+   	{
+   		_tokenStream->MoveTo(offsets.back());
+   		ArgumentOffset(argumentIndex - (offsets.size() - 1), 1, &offsets);
+   	}
+   	_argumentOffsetsSize += (offsets.capacity() - previousCapacity) * sizeof(uint32_t);
+   }
+
+   void IfcLoader::ForgetArgumentOffsets(const uint32_t expressID)
+   {
+   	auto it = _argumentOffsets.find(expressID);
+   	if (it == _argumentOffsets.end()) return;
+   	_argumentOffsetsSize -= ARGUMENT_INDEX_ENTRY_SIZE + it->second.capacity() * sizeof(uint32_t);
+   	_argumentOffsets.erase(it);
    }
    
    void IfcLoader::StepBack() const {
@@ -677,30 +2172,32 @@ namespace webifc::parsing {
 
     std::vector<uint32_t> IfcLoader::GetAllLines() const {
       std::vector<uint32_t> expressIDs;
-      auto numLines = GetMaxExpressId();
-      for (uint32_t i = 1; i <= numLines; i++)
+      for (size_t p = 0; p < _linePages.size(); p++)
       {
-          if (!IsValidExpressID(i)) continue;
-          expressIDs.push_back(i);
+          if (_linePages[p] == nullptr) continue;
+          for (uint32_t i = 0; i < LINE_PAGE_SIZE; i++)
+          {
+              if (_linePages[p]->tapeOffset[i] != NO_LINE) expressIDs.push_back((p << LINE_PAGE_BITS) + i + 1);
+          }
       }
       return expressIDs;
     }
 
     uint32_t IfcLoader::GetNextExpressID(uint32_t expressId) const {
-      uint32_t currentId = expressId;
-      bool cont = true;
-      uint32_t maxId = GetMaxExpressId();
-
-      while(cont)
+      // returns GetMaxExpressId() + 1 when there are no more lines after expressId
+      uint32_t currentId = expressId + 1;
+      while (currentId <= _maxExpressId)
       {
-          if(currentId > maxId)
+          const LinePage * page = linePage(currentId);
+          if (page == nullptr)
           {
-              cont = false;
+              // jump to the start of the next page
+              currentId = ((((currentId - 1) >> LINE_PAGE_BITS) + 1) << LINE_PAGE_BITS) + 1;
               continue;
           }
+          if (page->tapeOffset[(currentId - 1) & (LINE_PAGE_SIZE - 1)] != NO_LINE) return currentId;
           currentId++;
-          cont = !(IsValidExpressID(currentId));
       }
-      return currentId;
+      return expressId > _maxExpressId ? expressId : _maxExpressId + 1;
     }
 }
\ No newline at end of file
@@ -9,33 +9,86 @@
 #include <istream>
 #include <set>
 #include <cstdint>
+#include <compare>
 #include <string_view>
+#include <string>
+#include <span>
 
 #include "IfcTokenStream.h"
+#include "IfcZipSource.h"
 #include "../schema/IfcSchemaManager.h"
 
 namespace webifc::parsing
 {
+  // how a loader keeps its tape and indexes, the defaults are those of manager::LoaderSettings
+  struct IfcLoaderSettings
+  {
+    uint32_t TAPE_SIZE = 67108864;
+    uint32_t MEMORY_LIMIT = 2147483648;
+    uint32_t LINEWRITER_BUFFER = 10000;
+    uint32_t ARGUMENT_INDEX_BUDGET = 16777216;
+    uint32_t TAPE_SPILL_LIMIT = 268435456;
+    bool INVERSE_INDEX = false;
+    uint32_t TAPE_GARBAGE_RATIO = 50;
+    // threads of a loader that is not given a pool of workers to share
+    uint32_t THREADS = 1;
+  };
   
 	class IfcLoader {
   
     public:
-      IfcLoader(uint32_t tapeSize, uint32_t memoryLimit,uint32_t lineWriterBuffer, const schema::IfcSchemaManager &schemaManager);  
+      // a line referring to another one, with the top level argument the reference is in
+      struct InverseReference
+      {
+        uint32_t expressID;
+        uint32_t argument;
+        auto operator<=>(const InverseReference &) const = default;
+      };
+      // loaders given the same workers share them, otherwise each starts settings.THREADS - 1 workers of its own
+      IfcLoader(const IfcLoaderSettings &settings, const schema::IfcSchemaManager &schemaManager, WorkerPool *workers = nullptr);  
       ~IfcLoader();
       const std::vector<uint32_t> GetHeaderLinesWithType(const uint32_t type) const;
-      void LoadFile(const std::function<uint32_t(char *, size_t, size_t)> &requestData);
-      void LoadFile(std::istream &requestData);
+      // false when the data cannot be read as a model, such as a zip container without a readable .ifc file
+      bool LoadFile(const std::function<uint32_t(char *, size_t, size_t)> &requestData);
+      bool LoadFile(std::istream &requestData);
+      bool LoadFile(const char *data, const size_t size);
+      bool LoadFile(const std::string &path);
       void SaveFile(const std::function<void(char *, size_t)> &outputData) const;
       void SaveFile(std::ostream &outputData) const;
-      const std::vector<uint32_t> GetExpressIDsWithType(const uint32_t type) const;
+      // copies the lines not edited since loading from the source text and only writes the edited ones again
+      void SaveFileIncremental(const std::function<void(char *, size_t)> &outputData) const;
+      void SaveFileIncremental(std::ostream &outputData) const;
+      // writes the given lines and everything they refer to as a file of its own, optionally numbered from 1 in the order of their expressIDs
+      void SaveSubset(const std::vector<uint32_t> &expressIDs, const std::function<void(char *, size_t)> &outputData, const bool renumber) const;
+      void SaveSubset(const std::vector<uint32_t> &expressIDs, std::ostream &outputData, const bool renumber) const;
+      void SaveSnapshot(std::ostream &outputData) const;
+      bool LoadSnapshot(const char *data, const size_t size);
+      bool LoadSnapshot(const std::string &path);
+      std::span<const uint32_t> GetExpressIDsWithType(const uint32_t type) const;
+      // the lines of a type and of all its subtypes in the schema of the model, sorted by expressID
+      std::span<const uint32_t> GetExpressIDsWithTypeAndSubtypes(const uint32_t type) const;
+      // the lines referring to expressID directly or as a member of a set argument, sorted by expressID
+      // always empty unless the loader keeps the inverse index
+      std::span<const InverseReference> GetInverseReferences(const uint32_t expressID) const;
+      bool HasInverseIndex() const;
+      // the lines of the given types holding expressID in the argument at position, directly or as a member of a set given there, listed
+      // once for each time they hold it and in the order of the types and then of GetExpressIDsWithType. Only the first one unless all
+      std::vector<uint32_t> GetInversePropertyForItem(const uint32_t expressID, const std::vector<uint32_t> &types, const uint32_t position, const bool all) const;
+      // the lines expressID refers to anywhere in its arguments, sorted. Built from the tape the first time it is needed
+      std::span<const uint32_t> GetReferences(const uint32_t expressID) const;
+      // the given lines and all lines they refer to, directly or indirectly, sorted by expressID
+      std::vector<uint32_t> GetReferenceClosure(const std::vector<uint32_t> &expressIDs) const;
       uint32_t GetMaxExpressId() const;
       bool IsValidExpressID(const uint32_t expressID) const;
       uint32_t GetLineType(const uint32_t expressID) const;
+      // dense ordinal of the line type, see IfcSchemaManager::IfcTypeCodeToOrdinal
+      uint32_t GetLineTypeOrdinal(const uint32_t expressID) const;
       bool IsAtEnd() const;
       void MoveToLineArgument(const uint32_t expressID, const uint32_t argumentIndex) const;
       void MoveToHeaderLineArgument(const uint32_t lineID, const uint32_t argumentIndex) const;
       std::string_view GetStringArgument() const;
       std::string GetDecodedStringArgument() const;
+      uint32_t GetTypeCodeArgument() const;
       double GetDoubleArgument() const;
       long GetIntArgument() const;
       long GetIntArgument(const uint32_t tapeOffset) const;
@@ -55,14 +108,22 @@ namespace webifc::parsing
       IFC_SCHEMA GetSchema() const;
       void Push(void *v, const uint64_t size);
       uint64_t GetTotalSize() const;
+      const TapeCacheStats &GetTapeCacheStats() const;
       void UpdateLineTape(const uint32_t expressID, const uint32_t type, const uint32_t start);
       void AddHeaderLineTape(const uint32_t type, const uint32_t start);
       uint32_t GetCurrentLineExpressID() const;
       void RemoveLine(const uint32_t expressID);
       void PushDouble(double input);
       void PushInt(int input);
+      void PushLabel(const std::string_view label);
       void ExtendLineStorage(uint32_t lineStorageSize);
       uint32_t GetNextExpressID(uint32_t expressId) const;
+      // copies the live lines among the pushed tokens into fresh chunks and drops the chunks that only held them and the old
+      // versions of edited or removed lines. Starts on its own once the dead bytes pass tapeGarbageRatio percent of the pushed
+      // tokens and then advances a step with every edit, CompactTape finishes it at once
+      void CompactTape();
+      // advances the compaction by about budget copied bytes, starting one if none is running. True once it is done
+      bool CompactTape(const size_t budget);
       template <typename T> void Push(T input)
       {
         _tokenStream->Push(input);
@@ -74,15 +135,95 @@ namespace webifc::parsing
         uint32_t ifcType;
         uint32_t tapeOffset;
       };
+      const uint32_t _tapeSize;
       const uint32_t _lineWriterBuffer;
+      const uint32_t _argumentIndexBudget;
+      const bool _inverseIndex;
+      const uint32_t _tapeGarbageRatio;
       const schema::IfcSchemaManager &_schemaManager;
       IfcTokenStream * _tokenStream;
-      IfcLine * _nullLine;
-      std::vector<IfcLine*> _lines;
-      std::vector<IfcLine*> _headerLines;
-      std::unordered_map<uint32_t, std::vector<uint32_t>> _ifcTypeToExpressID;
+      IfcZipSource * _zipSource = nullptr;
+      static constexpr uint32_t LINE_PAGE_BITS = 10;
+      static constexpr uint32_t LINE_PAGE_SIZE = 1 << LINE_PAGE_BITS;
+      struct LinePage
+      {
+        uint32_t ifcType[LINE_PAGE_SIZE];
+        uint32_t tapeOffset[LINE_PAGE_SIZE];
+        uint16_t typeOrdinal[LINE_PAGE_SIZE];
+      };
+      // the line table, in pages of expressIDs that are only allocated once they hold a line, missing lines have the offset NO_LINE
+      std::vector<LinePage*> _linePages;
+      uint32_t _maxExpressId = 0;
+      std::vector<IfcLine> _headerLines;
+      // expressIDs by type in compressed sparse row form: the lines of _types[i] are _typeExpressIDs[_typeOffsets[i], _typeOffsets[i+1])
+      // lines added since the last freeze wait in _pendingTypeLines as (type, expressID)
+      mutable std::vector<uint32_t> _types;
+      mutable std::vector<uint32_t> _typeOffsets;
+      mutable std::vector<uint32_t> _typeExpressIDs;
+      mutable std::vector<std::pair<uint32_t, uint32_t>> _pendingTypeLines;
+      // merged lines of a type and its subtypes, dropped whenever the type index changes
+      mutable std::unordered_map<uint32_t, std::vector<uint32_t>> _subtypeExpressIDs;
+      // the rows of an index for the expressIDs of one line page in compressed sparse row form: the row of the i-th expressID
+      // of the page is values[offsets[i], offsets[i+1])
+      template <typename T> struct RowPage
+      {
+        uint32_t offsets[LINE_PAGE_SIZE + 1];
+        std::vector<T> values;
+      };
+      // references by referenced expressID, in pages alongside the line pages so that an edit only rebuilds the pages of the rows it touches.
+      // Lines written or removed since the last freeze wait in _pendingInverseLines and the references their old versions held in
+      // _pendingInverseRemovals as (referenced, referring). Until _inverseBuilt the index is built from all lines when first needed
+      mutable std::vector<RowPage<InverseReference>*> _inversePages;
+      mutable bool _inverseBuilt = false;
+      mutable std::vector<uint32_t> _pendingInverseLines;
+      mutable std::vector<std::pair<uint32_t, uint32_t>> _pendingInverseRemovals;
+      // the transpose of the above by referring expressID, kept the same way but listing every line referred to once and only built on demand
+      mutable std::vector<RowPage<uint32_t>*> _referencePages;
+      mutable bool _referencesBuilt = false;
+      mutable std::vector<uint32_t> _pendingReferenceLines;
+      // lines written or removed since loading, in the order of the edits
+      std::vector<uint32_t> _editedLines;
+      bool _headerEdited = false;
+      // (tapeOffset, expressID) of all lines sorted by offset, built when first needed
+      mutable std::vector<std::pair<uint32_t, uint32_t>> _offsetToExpressID;
+      // tape offsets of the top level arguments of recently accessed lines, filled as far as they have been walked
+      mutable std::unordered_map<uint32_t, std::vector<uint32_t>> _argumentOffsets;
+      mutable size_t _argumentOffsetsSize = 0;
+      // dead bytes among the pushed tokens. While the tape is compacted, the live lines in [_compactStart, _compactEnd) are
+      // copied behind it in the order of their expressIDs from _compactCursor on
+      size_t _tapeGarbage = 0;
+      bool _compacting = false;
+      size_t _compactStart = 0;
+      size_t _compactEnd = 0;
+      uint32_t _compactCursor = 0;
+      uint32_t _compactRemoved = 0;
+      void * _mappedFile = nullptr;
+      size_t _mappedFileSize = 0;
       void ParseLines();
-      void ArgumentOffset(const uint32_t argumentIndex) const;      
+      void saveLines(const std::function<void(char *, size_t)> &outputData, const std::vector<uint32_t> *expressIDs, const std::vector<uint32_t> &renumbering) const;
+      bool loadZip(const std::function<uint32_t(char *, size_t, size_t)> &requestData);
+      bool mapFile(const std::string &path);
+      void unmapFile();
+      LinePage * linePage(const uint32_t expressID) const;
+      void setLine(const uint32_t expressID, const uint32_t type, const uint32_t tapeOffset);
+      uint32_t lineOffset(const uint32_t expressID) const;
+      void freezeTypeIndex() const;
+      void freezeInverseIndex() const;
+      void freezeReferenceIndex() const;
+      template <typename T> static std::span<const T> indexRow(const std::vector<RowPage<T>*> &pages, const uint32_t expressID);
+      template <typename T, typename Matches> void patchRows(std::vector<RowPage<T>*> &pages, std::vector<std::pair<uint32_t, uint32_t>> &removals, std::vector<std::pair<uint32_t, T>> &additions, Matches matches) const;
+      void queueIndexEdit(const uint32_t expressID);
+      void lineReferences(const uint32_t expressID, std::vector<std::pair<uint32_t, InverseReference>> &references) const;
+      uint32_t argumentReferences(const uint32_t line, const uint32_t position, const uint32_t expressID, const bool all) const;
+      void ArgumentOffset(const uint32_t argumentIndex) const;
+      void ArgumentOffset(const uint32_t argumentIndex, uint32_t setDepth, std::vector<uint32_t> *offsets) const;
+      void MoveToIndexedArgument(const uint32_t expressID, const uint32_t argumentIndex) const;
+      void ForgetArgumentOffsets(const uint32_t expressID);
+      size_t lineSize(const uint32_t tapeOffset) const;
+      void addTapeGarbage(const uint32_t tapeOffset);
+      size_t moveLine(uint32_t &tapeOffset);
+      void stepCompaction();
+      
       
 	};
 }
\ No newline at end of file
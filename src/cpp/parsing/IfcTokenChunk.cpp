@@ -3,7 +3,14 @@
  * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
  
 
+#include <charconv>
+#include <algorithm>
+#include <fast_float/fast_float.h>
+#include <spdlog/spdlog.h>
 #include "IfcTokenStream.h"
+#include "../schema/IfcSchemaManager.h"
+#include "token_scan.h"
+#include "tape_codec.h"
 
 namespace webifc::parsing
 {
@@ -16,14 +23,81 @@ namespace webifc::parsing
     if (_fileStream!=nullptr) Load();
   }
 
+  IfcTokenStream::IfcTokenChunk::IfcTokenChunk(const size_t chunkSize, const size_t startRef, const size_t fileStartRef, const size_t fileEndRef, IfcFileStream *fileStream) :  _startRef(startRef), _fileStartRef(fileStartRef), _fileEndRef(fileEndRef), _chunkSize(chunkSize), _fileStream(fileStream)
+  {
+    // covers exactly [fileStartRef, fileEndRef) of the source, however many tokens that takes
+    _chunkData = nullptr;
+    _loaded=true;
+    _currentSize = 0;
+    Load();
+  }
+
+  IfcTokenStream::IfcTokenChunk::IfcTokenChunk(const size_t startRef, const size_t fileStartRef, const size_t fileEndRef, IfcFileStream *fileStream, const bool tokens) :  _startRef(startRef), _fileStartRef(fileStartRef), _fileEndRef(fileEndRef), _chunkSize(fileEndRef - fileStartRef), _fileStream(fileStream), _tokens(tokens)
+  {
+    // starts out evicted, the tokens are only copied in from the source once they are read
+    _chunkData = nullptr;
+    _loaded=false;
+    _currentSize = _chunkSize;
+  }
+
+  void IfcTokenStream::IfcTokenChunk::Relocate(const size_t startRef, IfcFileStream *fileStream)
+  {
+    _startRef = startRef;
+    _fileStream = fileStream;
+  }
+
+  void IfcTokenStream::IfcTokenChunk::Append(IfcTokenChunk &other)
+  {
+    // other must directly follow this chunk in the source, only the length of its text counts so it may have been read from a window of it
+    if (other._currentSize > 0) Push(other._chunkData, other._currentSize);
+    _fileEndRef = std::max(_fileEndRef, _fileStartRef) + other.SourceSize();
+  }
+
   bool IfcTokenStream::IfcTokenChunk::Clear(bool force)
   {
     if (_fileStream==nullptr && !force) return false; 
     if (_chunkData!=nullptr) delete[] _chunkData;
+    _chunkData = nullptr;
     _loaded=false;
+    if (force) DropSpill();
     return true;
   }
 
+  size_t IfcTokenStream::IfcTokenChunk::Spill()
+  {
+    // unloads the chunk but keeps its tokens compressed, so loading it again needs no source access
+    if (_fileStream==nullptr || !_loaded) return 0;
+    if (_chunkData!=nullptr && _currentSize > 0) _spill = codec::Compress(_chunkData, _currentSize);
+    _spill.shrink_to_fit();
+    Clear();
+    return _spill.size();
+  }
+
+  size_t IfcTokenStream::IfcTokenChunk::DropSpill()
+  {
+    const size_t size = _spill.size();
+    std::vector<uint8_t>().swap(_spill);
+    return size;
+  }
+
+  size_t IfcTokenStream::IfcTokenChunk::SpillSize()
+  {
+    return _spill.size();
+  }
+
+  void IfcTokenStream::IfcTokenChunk::Adopt(IfcTokenChunk &other)
+  {
+    // takes over the tokens other loaded for this chunk
+    if (_chunkData!=nullptr) delete[] _chunkData;
+    _chunkData = other._chunkData;
+    _currentSize = other._currentSize;
+    _chunkSize = other._chunkSize;
+    _loaded = true;
+    other._chunkData = nullptr;
+    other._loaded = false;
+    DropSpill();
+  }
+
   bool IfcTokenStream::IfcTokenChunk::Clear()
   {
     return Clear(false);
@@ -34,6 +108,11 @@ namespace webifc::parsing
     return _startRef;
   }
   
+  size_t IfcTokenStream::IfcTokenChunk::SourceSize()
+  {
+    return _fileEndRef - _fileStartRef;
+  }
+
   size_t IfcTokenStream::IfcTokenChunk::TokenSize()
   {
     return _currentSize;
@@ -44,6 +123,11 @@ namespace webifc::parsing
     return _loaded;
   }
 
+  bool IfcTokenStream::IfcTokenChunk::IsSourceChunk() 
+  {
+    return _fileStream!=nullptr;
+  }
+
   size_t IfcTokenStream::IfcTokenChunk::GetMaxSize() 
   {
     return _chunkSize;
@@ -70,69 +154,105 @@ namespace webifc::parsing
   }
   
   void IfcTokenStream::IfcTokenChunk::Load()
+  {
+      if (!_spill.empty())
+      {
+        _chunkData = new uint8_t[_chunkSize];
+        if (codec::Decompress(_spill.data(), _spill.size(), _chunkData, _currentSize))
+        {
+          _loaded = true;
+          DropSpill();
+          return;
+        }
+        spdlog::error("[IfcTokenChunk::Load()] spilled chunk is corrupt, tokenizing it again");
+        delete[] _chunkData;
+        _chunkData = nullptr;
+        DropSpill();
+      }
+      if (_fileStream==nullptr) return;
+      Load(_fileStream);
+  }
+
+  void IfcTokenStream::IfcTokenChunk::Load(IfcFileStream *fileStream)
   {
       _chunkData = new uint8_t[_chunkSize];
       _loaded=true;
-      if (_fileStream->GetRef()!=_fileStartRef) _fileStream->Go(_fileStartRef);
+      fileStream->Go(_fileStartRef);
+      if (_tokens)
+      {
+        _currentSize = 0;
+        while (_currentSize < _chunkSize && fileStream->Available() > 0)
+        {
+          const size_t length = std::min(fileStream->Available(), _chunkSize - _currentSize);
+          std::memcpy(_chunkData + _currentSize, fileStream->Data(), length);
+          _currentSize += length;
+          fileStream->Forward(length);
+        }
+        return;
+      }
       std::vector<char> temp;
       temp.reserve(50);
       _currentSize = 0;
-      while ( !_fileStream->IsAtEnd() && _currentSize < _chunkSize)
+
+      // appends the run matched by scan to temp, continuing into the next window of the file stream if the run reaches its end
+      const auto readRun = [&](auto scan)
+      {
+        while (true)
+        {
+          const size_t available = fileStream->Available();
+          if (available == 0) return;
+          const char * data = fileStream->Data();
+          const size_t length = scan(data, available);
+          temp.insert(temp.end(), data, data + length);
+          fileStream->Forward(length);
+          if (length < available) return;
+        }
+      };
+
+      // once the source end of a chunk is known (reloads, parallel pieces) it must stop exactly there, otherwise the token offsets of later chunks shift
+      const bool bounded = _fileEndRef != 0;
+      while ( !fileStream->IsAtEnd() && (bounded ? fileStream->GetRef() < _fileEndRef : _currentSize < _chunkSize))
       {
-        const char c = _fileStream->Get();
-        if (c == ' ' || c == '\n' || c == '\r' || c == '\t')
+        const char c = fileStream->Get();
+        if (scan::IsWhitespace(c))
         { 
-          _fileStream->Forward();
+          fileStream->Forward(scan::Whitespace(fileStream->Data(), fileStream->Available()));
           continue;
         }
 
         if (c == '\'')
         {
-
-          _fileStream->Forward();
+          fileStream->Forward();
           temp.clear();
           // apparently I dont fully understand strings in IFC yet
           // this example from uptown shows that escaping is not used: 'Type G5 - 800kg/m\X2\00B2\X0\';
           // this example from revit shows that double quotes are used as one quote: 'RPC Tree - Deciduous:Scarlet Oak - 42'':946835'
           // turns out this is just part of ISO 10303-21, thanks ottosson!
+          // doubled quotes are kept as they are on the tape, p21decode resolves them
           while (true)
           {
-  
-            temp.push_back(_fileStream->Get());
-            // if its a quote, maybe its the end of the string
-            if (_fileStream->Get() == '\'')
-            {
-              // if there's another quote behind it, its not
-              _fileStream->Forward();
-              if (_fileStream->Get() == '\'')
-              {
-                // we also bump pos, otherwise we still break next loop...
-                temp.push_back(_fileStream->Get());
-              }
-              else
-              {
-                _fileStream->Back();
-                temp.pop_back();
-                break;
-              }
-            }
-             _fileStream->Forward();
+            readRun([](const char * data, size_t size) { return scan::Until(data, size, '\''); });
+            if (fileStream->IsAtEnd()) break;
+            // this is a quote, if there's another one behind it this is not the end of the string
+            fileStream->Forward();
+            if (fileStream->Get() != '\'') break;
+            temp.push_back('\'');
+            temp.push_back('\'');
+            fileStream->Forward();
           }
           Push<uint8_t>(IfcTokenType::STRING);
           Push<uint16_t>(temp.size());
           if (temp.size() > 0) Push(temp.data(),temp.size());
+          // already past the closing quote
+          continue;
         } 
         else if (c == '#')
         {
-          _fileStream->Forward();
+          fileStream->Forward();
+          temp.clear();
+          readRun(scan::Digits);
           uint32_t num = 0;
-          char c = _fileStream->Get();
-          while (c >= '0' &&  c <= '9')
-          {
-            num = num * 10 + (c - '0');
-            _fileStream->Forward();
-            c = _fileStream->Get();
-          }
+          for (char d : temp) num = num * 10 + (d - '0');
           Push<uint8_t>(IfcTokenType::REF);
           Push<uint32_t>(num);
           // skip next advance
@@ -141,32 +261,40 @@ namespace webifc::parsing
         else if (c == '$') Push<uint8_t>(IfcTokenType::EMPTY);
         else if (c == '*')
         {
-          if (_fileStream->Prev() == '/')
+          if (fileStream->Prev() == '/')
           {
-            _fileStream->Forward();
+            fileStream->Forward();
 
             // comment
-            while (!(_fileStream->Prev() == '*' && _fileStream->Get() == '/')) _fileStream->Forward();
+            while (!(fileStream->Prev() == '*' && fileStream->Get() == '/') && !fileStream->IsAtEnd()) fileStream->Forward();
   
           }
           else Push<uint8_t>(IfcTokenType::UNKNOWN);
         }
         else if (c == '(') Push<uint8_t>(IfcTokenType::SET_BEGIN);
-        else if (c >= '0' && c <= '9')
+        else if (scan::IsDigit(c))
         {
           temp.clear();
-          if (_fileStream->Prev() == '-') temp.push_back('-');
-          char c = _fileStream->Get();
+          if (fileStream->Prev() == '-') temp.push_back('-');
+          const size_t start = temp.size();
+          readRun(scan::Number);
           bool isFrac = false;
-          while ((c >= '0' && c <= '9') || (c == '.') || c == 'e' || c == 'E' || c == '-'|| c == '+')
+          for (size_t i = start; i < temp.size() && !isFrac; i++) isFrac = temp[i] == '.' || temp[i] == 'E';
+          // numbers are parsed once here and stored as their binary value, followed by the lexeme so they are written back unchanged
+          if (isFrac)
           {
-            temp.push_back(c);
-            if (c=='.' || c == 'E') isFrac = true;
-            _fileStream->Forward();
-            c = _fileStream->Get();
+            double value = 0;
+            fast_float::from_chars(temp.data(), temp.data() + temp.size(), value);
+            Push<uint8_t>(IfcTokenType::REAL);
+            Push<double>(value);
+          }
+          else
+          {
+            int64_t value = 0;
+            std::from_chars(temp.data(), temp.data() + temp.size(), value);
+            Push<uint8_t>(IfcTokenType::INTEGER);
+            Push<int64_t>(value);
           }
-          if (isFrac) Push<uint8_t>(IfcTokenType::REAL);
-          else Push<uint8_t>(IfcTokenType::INTEGER);  
           Push<uint16_t>(temp.size());
           Push(temp.data(), temp.size());
 
@@ -176,14 +304,8 @@ namespace webifc::parsing
         else if (c == '.')
         {
           temp.clear();
-          _fileStream->Forward();
-          char c = _fileStream->Get();
-          while ( c != '.')
-          {
-            temp.push_back(c);
-            _fileStream->Forward();
-            c = _fileStream->Get();
-          }
+          fileStream->Forward();
+          readRun([](const char * data, size_t size) { return scan::Until(data, size, '.'); });
 
           Push<uint8_t>(IfcTokenType::ENUM);
           Push<uint16_t>(temp.size());
@@ -192,24 +314,30 @@ namespace webifc::parsing
         else if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z'))
         {
           temp.clear();
-          char c = _fileStream->Get();
-          while ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_')
+          readRun(scan::Label);
+
+          // labels of schema types are resolved here once, everything else stays a string
+          const std::string_view label(temp.data(), temp.size());
+          const uint32_t typeCode = schema::IfcSchemaManager::IfcTypeToTypeCode(label);
+          if (schema::IfcSchemaManager::IfcTypeCodeToLabel(typeCode) == label)
           {
-            temp.push_back(c);
-            _fileStream->Forward();
-            c = _fileStream->Get();
+            Push<uint8_t>(IfcTokenType::TYPE_CODE);
+            Push<uint32_t>(typeCode);
+          }
+          else
+          {
+            Push<uint8_t>(IfcTokenType::LABEL);
+            Push<uint16_t>(temp.size());
+            Push(temp.data(), temp.size ());
           }
-
-          Push<uint8_t>(IfcTokenType::LABEL);
-          Push<uint16_t>(temp.size());
-          Push(temp.data(), temp.size ());
 
           // skip next advance
           continue;
         }
         else if (c == ')') Push<uint8_t>(IfcTokenType::SET_END);
         else if (c == ';') Push<uint8_t>(IfcTokenType::LINE_END);
-        _fileStream->Forward();  
+        fileStream->Forward();  
       }
+      if (!bounded) _fileEndRef = fileStream->GetRef();
     }
 }
\ No newline at end of file
@@ -4,20 +4,81 @@
  
 #include <vector>
 #include <istream>
+#include <optional>
+#include <algorithm>
 #include "IfcTokenStream.h"
+#include "token_scan.h"
+#include "parallel.h"
 
 namespace webifc::parsing
 {
 
-  IfcTokenStream::IfcTokenStream(const size_t chunkSize, const size_t maxChunks) 
-  :  _chunkSize(chunkSize), _maxChunks(maxChunks)
+  namespace
+  {
+    // smallest piece of source text worth handing to a worker
+    constexpr size_t MIN_PIECE_SIZE = 65536;
+
+    // position right after the first ';' at or beyond target that is not inside a string or comment,
+    // scanning from pos which must itself be outside of both. Returns size if there is none.
+    size_t nextLineBoundary(const char *data, const size_t size, size_t pos, const size_t target)
+    {
+      while (pos < size)
+      {
+        pos += scan::UntilAny(data + pos, size - pos, '\'', '/', ';');
+        if (pos >= size) break;
+        const char c = data[pos++];
+        if (c == ';')
+        {
+          if (pos > target) return pos;
+        }
+        else if (c == '\'')
+        {
+          // a doubled quote does not end the string
+          while (pos < size)
+          {
+            pos += scan::Until(data + pos, size - pos, '\'') + 1;
+            if (pos >= size || data[pos] != '\'') break;
+            pos++;
+          }
+        }
+        else if (pos < size && data[pos] == '*')
+        {
+          pos++;
+          while (pos < size)
+          {
+            pos += scan::Until(data + pos, size - pos, '*') + 1;
+            if (pos < size && data[pos] == '/')
+            {
+              pos++;
+              break;
+            }
+          }
+        }
+      }
+      return size;
+    }
+  }
+
+  IfcTokenStream::IfcTokenStream(const size_t chunkSize, const size_t maxChunks, const size_t spillLimit, const size_t threads, WorkerPool *workers) 
+  :  _chunkSize(chunkSize), _maxChunks(maxChunks), _workers(workers), _spillLimit(spillLimit)
   { 
     _cChunk=nullptr;
     _fileStream=nullptr;
+    if (_workers == nullptr)
+    {
+      _ownWorkers = std::make_unique<WorkerPool>(AvailableThreads(threads) - 1);
+      _workers = _ownWorkers.get();
+    }
   }
 
   IfcTokenStream::~IfcTokenStream() 
   {
+    {
+      // a prefetch still running on a worker writes into the stream when it is done
+      std::unique_lock<std::mutex> lock(_prefetchMutex);
+      _prefetchSignal.wait(lock, [&] { return !_prefetchPending; });
+    }
+    if (_prefetchChunk) _prefetchChunk->Clear(true);
     for (size_t i=0; i < _chunks.size();i++)  _chunks[i].Clear(true);
     _chunks.clear();
     std::vector<IfcTokenChunk>().swap(_chunks);
@@ -27,6 +88,49 @@ namespace webifc::parsing
   void IfcTokenStream::SetTokenSource(const std::function<uint32_t(char *, size_t, size_t)> &requestData) 
   {
       _fileStream = new IfcFileStream(requestData,_chunkSize);
+      _sourceRequest = requestData;
+      _textSource = true;
+      if (_workers->Size() > 0) tokenizeSourceParallel();
+      else tokenizeSource();
+  }
+
+  void IfcTokenStream::SetTokenSource(std::istream &requestData)
+  { 
+     SetTokenSource([&](char* dest, size_t sourceOffset, size_t destSize) { requestData.clear(); requestData.seekg(sourceOffset); requestData.read(dest, destSize); return requestData.gcount();});
+  }
+
+  void IfcTokenStream::SetTokenSource(const char *data, const size_t size)
+  {
+      // chunks are tokenized (and re-tokenized after eviction) straight from the caller's memory
+      _fileStream = new IfcFileStream(data,size);
+      _sourceData = data;
+      _sourceSize = size;
+      _textSource = true;
+      if (_workers->Size() > 0 && size > MIN_PIECE_SIZE) tokenizeSourceParallel();
+      else tokenizeSource();
+  }
+
+  void IfcTokenStream::SetTokenSnapshot(const char *tokens, const std::vector<uint64_t> &chunkSizes)
+  {
+      // the chunks are laid out as they were saved and each is copied in when it is first read
+      size_t size = 0;
+      for (uint64_t chunkSize : chunkSizes) size += chunkSize;
+      _fileStream = new IfcFileStream(tokens, size);
+      _sourceData = tokens;
+      _sourceSize = size;
+      size_t tokenOffset = 0;
+      for (uint64_t chunkSize : chunkSizes)
+      {
+          _chunks.emplace_back(tokenOffset, tokenOffset, tokenOffset + chunkSize, _fileStream, true);
+          tokenOffset += chunkSize;
+          if (chunkSize > _chunkSize) _chunkSize = chunkSize;
+      }
+      if (!_chunks.empty()) _cChunk = &_chunks.front();
+      _fileStream->Clear();
+  }
+
+  void IfcTokenStream::tokenizeSource()
+  {
       size_t tokenOffset=0;
       while (!_fileStream->IsAtEnd())
       {
@@ -37,22 +141,92 @@ namespace webifc::parsing
           if (cSize > _chunkSize) _chunkSize = cSize;
           _chunks.push_back(chunk);
           _activeChunks++;
+          _loadedChunks.PushFront(_chunks.size()-1);
       }
       _cChunk = &_chunks.front();
       _fileStream->Clear();
   }
 
-  void IfcTokenStream::SetTokenSource(std::istream &requestData)
-  { 
-     SetTokenSource([&](char* dest, size_t sourceOffset, size_t destSize) { requestData.seekg(sourceOffset); requestData.read(dest, destSize); return requestData.gcount();});
+  void IfcTokenStream::tokenizeSourceParallel()
+  {
+      // every tape chunk covers about _chunkSize bytes of text, which is split at line ends into one piece per worker.
+      // The pieces are tokenized concurrently and joined back into the chunk in order, so the tape comes out exactly
+      // as the sequential tokenizer would lay it out, apart from where chunks start.
+      // An in-memory source is split where it lies, any other is read in order into a window holding the text of the
+      // next chunk, so only the reads stay sequential.
+      const size_t pieceSize = std::max(MIN_PIECE_SIZE, _chunkSize / (_workers->Size() + 1));
+      std::vector<char> window;
+      size_t windowStart = 0;
+      bool sourceEnd = _sourceData != nullptr;
+      size_t tokenOffset = 0;
+      size_t fileOffset = 0;
+      while (true)
+      {
+          const char *text = _sourceData != nullptr ? _sourceData : window.data();
+          const size_t textSize = _sourceData != nullptr ? _sourceSize : window.size();
+          const size_t start = fileOffset - windowStart;
+          const size_t chunkEnd = nextLineBoundary(text, textSize, start, start + _chunkSize);
+          if (chunkEnd == textSize && !sourceEnd)
+          {
+              // the line ending the chunk is not in the window yet
+              const size_t used = window.size();
+              window.resize(used + _chunkSize);
+              const size_t read = _sourceRequest(window.data() + used, windowStart + used, _chunkSize);
+              window.resize(used + read);
+              sourceEnd = read == 0;
+              continue;
+          }
+          if (start >= textSize) break;
+
+          std::vector<size_t> bounds = { start };
+          while (bounds.back() < chunkEnd)
+          {
+              const size_t target = bounds.back() + pieceSize;
+              bounds.push_back(target >= chunkEnd ? chunkEnd : nextLineBoundary(text, textSize, bounds.back(), target));
+          }
+          const size_t pieceCount = bounds.size() - 1;
+
+          std::vector<std::optional<IfcTokenChunk>> pieces(pieceCount);
+          _workers->ParallelFor(pieceCount, [&](size_t i)
+          {
+              // workers each read through their own view, tokens rarely take more than twice the text they come from
+              IfcFileStream source(text, textSize);
+              const size_t length = bounds[i+1] - bounds[i];
+              pieces[i].emplace(length * 2 + 64, 0, bounds[i], bounds[i+1], &source);
+              pieces[i]->Relocate(0, nullptr);
+          });
+
+          size_t tokenSize = 0;
+          for (auto &piece : pieces) tokenSize += piece->TokenSize();
+          checkMemory();
+          IfcTokenChunk chunk(tokenSize, tokenOffset, fileOffset, nullptr);
+          for (auto &piece : pieces)
+          {
+              chunk.Append(*piece);
+              piece->Clear(true);
+          }
+          // evicted, the chunk is tokenized again from the source itself
+          chunk.Relocate(tokenOffset, _fileStream);
+          tokenOffset += tokenSize;
+          if (tokenSize > _chunkSize) _chunkSize = tokenSize;
+          _chunks.push_back(chunk);
+          _activeChunks++;
+          _loadedChunks.PushFront(_chunks.size()-1);
+          fileOffset = windowStart + chunkEnd;
+          if (_sourceData == nullptr)
+          {
+              // the character before the next chunk stays in the window, the tokenizer looks back at it
+              window.erase(window.begin(), window.begin() + (chunkEnd - 1));
+              windowStart += chunkEnd - 1;
+          }
+      }
+      _cChunk = &_chunks.front();
+      _fileStream->Clear();
   }
   
   std::string_view IfcTokenStream::ReadString() 
   {
-      if (!_cChunk->IsLoaded()) {
-        checkMemory();
-        _activeChunks++;
-      }
+      if (!_cChunk->IsLoaded()) loadChunk(_currentChunk);
       auto length = _cChunk->Read<uint16_t>(_readPtr);
       Forward(2);
       if (length > 0) 
@@ -75,73 +249,298 @@ namespace webifc::parsing
           return;
         }
         _readPtr -= _cChunk->TokenSize();
-        _currentChunk++;
-        _cChunk = &_chunks[_currentChunk];
+        selectChunk(_currentChunk+1);
       }
   }
   
   void IfcTokenStream::MoveTo(const size_t pos)
   {
-     for (size_t i=_chunks.size()-1; i >=0; i--)
-      {
-        if (_chunks[i].GetTokenRef() <= pos) 
-        {
-          _currentChunk = i;
-          _cChunk = &_chunks[_currentChunk];
-          _readPtr = pos - _cChunk->GetTokenRef();
-          break;
-        }
-      }
+     // most moves stay inside the current chunk, otherwise find the last chunk starting at or before pos
+     if (_cChunk == nullptr || pos < _cChunk->GetTokenRef() || pos >= _cChunk->GetTokenRef() + _cChunk->TokenSize())
+     {
+       auto it = std::upper_bound(_chunks.begin(), _chunks.end(), pos, [](const size_t p, IfcTokenChunk &chunk) { return p < chunk.GetTokenRef(); });
+       if (it == _chunks.begin()) return;
+       selectChunk((it - _chunks.begin()) - 1);
+     }
+     _readPtr = pos - _cChunk->GetTokenRef();
   }
   
   void IfcTokenStream::checkMemory()
   {
-    if (_activeChunks == _maxChunks){
-      for (uint32_t x = 0; x < _chunks.size(); x++) 
-      {
-        if (_chunks[x].IsLoaded())
-        {
-          if (_chunks[x].Clear())
-          {
-            _activeChunks--;
-            break;
-          }
-        }
-      }
+    // evicts the least recently used source chunk, pushed chunks are never in the list
+    const uint32_t victim = _loadedChunks.Tail();
+    if (_activeChunks < _maxChunks || victim == NO_CHUNK) return;
+    _loadedChunks.Remove(victim);
+    _activeChunks--;
+    _cacheStats.evictions++;
+    if (_spillLimit == 0)
+    {
+      _chunks[victim].Clear();
+      return;
+    }
+
+    // keep the tokens compressed, dropping the oldest spilled chunks to stay within the limit
+    _spillSize += _chunks[victim].Spill();
+    _spilledChunks.PushFront(victim);
+    while (_spillSize > _spillLimit)
+    {
+      const uint32_t dropped = _spilledChunks.Tail();
+      _spilledChunks.Remove(dropped);
+      _spillSize -= _chunks[dropped].DropSpill();
     }
+    _cacheStats.spilledBytes = _spillSize;
+  }
+
+  void IfcTokenStream::loadChunk(const size_t index)
+  {
+    // the chunk itself restores or re-tokenizes its tokens on the next read
+    checkMemory();
+    _activeChunks++;
+    _cacheStats.misses++;
+    const bool spilled = _spilledChunks.Contains(index);
+    if (spilled)
+    {
+      _spilledChunks.Remove(index);
+      _spillSize -= _chunks[index].SpillSize();
+      _cacheStats.spilledBytes = _spillSize;
+      _cacheStats.spillHits++;
+    }
+    if (!adoptPrefetched(index) && !spilled) _cacheStats.reloadedBytes += _chunks[index].SourceSize();
+    if (_chunks[index].IsSourceChunk()) _loadedChunks.PushFront(index);
+  }
+
+  void IfcTokenStream::prefetch(const size_t index)
+  {
+    // only evicted source chunks that can be loaded without the shared file stream: spilled ones or those of an in-memory source
+    if (index >= _chunks.size() || _chunks[index].IsLoaded() || !_chunks[index].IsSourceChunk() || _workers->Size() == 0) return;
+    if (_sourceData == nullptr && _chunks[index].SpillSize() == 0) return;
+    std::unique_lock<std::mutex> lock(_prefetchMutex);
+    if (_prefetchIndex == index || _prefetchPending) return;
+    if (_prefetchChunk) _prefetchChunk->Clear(true);
+    _prefetchChunk.emplace(_chunks[index]);
+    _prefetchChunk->Relocate(_prefetchChunk->GetTokenRef(), nullptr);
+    _prefetchIndex = index;
+    _prefetchPending = true;
+    _workers->Post([this] { loadPrefetched(); });
+  }
+
+  bool IfcTokenStream::adoptPrefetched(const size_t index)
+  {
+    std::unique_lock<std::mutex> lock(_prefetchMutex);
+    if (_prefetchIndex != index) return false;
+    // already on its way, waiting for it is never slower than loading it again here
+    _prefetchSignal.wait(lock, [&] { return !_prefetchPending; });
+    if (_prefetchChunk && _prefetchChunk->IsLoaded())
+    {
+      _chunks[index].Adopt(*_prefetchChunk);
+      _cacheStats.prefetchHits++;
+    }
+    _prefetchChunk.reset();
+    _prefetchIndex = NO_CHUNK;
+    return _chunks[index].IsLoaded();
+  }
+
+  void IfcTokenStream::loadPrefetched()
+  {
+    // runs on a worker, nothing else touches the copy while the load is pending
+    IfcTokenChunk &chunk = *_prefetchChunk;
+    {
+      // without an in-memory source only the spill is there to load from
+      std::optional<IfcFileStream> source;
+      if (_sourceData != nullptr) source.emplace(_sourceData, _sourceSize);
+      chunk.Relocate(chunk.GetTokenRef(), source ? &*source : nullptr);
+      chunk.Load();
+      chunk.Relocate(chunk.GetTokenRef(), nullptr);
+    }
+    // signalled under the lock, the stream may be destroyed as soon as it sees the load is done
+    std::lock_guard<std::mutex> lock(_prefetchMutex);
+    _prefetchPending = false;
+    _prefetchSignal.notify_all();
+  }
+
+  void IfcTokenStream::selectChunk(const size_t index)
+  {
+    // stepping into the next chunk means the tape is being streamed, so the one after it is likely needed soon
+    if (index == _currentChunk + 1) prefetch(index + 1);
+    _currentChunk = index;
+    _cChunk = &_chunks[_currentChunk];
+    if (_cChunk->IsLoaded())
+    {
+      _cacheStats.hits++;
+      if (_cChunk->IsSourceChunk()) _loadedChunks.PushFront(index);
+    }
+  }
+
+  void IfcTokenStream::ChunkList::PushFront(const uint32_t index)
+  {
+    if (_head == index) return;
+    if (_prev.size() <= index)
+    {
+      _prev.resize(index + 1, NO_CHUNK);
+      _next.resize(index + 1, NO_CHUNK);
+    }
+    if (Contains(index)) Remove(index);
+    _next[index] = _head;
+    if (_head != NO_CHUNK) _prev[_head] = index;
+    _head = index;
+    if (_tail == NO_CHUNK) _tail = index;
+  }
+
+  void IfcTokenStream::ChunkList::Remove(const uint32_t index)
+  {
+    const uint32_t prev = _prev[index];
+    const uint32_t next = _next[index];
+    if (prev != NO_CHUNK) _next[prev] = next;
+    else _head = next;
+    if (next != NO_CHUNK) _prev[next] = prev;
+    else _tail = prev;
+    _prev[index] = NO_CHUNK;
+    _next[index] = NO_CHUNK;
+  }
+
+  bool IfcTokenStream::ChunkList::Contains(const uint32_t index)
+  {
+    return index == _head || (index < _prev.size() && _prev[index] != NO_CHUNK);
+  }
+
+  uint32_t IfcTokenStream::ChunkList::Tail()
+  {
+    return _tail;
+  }
+
+  const TapeCacheStats &IfcTokenStream::GetCacheStats()
+  {
+    return _cacheStats;
   }
   
   void IfcTokenStream::Push(void *v, const size_t size)
   {
       if (_chunks.empty())
       {
-        _chunks.emplace_back(_chunkSize,0,0,_fileStream);
+        _chunks.emplace_back(_chunkSize,0,0,nullptr);
         _activeChunks++;
+        _cChunk = &_chunks[_currentChunk];
+        _pushedChunk = 0;
       }
-      if ( _chunks.back().TokenSize() + size > _chunks.back().GetMaxSize())
+      // pushed tokens cannot be re-tokenized from the source, so they go into chunks that are never evicted
+      if ( _chunks.back().IsSourceChunk() || _chunkClosed || _chunks.back().TokenSize() + size > _chunks.back().GetMaxSize())
       {
+        _chunkClosed = false;
         checkMemory();
-        size_t fsRef = 0;
-        if (_fileStream !=nullptr) fsRef = _fileStream->GetRef();
-        _chunks.emplace_back(_chunkSize,_chunks.back().GetTokenRef() + _chunks.back().TokenSize(),fsRef,_fileStream);
+        _chunks.emplace_back(_chunkSize,_chunks.back().GetTokenRef() + _chunks.back().TokenSize(),0,nullptr);
         _activeChunks++;
+        _cChunk = &_chunks[_currentChunk];
+        if (_pushedChunk == NO_CHUNK) _pushedChunk = _chunks.size() - 1;
       }
       _chunks.back().Push(v,size);
   }
   
+  size_t IfcTokenStream::GetPushedTokenRef()
+  {
+    if (_pushedChunk == NO_CHUNK) return GetTotalSize();
+    return _chunks[_pushedChunk].GetTokenRef();
+  }
+
+  void IfcTokenStream::CloseChunk()
+  {
+    _chunkClosed = true;
+  }
+
+  void IfcTokenStream::CopyTokens(size_t start, const size_t end)
+  {
+    // tokens never straddle chunks, so the piece in each chunk is pushed as it is
+    while (start < end)
+    {
+      MoveTo(start);
+      if (!_cChunk->IsLoaded()) loadChunk(_currentChunk);
+      const size_t length = std::min(end - start, _cChunk->TokenSize() - _readPtr);
+      std::string_view tokens = _cChunk->ReadString(_readPtr, length);
+      Push((void*)tokens.data(), length);
+      start += length;
+    }
+  }
+
+  void IfcTokenStream::DropTokens(const size_t start, const size_t end)
+  {
+    auto first = std::lower_bound(_chunks.begin(), _chunks.end(), start, [](IfcTokenChunk &chunk, const size_t p) { return chunk.GetTokenRef() < p; });
+    auto last = std::lower_bound(first, _chunks.end(), end, [](IfcTokenChunk &chunk, const size_t p) { return chunk.GetTokenRef() < p; });
+    for (auto it = first; it != last; it++)
+    {
+      it->Clear(true);
+      _activeChunks--;
+    }
+    for (auto it = last; it != _chunks.end(); it++) it->Relocate(it->GetTokenRef() - (end - start), nullptr);
+    _chunks.erase(first, last);
+    // the dropped chunks started with the first pushed one, whatever follows them takes its place
+    if (_pushedChunk >= _chunks.size()) _pushedChunk = NO_CHUNK;
+    _currentChunk = 0;
+    _readPtr = 0;
+    _cChunk = _chunks.empty() ? nullptr : &_chunks.front();
+  }
+
   size_t IfcTokenStream::GetTotalSize()
   {
     if (_chunks.size()==0) return 0;
     return _chunks.back().TokenSize() + _chunks.back().GetTokenRef();
   }
   
+  size_t IfcTokenStream::GetChunkCount()
+  {
+    return _chunks.size();
+  }
+
+  bool IfcTokenStream::IsChunkLoaded(const size_t index)
+  {
+    return _chunks[index].IsLoaded();
+  }
+
+  size_t IfcTokenStream::GetChunkTokenRef(const size_t index)
+  {
+    return _chunks[index].GetTokenRef();
+  }
+
+  std::string_view IfcTokenStream::GetChunkTokens(const size_t index)
+  {
+    // the raw tokens of a chunk, loading it if it was evicted and prefetching the next one. Not safe to call concurrently
+    if (!_chunks[index].IsLoaded()) loadChunk(index);
+    prefetch(index+1);
+    return GetLoadedChunkTokens(index);
+  }
+
+  std::string_view IfcTokenStream::GetLoadedChunkTokens(const size_t index)
+  {
+    // only reads the chunk, which must be loaded, so workers can call it concurrently
+    return _chunks[index].ReadString(0, _chunks[index].TokenSize());
+  }
+
+  bool IfcTokenStream::ReadSource(const std::function<void(const char *, size_t)> &consumer)
+  {
+    // a stream of its own, so chunks can be loaded from the source while it is read
+    if (!_textSource) return false;
+    std::optional<IfcFileStream> source;
+    if (_sourceData != nullptr) source.emplace(_sourceData, _sourceSize);
+    else source.emplace(_sourceRequest, _chunkSize);
+    while (!source->IsAtEnd())
+    {
+      const size_t size = source->Available();
+      consumer(source->Data(), size);
+      source->Forward(size);
+    }
+    return true;
+  }
+
+  WorkerPool &IfcTokenStream::GetWorkers()
+  {
+    return *_workers;
+  }
+
   void IfcTokenStream::Back()
   {
       if (_readPtr == 0 ) 
       {
         if (_currentChunk > 0) 
         {
-          _cChunk = &_chunks[--_currentChunk];
+          selectChunk(_currentChunk-1);
           _readPtr=_cChunk->TokenSize()-1;
           return;
         }
@@ -11,6 +11,11 @@
 #include <string_view>
 #include <cstring>
 #include <cstdint>
+#include <mutex>
+#include <condition_variable>
+#include <optional>
+#include <memory>
+#include "parallel.h"
  
 namespace webifc::parsing
 {
@@ -27,23 +32,38 @@ namespace webifc::parsing
     SET_BEGIN,
     SET_END,
     LINE_END,
-    INTEGER
+    INTEGER,
+    // a LABEL the schema knows, stored as its type code. Only found on the tape, readers see it as a LABEL
+    TYPE_CODE
+  };
+
+  // how well the loaded tape chunks cover the reads. A miss restores the chunk from the spill pool
+  // when it is still there (a spill hit), otherwise it re-tokenizes the chunk from its source
+  struct TapeCacheStats
+  {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t evictions = 0;
+    size_t reloadedBytes = 0;
+    size_t spillHits = 0;
+    size_t spilledBytes = 0;
+    size_t prefetchHits = 0;
   };
   
   
   class IfcTokenStream 
   {
       public:
-        IfcTokenStream(const size_t chunkSize, const size_t maxChunks);
+        // without a shared pool of workers the stream starts one of its own with threads - 1 workers
+        IfcTokenStream(const size_t chunkSize, const size_t maxChunks, const size_t spillLimit, const size_t threads, WorkerPool *workers = nullptr);
         ~IfcTokenStream();
         void SetTokenSource(const std::function<uint32_t(char *, size_t, size_t)> &requestData);
         void SetTokenSource(std::istream &requestData);
+        void SetTokenSource(const char *data, const size_t size);
+        void SetTokenSnapshot(const char *tokens, const std::vector<uint64_t> &chunkSizes);
         template <typename T> T Read()
         {
-          if (!_cChunk->IsLoaded()) {
-            checkMemory();
-            _activeChunks++;
-          }
+          if (!_cChunk->IsLoaded()) loadChunk(_currentChunk);
           T v =  _cChunk->Read<T>(_readPtr);
           Forward(sizeof(T));
           return v;
@@ -60,23 +80,80 @@ namespace webifc::parsing
         void MoveTo(const size_t pos);
         size_t GetReadOffset();
         size_t GetTotalSize();
+        size_t GetChunkCount();
+        bool IsChunkLoaded(const size_t index);
+        size_t GetChunkTokenRef(const size_t index);
+        std::string_view GetChunkTokens(const size_t index);
+        // the tokens of a chunk that is known to be loaded, without loading or prefetching anything
+        std::string_view GetLoadedChunkTokens(const size_t index);
+        // tape offset where the pushed tokens begin, everything before it comes from the source
+        size_t GetPushedTokenRef();
+        // the next pushed token starts a new chunk, so the tokens up to here can be dropped as a whole
+        void CloseChunk();
+        // pushes a copy of the tokens in [start, end)
+        void CopyTokens(size_t start, const size_t end);
+        // drops the pushed chunks in [start, end), which must begin and end on chunk boundaries. The tokens behind them move down by end - start
+        void DropTokens(const size_t start, const size_t end);
+        // hands the text the tape was tokenized from to consumer window by window, false when there is no such text (snapshots)
+        bool ReadSource(const std::function<void(const char *, size_t)> &consumer);
+        // the workers the loader runs its parallel loops on
+        WorkerPool &GetWorkers();
+        const TapeCacheStats &GetCacheStats();
 
       private:
         void checkMemory();
+        void loadChunk(const size_t index);
+        void selectChunk(const size_t index);
+        void prefetch(const size_t index);
+        bool adoptPrefetched(const size_t index);
+        void loadPrefetched();
+        void tokenizeSource();
+        void tokenizeSourceParallel();
         size_t _readPtr = 0;
       	size_t _currentChunk = 0;
         size_t _activeChunks = 0;
         size_t _chunkSize;
         size_t _maxChunks;
+        std::unique_ptr<WorkerPool> _ownWorkers;
+        WorkerPool *_workers;
+        size_t _spillLimit;
+        size_t _spillSize = 0;
+        bool _chunkClosed = false;
+        // the first chunk holding pushed tokens, all chunks behind it do as well
+        uint32_t _pushedChunk = NO_CHUNK;
+        TapeCacheStats _cacheStats;
+        static constexpr uint32_t NO_CHUNK = UINT32_MAX;
+        // chunks from most to least recently used, as a list linked through the chunk indices
+        class ChunkList
+        {
+          public:
+            void PushFront(const uint32_t index);
+            void Remove(const uint32_t index);
+            bool Contains(const uint32_t index);
+            uint32_t Tail();
+          private:
+            std::vector<uint32_t> _prev;
+            std::vector<uint32_t> _next;
+            uint32_t _head = NO_CHUNK;
+            uint32_t _tail = NO_CHUNK;
+        };
+        // loaded source chunks, which can be evicted
+        ChunkList _loadedChunks;
+        // evicted chunks whose tokens are kept compressed
+        ChunkList _spilledChunks;
         class IfcFileStream
         {
           public:
             IfcFileStream(const std::function<uint32_t(char *, size_t, size_t)> &requestData, const uint32_t size);
+            IfcFileStream(const char *data, const size_t size);
             ~IfcFileStream();
             void Go(const uint32_t ref);
             void Forward();
+            void Forward(const size_t size);
             void Back();
             size_t GetRef();
+            const char * Data();
+            size_t Available();
             char Next();
             char Prev();
             bool IsAtEnd();
@@ -91,16 +168,28 @@ namespace webifc::parsing
             size_t _currentSize=0;
             size_t _startRef=0;
             char * _buffer; 
+            const char * _mappedData = nullptr;
         };
         class IfcTokenChunk
         {
             public:
             	IfcTokenChunk(const size_t chunkSize, const size_t startRef, const size_t fileStartRef, IfcFileStream *_fileStream);
+            	IfcTokenChunk(const size_t chunkSize, const size_t startRef, const size_t fileStartRef, const size_t fileEndRef, IfcFileStream *_fileStream);
+            	IfcTokenChunk(const size_t startRef, const size_t fileStartRef, const size_t fileEndRef, IfcFileStream *_fileStream, const bool tokens);
+              void Relocate(const size_t startRef, IfcFileStream *fileStream);
+              void Append(IfcTokenChunk &other);
               bool Clear(bool force);
               bool Clear();
               bool IsLoaded();
+              bool IsSourceChunk();
               size_t TokenSize();
               size_t GetTokenRef();
+              size_t SourceSize();
+              size_t Spill();
+              size_t DropSpill();
+              size_t SpillSize();
+              void Adopt(IfcTokenChunk &other);
+              void Load();
               void Push(void *v, const size_t size);
               size_t GetMaxSize();
               std::string_view ReadString(const size_t ptr,const size_t size); 
@@ -116,18 +205,35 @@ namespace webifc::parsing
                 Push(&input,sizeof(T));
               }
             private:
-              void Load();
+              void Load(IfcFileStream *fileStream);
               bool _loaded=false;
               size_t _currentSize=0;
               size_t _startRef=0;
               size_t _fileStartRef;
+              size_t _fileEndRef = 0;
               size_t _chunkSize;
             	uint8_t *_chunkData;
               IfcFileStream *_fileStream;
+              // the source holds tokens already (a snapshot), so loading is a copy
+              bool _tokens = false;
+              std::vector<uint8_t> _spill;
         };
         std::vector<IfcTokenChunk> _chunks;
         IfcTokenChunk * _cChunk;
         IfcFileStream * _fileStream;
+        // in-memory source, which the workers can read through its own view
+        const char * _sourceData = nullptr;
+        size_t _sourceSize = 0;
+        // the source when it is read through a callback, kept to read it again apart from the chunk loads
+        std::function<uint32_t(char *, size_t, size_t)> _sourceRequest;
+        bool _textSource = false;
+        // read-ahead of the chunk after the one being streamed, loaded into a copy by one of the workers;
+        // this one chunk is not counted against maxChunks until it is adopted
+        std::mutex _prefetchMutex;
+        std::condition_variable _prefetchSignal;
+        std::optional<IfcTokenChunk> _prefetchChunk;
+        uint32_t _prefetchIndex = NO_CHUNK;
+        bool _prefetchPending = false;
   };
   
 }
\ No newline at end of file
@@ -0,0 +1,392 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include <string>
+#include <cstring>
+#include <cctype>
+#include <algorithm>
+#include <spdlog/spdlog.h>
+#include "IfcZipSource.h"
+
+namespace webifc::parsing
+{
+
+  namespace
+  {
+    constexpr uint32_t LOCAL_FILE_SIGNATURE = 0x04034b50;
+    constexpr uint16_t ENCRYPTED = 1;
+    constexpr uint16_t DATA_DESCRIPTOR = 8;
+    constexpr uint16_t STORED = 0;
+    constexpr uint16_t DEFLATED = 8;
+
+    constexpr uint16_t LENGTH_BASE[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+    constexpr uint8_t LENGTH_EXTRA[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+    constexpr uint16_t DISTANCE_BASE[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+    constexpr uint8_t DISTANCE_EXTRA[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+    constexpr uint8_t CODE_LENGTH_ORDER[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+    uint16_t u16(const uint8_t *p)
+    {
+      return p[0] | (p[1] << 8);
+    }
+
+    uint32_t u32(const uint8_t *p)
+    {
+      return u16(p) | (uint32_t(u16(p + 2)) << 16);
+    }
+
+    uint64_t u64(const uint8_t *p)
+    {
+      return u32(p) | (uint64_t(u32(p + 4)) << 32);
+    }
+  }
+
+  IfcZipSource::IfcZipSource(const std::function<uint32_t(char *, size_t, size_t)> &requestData) : _requestData(requestData)
+  {
+  }
+
+  bool IfcZipSource::IsZip(const std::function<uint32_t(char *, size_t, size_t)> &requestData)
+  {
+    uint8_t signature[4];
+    return requestData(reinterpret_cast<char*>(signature), 0, sizeof(signature)) == sizeof(signature) && u32(signature) == LOCAL_FILE_SIGNATURE;
+  }
+
+  bool IfcZipSource::Open()
+  {
+    // walks the local file headers up to the first .ifc entry, so the central directory at the end is never needed
+    uint64_t offset = 0;
+    while (true)
+    {
+      uint8_t header[30];
+      if (_requestData(reinterpret_cast<char*>(header), offset, sizeof(header)) != sizeof(header) || u32(header) != LOCAL_FILE_SIGNATURE)
+      {
+        spdlog::error("[IfcZipSource::Open()] no .ifc file in zip container");
+        return false;
+      }
+      const uint16_t flags = u16(header + 6);
+      const uint16_t method = u16(header + 8);
+      uint64_t compressedSize = u32(header + 18);
+      uint64_t size = u32(header + 22);
+      const uint16_t nameLength = u16(header + 26);
+      const uint16_t extraLength = u16(header + 28);
+      std::string name(nameLength, '\0');
+      std::vector<uint8_t> extra(extraLength);
+      if ((nameLength > 0 && _requestData(name.data(), offset + sizeof(header), nameLength) != nameLength) || (extraLength > 0 && _requestData(reinterpret_cast<char*>(extra.data()), offset + sizeof(header) + nameLength, extraLength) != extraLength))
+      {
+        spdlog::error("[IfcZipSource::Open()] zip container is truncated");
+        return false;
+      }
+      // zip64 keeps the sizes in an extra field
+      for (size_t i = 0; i + 4 <= extra.size(); i += 4 + u16(extra.data() + i + 2))
+      {
+        if (u16(extra.data() + i) != 1) continue;
+        size_t field = i + 4;
+        if (size == UINT32_MAX && field + 8 <= extra.size()) { size = u64(extra.data() + field); field += 8; }
+        if (compressedSize == UINT32_MAX && field + 8 <= extra.size()) compressedSize = u64(extra.data() + field);
+      }
+      const uint64_t dataStart = offset + sizeof(header) + nameLength + extraLength;
+
+      std::string extension = name.size() >= 4 ? name.substr(name.size() - 4) : "";
+      std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return std::tolower(c); });
+      if (extension == ".ifc")
+      {
+        if (flags & ENCRYPTED)
+        {
+          spdlog::error("[IfcZipSource::Open()] {} is encrypted", name);
+          return false;
+        }
+        if (method != STORED && method != DEFLATED)
+        {
+          spdlog::error("[IfcZipSource::Open()] {} uses unsupported compression method {}", name, method);
+          return false;
+        }
+        if (method == STORED && (flags & DATA_DESCRIPTOR))
+        {
+          spdlog::error("[IfcZipSource::Open()] {} is stored without its size", name);
+          return false;
+        }
+        _method = method;
+        _dataStart = dataStart;
+        _size = size;
+        _input.resize(INPUT_SIZE);
+        _checkpoints.push_back({dataStart * 8, 0, {}});
+        seek(dataStart * 8);
+        return true;
+      }
+      if ((flags & DATA_DESCRIPTOR) && compressedSize == 0)
+      {
+        spdlog::error("[IfcZipSource::Open()] cannot skip {}, its size is unknown", name);
+        return false;
+      }
+      offset = dataStart + compressedSize;
+    }
+  }
+
+  uint32_t IfcZipSource::Read(char *dest, const size_t sourceOffset, const size_t destSize)
+  {
+    if (_method == STORED)
+    {
+      if (sourceOffset >= _size) return 0;
+      return _requestData(dest, _dataStart + sourceOffset, std::min<uint64_t>(destSize, _size - sourceOffset));
+    }
+    if (sourceOffset < _windowStart)
+    {
+      // going back, inflate again from the last checkpoint before sourceOffset
+      auto it = std::upper_bound(_checkpoints.begin(), _checkpoints.end(), sourceOffset, [](const uint64_t offset, const Checkpoint &checkpoint) { return offset < checkpoint.output; });
+      const Checkpoint &checkpoint = *(it - 1);
+      _window = checkpoint.history;
+      _windowStart = checkpoint.output - checkpoint.history.size();
+      _finished = false;
+      _error = false;
+      seek(checkpoint.bitPosition);
+    }
+
+    size_t written = 0;
+    while (written < destSize)
+    {
+      const uint64_t position = sourceOffset + written;
+      const uint64_t end = _windowStart + _window.size();
+      if (position < end)
+      {
+        const size_t length = std::min<uint64_t>(destSize - written, end - position);
+        std::memcpy(dest + written, _window.data() + (position - _windowStart), length);
+        written += length;
+        continue;
+      }
+      if (_finished || _error) break;
+      // everything before position has been served, only the history matches can refer to is kept
+      if (_window.size() > 2 * WINDOW_SIZE)
+      {
+        const size_t dropped = _window.size() - WINDOW_SIZE;
+        _window.erase(_window.begin(), _window.begin() + dropped);
+        _windowStart += dropped;
+      }
+      if (end >= _checkpoints.back().output + CHECKPOINT_INTERVAL)
+      {
+        const size_t history = std::min(_window.size(), WINDOW_SIZE);
+        _checkpoints.push_back({bitPosition(), end, std::vector<uint8_t>(_window.end() - history, _window.end())});
+      }
+      if (!inflateBlock())
+      {
+        spdlog::error("[IfcZipSource::Read()] zip entry is corrupt at {}", end);
+        _error = true;
+      }
+    }
+    return written;
+  }
+
+  bool IfcZipSource::loadInput()
+  {
+    _inputStart += _inputSize;
+    _inputPos = 0;
+    _inputSize = _requestData(reinterpret_cast<char*>(_input.data()), _inputStart, INPUT_SIZE);
+    return _inputSize > 0;
+  }
+
+  void IfcZipSource::refill()
+  {
+    while (_bitCount <= 56)
+    {
+      if (_inputPos == _inputSize && !loadInput()) return;
+      _bitBuffer |= uint64_t(_input[_inputPos++]) << _bitCount;
+      _bitCount += 8;
+    }
+  }
+
+  void IfcZipSource::seek(const uint64_t position)
+  {
+    _inputStart = position / 8;
+    _inputSize = 0;
+    _inputPos = 0;
+    _bitBuffer = 0;
+    _bitCount = 0;
+    bits(position % 8);
+  }
+
+  uint64_t IfcZipSource::bitPosition() const
+  {
+    return (_inputStart + _inputPos) * 8 - _bitCount;
+  }
+
+  uint32_t IfcZipSource::bits(const uint32_t count)
+  {
+    if (_bitCount < count) refill();
+    if (_bitCount < count)
+    {
+      _error = true;
+      return 0;
+    }
+    const uint32_t value = static_cast<uint32_t>(_bitBuffer & ((uint64_t(1) << count) - 1));
+    _bitBuffer >>= count;
+    _bitCount -= count;
+    return value;
+  }
+
+  bool IfcZipSource::build(Huffman &huffman, const uint8_t *lengths, const uint32_t count)
+  {
+    std::fill_n(huffman.count, 16, 0);
+    std::fill_n(huffman.fast, 1 << FAST_BITS, 0);
+    for (uint32_t i = 0; i < count; i++) huffman.count[lengths[i]]++;
+    huffman.count[0] = 0;
+    // more codes than lengths allow, incomplete codes are fine as long as the stream never uses the gaps
+    int32_t left = 1;
+    for (uint32_t length = 1; length < 16; length++)
+    {
+      left = (left << 1) - huffman.count[length];
+      if (left < 0) return false;
+    }
+
+    uint16_t offsets[16];
+    offsets[1] = 0;
+    for (uint32_t length = 1; length < 15; length++) offsets[length + 1] = offsets[length] + huffman.count[length];
+    for (uint32_t symbol = 0; symbol < count; symbol++)
+    {
+      if (lengths[symbol] != 0) huffman.symbol[offsets[lengths[symbol]]++] = symbol;
+    }
+
+    // codes are stored starting from their first bit, so the table is indexed by the reversed code
+    uint32_t code = 0;
+    uint32_t index = 0;
+    for (uint32_t length = 1; length < 16; length++, code <<= 1)
+    {
+      for (uint32_t i = 0; i < huffman.count[length]; i++, index++, code++)
+      {
+        if (length > FAST_BITS) continue;
+        uint32_t reversed = 0;
+        for (uint32_t bit = 0; bit < length; bit++) reversed |= ((code >> bit) & 1) << (length - 1 - bit);
+        for (uint32_t entry = reversed; entry < (1u << FAST_BITS); entry += 1u << length) huffman.fast[entry] = (huffman.symbol[index] << 4) | length;
+      }
+    }
+    return true;
+  }
+
+  int32_t IfcZipSource::decode(const Huffman &huffman)
+  {
+    if (_bitCount < 15) refill();
+    const uint16_t entry = huffman.fast[_bitBuffer & ((1u << FAST_BITS) - 1)];
+    if (entry != 0 && (entry & 15) <= _bitCount)
+    {
+      _bitBuffer >>= entry & 15;
+      _bitCount -= entry & 15;
+      return entry >> 4;
+    }
+    // longer codes, one bit at a time
+    int32_t code = 0;
+    int32_t first = 0;
+    int32_t index = 0;
+    for (uint32_t length = 1; length < 16; length++)
+    {
+      code |= bits(1);
+      if (_error) return -1;
+      const int32_t count = huffman.count[length];
+      if (code - count < first) return huffman.symbol[index + (code - first)];
+      index += count;
+      first = (first + count) << 1;
+      code <<= 1;
+    }
+    return -1;
+  }
+
+  bool IfcZipSource::inflateBlock()
+  {
+    const uint32_t last = bits(1);
+    const uint32_t type = bits(2);
+    if (type == 0)
+    {
+      bits(_bitCount & 7);
+      const uint32_t length = bits(16);
+      if ((~bits(16) & 0xFFFF) != length) return false;
+      for (uint32_t i = 0; i < length && !_error; i++) _window.push_back(bits(8));
+    }
+    else if (type == 1)
+    {
+      static const auto fixed = []
+      {
+        std::pair<Huffman, Huffman> codes;
+        uint8_t lengths[288];
+        std::fill_n(lengths, 144, 8);
+        std::fill_n(lengths + 144, 112, 9);
+        std::fill_n(lengths + 256, 24, 7);
+        std::fill_n(lengths + 280, 8, 8);
+        build(codes.first, lengths, 288);
+        std::fill_n(lengths, 30, 5);
+        build(codes.second, lengths, 30);
+        return codes;
+      }();
+      if (!inflateCodes(fixed.first, fixed.second)) return false;
+    }
+    else if (type == 2)
+    {
+      const uint32_t lengthCount = bits(5) + 257;
+      const uint32_t distanceCount = bits(5) + 1;
+      const uint32_t codeLengthCount = bits(4) + 4;
+      if (lengthCount > 286 || distanceCount > 30) return false;
+      uint8_t lengths[320] = {};
+      for (uint32_t i = 0; i < codeLengthCount; i++) lengths[CODE_LENGTH_ORDER[i]] = bits(3);
+      Huffman codeLengths;
+      if (!build(codeLengths, lengths, 19)) return false;
+
+      uint32_t index = 0;
+      while (index < lengthCount + distanceCount)
+      {
+        const int32_t symbol = decode(codeLengths);
+        if (symbol < 0) return false;
+        if (symbol < 16)
+        {
+          lengths[index++] = symbol;
+          continue;
+        }
+        uint8_t repeated = 0;
+        uint32_t repeat = 0;
+        if (symbol == 16)
+        {
+          if (index == 0) return false;
+          repeated = lengths[index - 1];
+          repeat = 3 + bits(2);
+        }
+        else if (symbol == 17) repeat = 3 + bits(3);
+        else repeat = 11 + bits(7);
+        if (index + repeat > lengthCount + distanceCount) return false;
+        while (repeat-- > 0) lengths[index++] = repeated;
+      }
+      if (lengths[256] == 0) return false;
+      Huffman literals;
+      Huffman distances;
+      if (!build(literals, lengths, lengthCount) || !build(distances, lengths + lengthCount, distanceCount)) return false;
+      if (!inflateCodes(literals, distances)) return false;
+    }
+    else return false;
+    if (last) _finished = true;
+    return !_error;
+  }
+
+  bool IfcZipSource::inflateCodes(const Huffman &literals, const Huffman &distances)
+  {
+    while (true)
+    {
+      int32_t symbol = decode(literals);
+      if (symbol < 0 || _error) return false;
+      if (symbol < 256)
+      {
+        _window.push_back(symbol);
+        continue;
+      }
+      if (symbol == 256) return true;
+      symbol -= 257;
+      if (symbol >= 29) return false;
+      const uint32_t length = LENGTH_BASE[symbol] + bits(LENGTH_EXTRA[symbol]);
+      const int32_t distanceSymbol = decode(distances);
+      if (distanceSymbol < 0 || distanceSymbol >= 30) return false;
+      const uint32_t distance = DISTANCE_BASE[distanceSymbol] + bits(DISTANCE_EXTRA[distanceSymbol]);
+      if (_error || distance > _window.size()) return false;
+      // the match may overlap its own output, so copy forward one byte at a time
+      const size_t at = _window.size();
+      _window.resize(at + length);
+      uint8_t *out = _window.data() + at;
+      const uint8_t *from = out - distance;
+      for (uint32_t i = 0; i < length; i++) out[i] = from[i];
+    }
+  }
+
+}
@@ -0,0 +1,73 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <vector>
+#include <functional>
+#include <cstdint>
+#include <cstddef>
+
+namespace webifc::parsing
+{
+
+  // The .ifc entry of a zip container (.ifczip), inflated on the fly while it is read. Read serves the same
+  // (dest, sourceOffset, destSize) requests as any requestData source: reads going forward continue inflating
+  // where the last one stopped, reads going back restart from the nearest checkpoint. Only the last 32 KB of
+  // output and one checkpoint of the same size every few MB are kept, never the whole inflated file.
+  class IfcZipSource
+  {
+    public:
+      IfcZipSource(const std::function<uint32_t(char *, size_t, size_t)> &requestData);
+      static bool IsZip(const std::function<uint32_t(char *, size_t, size_t)> &requestData);
+      bool Open();
+      uint32_t Read(char *dest, const size_t sourceOffset, const size_t destSize);
+
+    private:
+      static constexpr size_t WINDOW_SIZE = 32768;
+      static constexpr size_t INPUT_SIZE = 65536;
+      static constexpr size_t CHECKPOINT_INTERVAL = 4194304;
+      static constexpr uint32_t FAST_BITS = 10;
+      // canonical huffman code, with a lookup table for codes of up to FAST_BITS bits
+      struct Huffman
+      {
+        uint16_t fast[1 << FAST_BITS];
+        uint16_t count[16];
+        uint16_t symbol[288];
+      };
+      // decoder state at the start of a block
+      struct Checkpoint
+      {
+        uint64_t bitPosition;
+        uint64_t output;
+        std::vector<uint8_t> history;
+      };
+      bool loadInput();
+      void refill();
+      void seek(const uint64_t bitPosition);
+      uint64_t bitPosition() const;
+      uint32_t bits(const uint32_t count);
+      static bool build(Huffman &huffman, const uint8_t *lengths, const uint32_t count);
+      int32_t decode(const Huffman &huffman);
+      bool inflateBlock();
+      bool inflateCodes(const Huffman &lengths, const Huffman &distances);
+      std::function<uint32_t(char *, size_t, size_t)> _requestData;
+      uint16_t _method = 0;
+      uint64_t _dataStart = 0;
+      uint64_t _size = 0;
+      bool _finished = false;
+      bool _error = false;
+      std::vector<uint8_t> _input;
+      uint64_t _inputStart = 0;
+      size_t _inputSize = 0;
+      size_t _inputPos = 0;
+      uint64_t _bitBuffer = 0;
+      uint32_t _bitCount = 0;
+      // recent output, covering [_windowStart, _windowStart + _window.size()) of the inflated file
+      std::vector<uint8_t> _window;
+      uint64_t _windowStart = 0;
+      std::vector<Checkpoint> _checkpoints;
+  };
+
+}
@@ -0,0 +1,123 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <cstddef>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <deque>
+#include <vector>
+#include <algorithm>
+
+namespace webifc::parsing
+{
+
+  // number of threads that can actually run on this target
+  inline size_t AvailableThreads(const size_t requested)
+  {
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+    (void)requested;
+    return 1;
+#else
+    return std::max<size_t>(1, requested);
+#endif
+  }
+
+  // threads started once and kept for posted jobs, shared by the parallel loops and background loads of the loaders.
+  // A pool without workers runs the loops on the calling thread and takes no jobs
+  class WorkerPool
+  {
+    public:
+      explicit WorkerPool(const size_t workers)
+      {
+        _threads.reserve(workers);
+        for (size_t i = 0; i < workers; i++) _threads.emplace_back([this] { run(); });
+      }
+
+      ~WorkerPool()
+      {
+        {
+          std::lock_guard<std::mutex> lock(_mutex);
+          _stop = true;
+        }
+        _signal.notify_all();
+        for (auto &thread : _threads) thread.join();
+      }
+
+      WorkerPool(const WorkerPool &) = delete;
+      WorkerPool &operator=(const WorkerPool &) = delete;
+
+      size_t Size() const
+      {
+        return _threads.size();
+      }
+
+      // runs job on the next free worker, the pool must have one
+      void Post(std::function<void()> job)
+      {
+        {
+          std::lock_guard<std::mutex> lock(_mutex);
+          _jobs.push_back(std::move(job));
+        }
+        _signal.notify_one();
+      }
+
+      // calls fn(i) for every i in [0, count), the calling thread and the workers take items one at a time
+      template <typename F> void ParallelFor(const size_t count, F &&fn)
+      {
+        const size_t helpers = std::min(Size(), count > 0 ? count - 1 : 0);
+        if (helpers == 0)
+        {
+          for (size_t i = 0; i < count; i++) fn(i);
+          return;
+        }
+        std::atomic<size_t> next = 0;
+        const auto work = [&]() { for (size_t i = next++; i < count; i = next++) fn(i); };
+        std::mutex doneMutex;
+        std::condition_variable doneSignal;
+        size_t done = 0;
+        for (size_t i = 0; i < helpers; i++)
+        {
+          Post([&]
+          {
+            work();
+            // signalled under the lock, the loop returns and destroys both as soon as it sees the last one
+            std::lock_guard<std::mutex> lock(doneMutex);
+            done++;
+            doneSignal.notify_one();
+          });
+        }
+        work();
+        std::unique_lock<std::mutex> lock(doneMutex);
+        doneSignal.wait(lock, [&] { return done == helpers; });
+      }
+
+    private:
+      void run()
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (true)
+        {
+          _signal.wait(lock, [&] { return _stop || !_jobs.empty(); });
+          if (_jobs.empty()) return;
+          std::function<void()> job = std::move(_jobs.front());
+          _jobs.pop_front();
+          lock.unlock();
+          job();
+          lock.lock();
+        }
+      }
+
+      std::vector<std::thread> _threads;
+      std::mutex _mutex;
+      std::condition_variable _signal;
+      std::deque<std::function<void()>> _jobs;
+      bool _stop = false;
+  };
+
+}
@@ -0,0 +1,94 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <charconv>
+#include <functional>
+#include <cstdint>
+
+namespace webifc::parsing
+{
+
+  void p21encode(std::string_view input, std::string &output);
+
+  // Collects STEP text in a buffer of fixed capacity, handed to output whenever the next piece would not fit.
+  // Without an output the buffer grows instead, so a part of a file can be written apart and emitted later
+  class StepWriter
+  {
+    public:
+      StepWriter(const size_t capacity, const std::function<void(char *, size_t)> *output) : _capacity(capacity), _output(output)
+      {
+        _buffer.reserve(capacity);
+      }
+
+      void Put(const char c)
+      {
+        reserve(1);
+        _buffer.push_back(c);
+      }
+
+      void Put(const std::string_view text)
+      {
+        // text larger than the buffer goes to output as it is
+        if (_output != nullptr && text.size() > _capacity)
+        {
+          Flush();
+          (*_output)(const_cast<char*>(text.data()), text.size());
+          return;
+        }
+        reserve(text.size());
+        _buffer.append(text);
+      }
+
+      void PutNumber(const uint32_t value)
+      {
+        char digits[10];
+        reserve(sizeof(digits));
+        _buffer.append(digits, std::to_chars(digits, digits + sizeof(digits), value).ptr);
+      }
+
+      // the contents of a string argument, only text with quotes or characters outside printable ascii needs encoding
+      void PutEncoded(const std::string_view text)
+      {
+        for (const char c : text)
+        {
+          if (c > 126 || c < 32 || c == '\'')
+          {
+            _encoded.clear();
+            p21encode(text, _encoded);
+            Put(_encoded);
+            return;
+          }
+        }
+        Put(text);
+      }
+
+      void Flush()
+      {
+        if (_output == nullptr || _buffer.empty()) return;
+        (*_output)(_buffer.data(), _buffer.size());
+        _buffer.clear();
+      }
+
+      std::string &Buffer()
+      {
+        return _buffer;
+      }
+
+    private:
+      void reserve(const size_t size)
+      {
+        if (_output != nullptr && _buffer.size() + size > _capacity) Flush();
+      }
+
+      const size_t _capacity;
+      const std::function<void(char *, size_t)> *_output;
+      std::string _buffer;
+      std::string _encoded;
+  };
+
+}
@@ -15,15 +15,19 @@ namespace webifc::parsing {
 
     bool foundRoman = false;
 
-    void encodeCharacters(std::ostringstream &stream,std::string &data) 
+    void encodeCharacters(std::string &output,std::string &data) 
     {
+        static constexpr char HEX_DIGITS[] = "0123456789ABCDEF";
         std::u16string utf16 = std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t>{}.from_bytes(data.data());
-        stream << "\\X2\\" << std::hex <<std::setfill('0') << std::uppercase;
-        for (char16_t uC : utf16) stream << std::setw(4) << static_cast<int>(uC);
-        stream << std::dec<< std::setw(0) << "\\X0\\";
+        output += "\\X2\\";
+        for (char16_t uC : utf16) 
+        {
+          for (int shift = 12; shift >= 0; shift -= 4) output += HEX_DIGITS[(uC >> shift) & 0xF];
+        }
+        output += "\\X0\\";
     }
 
-    void p21encode(std::string_view input, std::ostringstream &output)
+    void p21encode(std::string_view input, std::string &output)
     {   
         std::string tmp;
         bool inEncode=false;
@@ -44,11 +48,12 @@ namespace webifc::parsing {
                 inEncode=false;
                 tmp.clear();
             } else if (c==39) {
-                output << c << c;
+                output += c;
+                output += c;
                 continue;
             }
           }
-          output << c;
+          output += c;
         }
         if (inEncode) encodeCharacters(output,tmp);
     }
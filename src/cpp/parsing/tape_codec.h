@@ -0,0 +1,122 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// A small LZ77 byte codec in the style of LZ4, used to keep evicted tape chunks in memory.
+// Tapes repeat the same type labels and token patterns over and over, which this finds cheaply.
+// A block is a sequence of [token][literal length][literals][offset][match length], where the token
+// holds the literal length in its high nibble and the match length minus 4 in its low nibble, each
+// continued in extra bytes of 255 when the nibble is 15. The last sequence has no match.
+
+namespace webifc::parsing::codec
+{
+
+  constexpr size_t MIN_MATCH = 4;
+  constexpr size_t HASH_BITS = 14;
+  constexpr size_t MAX_OFFSET = 65535;
+
+  inline uint32_t Hash(const uint8_t *p)
+  {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return (v * 2654435761u) >> (32 - HASH_BITS);
+  }
+
+  inline void PutLength(std::vector<uint8_t> &out, size_t length)
+  {
+    while (length >= 255)
+    {
+      out.push_back(255);
+      length -= 255;
+    }
+    out.push_back(static_cast<uint8_t>(length));
+  }
+
+  inline std::vector<uint8_t> Compress(const uint8_t *data, const size_t size)
+  {
+    std::vector<uint8_t> out;
+    out.reserve(size / 2 + 16);
+    std::vector<uint32_t> table(size_t(1) << HASH_BITS, 0);
+    size_t anchor = 0;
+    size_t pos = 0;
+
+    const auto emit = [&](const size_t literals, const size_t offset, const size_t matchLength)
+    {
+      const size_t extraMatch = matchLength >= MIN_MATCH ? matchLength - MIN_MATCH : 0;
+      uint8_t token = static_cast<uint8_t>((literals < 15 ? literals : 15) << 4);
+      if (offset != 0) token |= static_cast<uint8_t>(extraMatch < 15 ? extraMatch : 15);
+      out.push_back(token);
+      if (literals >= 15) PutLength(out, literals - 15);
+      out.insert(out.end(), data + anchor, data + anchor + literals);
+      if (offset == 0) return;
+      out.push_back(static_cast<uint8_t>(offset & 0xFF));
+      out.push_back(static_cast<uint8_t>(offset >> 8));
+      if (extraMatch >= 15) PutLength(out, extraMatch - 15);
+    };
+
+    while (size >= MIN_MATCH && pos + MIN_MATCH <= size)
+    {
+      const uint32_t h = Hash(data + pos);
+      const size_t candidate = table[h];
+      table[h] = static_cast<uint32_t>(pos);
+      if (candidate < pos && pos - candidate <= MAX_OFFSET && std::memcmp(data + candidate, data + pos, MIN_MATCH) == 0)
+      {
+        size_t length = MIN_MATCH;
+        while (pos + length < size && data[candidate + length] == data[pos + length]) length++;
+        emit(pos - anchor, pos - candidate, length);
+        pos += length;
+        anchor = pos;
+        continue;
+      }
+      pos++;
+    }
+    emit(size - anchor, 0, 0);
+    return out;
+  }
+
+  // returns false when the block does not decode to exactly size bytes
+  inline bool Decompress(const uint8_t *data, const size_t size, uint8_t *out, const size_t outSize)
+  {
+    size_t in = 0;
+    size_t pos = 0;
+    const auto getLength = [&](size_t length) -> size_t
+    {
+      if (length != 15) return length;
+      while (in < size)
+      {
+        const uint8_t extra = data[in++];
+        length += extra;
+        if (extra != 255) break;
+      }
+      return length;
+    };
+
+    while (in < size)
+    {
+      const uint8_t token = data[in++];
+      const size_t literals = getLength(token >> 4);
+      if (in + literals > size || pos + literals > outSize) return false;
+      std::memcpy(out + pos, data + in, literals);
+      in += literals;
+      pos += literals;
+      if (in == size) break;
+
+      if (in + 2 > size) return false;
+      const size_t offset = data[in] | (size_t(data[in + 1]) << 8);
+      in += 2;
+      const size_t length = getLength(token & 0x0F) + MIN_MATCH;
+      if (offset == 0 || offset > pos || pos + length > outSize) return false;
+      // matches may overlap their own output, so copy forward one byte at a time
+      for (size_t i = 0; i < length; i++, pos++) out[pos] = out[pos - offset];
+    }
+    return pos == outSize;
+  }
+
+}
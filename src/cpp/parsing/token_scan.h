@@ -0,0 +1,164 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#elif defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#endif
+
+// Block scanners used by the tokenizer. Each one returns the length of the
+// run of characters of a given class at the start of [data, data + size),
+// examining 32 (AVX2) or 16 (SSE2, wasm simd128) bytes per step with a
+// scalar loop for the tail and for targets without SIMD.
+
+namespace webifc::parsing::scan
+{
+
+  inline bool IsWhitespace(const char c)
+  {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+  }
+
+  inline bool IsDigit(const char c)
+  {
+    return c >= '0' && c <= '9';
+  }
+
+  inline bool IsNumberChar(const char c)
+  {
+    return IsDigit(c) || c == '.' || c == 'e' || c == 'E' || c == '-' || c == '+';
+  }
+
+  inline bool IsLabelChar(const char c)
+  {
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || IsDigit(c) || c == '_';
+  }
+
+  inline uint32_t FirstSetBit(uint32_t mask)
+  {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return index;
+#else
+    return __builtin_ctz(mask);
+#endif
+  }
+
+#if defined(__AVX2__)
+
+  constexpr size_t BLOCK = 32;
+  using Block = __m256i;
+  inline Block Load(const char *p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+  inline Block Splat(const char c) { return _mm256_set1_epi8(c); }
+  inline Block Eq(Block a, const char c) { return _mm256_cmpeq_epi8(a, Splat(c)); }
+  inline Block Or(Block a, Block b) { return _mm256_or_si256(a, b); }
+  inline Block InRange(Block a, const char lo, const char hi) { return _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_max_epu8(a, Splat(lo)), a), _mm256_cmpeq_epi8(_mm256_min_epu8(a, Splat(hi)), a)); }
+  inline uint32_t Mask(Block a) { return static_cast<uint32_t>(_mm256_movemask_epi8(a)); }
+  #define WEBIFC_SIMD_SCAN 1
+
+#elif defined(__SSE2__) || defined(_M_X64)
+
+  constexpr size_t BLOCK = 16;
+  using Block = __m128i;
+  inline Block Load(const char *p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+  inline Block Splat(const char c) { return _mm_set1_epi8(c); }
+  inline Block Eq(Block a, const char c) { return _mm_cmpeq_epi8(a, Splat(c)); }
+  inline Block Or(Block a, Block b) { return _mm_or_si128(a, b); }
+  inline Block InRange(Block a, const char lo, const char hi) { return _mm_and_si128(_mm_cmpeq_epi8(_mm_max_epu8(a, Splat(lo)), a), _mm_cmpeq_epi8(_mm_min_epu8(a, Splat(hi)), a)); }
+  inline uint32_t Mask(Block a) { return static_cast<uint32_t>(_mm_movemask_epi8(a)); }
+  #define WEBIFC_SIMD_SCAN 1
+
+#elif defined(__wasm_simd128__)
+
+  constexpr size_t BLOCK = 16;
+  using Block = v128_t;
+  inline Block Load(const char *p) { return wasm_v128_load(p); }
+  inline Block Splat(const char c) { return wasm_i8x16_splat(c); }
+  inline Block Eq(Block a, const char c) { return wasm_i8x16_eq(a, Splat(c)); }
+  inline Block Or(Block a, Block b) { return wasm_v128_or(a, b); }
+  inline Block InRange(Block a, const char lo, const char hi) { return wasm_v128_and(wasm_u8x16_ge(a, Splat(lo)), wasm_u8x16_le(a, Splat(hi))); }
+  inline uint32_t Mask(Block a) { return static_cast<uint32_t>(wasm_i8x16_bitmask(a)); }
+  #define WEBIFC_SIMD_SCAN 1
+
+#endif
+
+  // length of the run at the start of data for which inClass(block) marks every byte,
+  // falling back to the scalar predicate for the last partial block
+  template <typename BlockClass, typename CharClass>
+  inline size_t Run(const char *data, const size_t size, BlockClass inClass, CharClass isClass)
+  {
+    size_t i = 0;
+#ifdef WEBIFC_SIMD_SCAN
+    constexpr uint32_t full = BLOCK == 32 ? 0xFFFFFFFFu : 0xFFFFu;
+    for (; i + BLOCK <= size; i += BLOCK)
+    {
+      uint32_t outside = ~Mask(inClass(Load(data + i))) & full;
+      if (outside != 0) return i + FirstSetBit(outside);
+    }
+#else
+    (void)inClass;
+#endif
+    while (i < size && isClass(data[i])) i++;
+    return i;
+  }
+
+  inline size_t Whitespace(const char *data, const size_t size)
+  {
+    return Run(data, size, [](auto b) { return Or(Or(Eq(b, ' '), Eq(b, '\n')), Or(Eq(b, '\r'), Eq(b, '\t'))); }, IsWhitespace);
+  }
+
+  inline size_t Digits(const char *data, const size_t size)
+  {
+    return Run(data, size, [](auto b) { return InRange(b, '0', '9'); }, IsDigit);
+  }
+
+  inline size_t Number(const char *data, const size_t size)
+  {
+    return Run(data, size, [](auto b) { return Or(Or(InRange(b, '0', '9'), Or(Eq(b, '.'), Eq(b, 'e'))), Or(Eq(b, 'E'), Or(Eq(b, '-'), Eq(b, '+')))); }, IsNumberChar);
+  }
+
+  inline size_t Label(const char *data, const size_t size)
+  {
+    return Run(data, size, [](auto b) { return Or(Or(InRange(b, 'A', 'Z'), InRange(b, 'a', 'z')), Or(InRange(b, '0', '9'), Eq(b, '_'))); }, IsLabelChar);
+  }
+
+  // length of the run that does not contain c, i.e. the offset of the first c or size
+  inline size_t Until(const char *data, const size_t size, const char c)
+  {
+    size_t i = 0;
+#ifdef WEBIFC_SIMD_SCAN
+    for (; i + BLOCK <= size; i += BLOCK)
+    {
+      uint32_t found = Mask(Eq(Load(data + i), c));
+      if (found != 0) return i + FirstSetBit(found);
+    }
+#endif
+    while (i < size && data[i] != c) i++;
+    return i;
+  }
+
+  // offset of the first of a, b or c, or size
+  inline size_t UntilAny(const char *data, const size_t size, const char a, const char b, const char c)
+  {
+    size_t i = 0;
+#ifdef WEBIFC_SIMD_SCAN
+    for (; i + BLOCK <= size; i += BLOCK)
+    {
+      Block block = Load(data + i);
+      uint32_t found = Mask(Or(Eq(block, a), Or(Eq(block, b), Eq(block, c))));
+      if (found != 0) return i + FirstSetBit(found);
+    }
+#endif
+    while (i < size && data[i] != a && data[i] != b && data[i] != c) i++;
+    return i;
+  }
+
+}
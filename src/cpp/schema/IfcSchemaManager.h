@@ -5,28 +5,33 @@
 #pragma once
 
 #include "ifc-schema.h"
-#include <vector>
+#include <span>
+#include <string>
 #include <string_view>
-#include <unordered_set>
 #include <cstdint>
 
 
 namespace webifc::schema {
+    // all lookups go through tables the schema generator emits as constexpr data, so there is nothing to set up at runtime
     class IfcSchemaManager {
         public:
-            IfcSchemaManager();
-            const std::vector<IFC_SCHEMA> GetAvailableSchemas() const;
-            std::string_view GetSchemaName(IFC_SCHEMA schema) const;
-            uint32_t IfcTypeToTypeCode(const std::string_view name) const;
+            static std::span<const IFC_SCHEMA> GetAvailableSchemas();
+            static std::string_view GetSchemaName(const IFC_SCHEMA schema);
+            static uint32_t IfcTypeToTypeCode(const std::string_view name);
             std::string IfcTypeCodeToType(const uint32_t typeCode) const; 
-            bool IsIfcElement(const uint32_t typeCode) const;
-            const std::unordered_set<uint32_t> & GetIfcElementList() const;
+            // the type name as written in STEP files, empty for codes that are not part of the schemas
+            static std::string_view IfcTypeCodeToLabel(const uint32_t typeCode);
+            // dense index of a type in [0, SCHEMA_TYPE_COUNT), SCHEMA_TYPE_COUNT for codes that are not part of the schemas
+            static uint32_t IfcTypeCodeToOrdinal(const uint32_t typeCode);
+            static uint32_t IfcTypeOrdinalToTypeCode(const uint32_t ordinal);
+            static bool IsIfcElement(const uint32_t typeCode);
+            static std::span<const uint32_t> GetIfcElementList();
+            // the direct supertype of a type in a schema, 0 for root types and types the schema does not have
+            static uint32_t GetSupertype(const IFC_SCHEMA schema, const uint32_t typeCode);
+            // all direct and indirect subtypes of a type in a schema, sorted by type code
+            static std::span<const uint32_t> GetSubtypes(const IFC_SCHEMA schema, const uint32_t typeCode);
+            static bool IsA(const IFC_SCHEMA schema, const uint32_t typeCode, const uint32_t supertypeCode);
         private: 
-            std::vector<uint32_t> _crcTable;
-            std::unordered_set<uint32_t> _ifcElements;
-            std::vector<IFC_SCHEMA> _schemas;
-            std::vector<std::string_view> _schemaNames;
-            void initSchemaData();
-            uint32_t IfcTypeToTypeCode(const void * name, const size_t len) const;
+            static uint32_t IfcTypeToTypeCode(const void * name, const size_t len);
     };
 }
\ No newline at end of file
@@ -1142,6 +1142,7 @@ namespace webifc::schema {
 	static const unsigned int IFCTEMPERATURERATEOFCHANGEMEASURE = 1209108979;
 	static const unsigned int IFCTIME = 4075327185;
 	static const unsigned int IFCURIREFERENCE = 950732822;
+	static const unsigned int SCHEMA_TYPE_COUNT = 1140;
 }
 enum IFC_SCHEMA {
 IFC2X3,
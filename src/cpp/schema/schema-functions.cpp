@@ -1,1394 +1,1485 @@
-#include <unordered_set>
+#include <array>
 #include <string>
+#include <string_view>
 #include "ifc-schema.h"
 #include "IfcSchemaManager.h"
 namespace webifc::schema {
-void IfcSchemaManager::initSchemaData() {
-_ifcElements.insert(IFCPRODUCT);
-_ifcElements.insert(IFCPROXY);
-_ifcElements.insert(IFCSPATIALSTRUCTUREELEMENT);
-_ifcElements.insert(IFCSTRUCTURALACTIVITY);
-_ifcElements.insert(IFCSTRUCTURALITEM);
-_ifcElements.insert(IFCSTRUCTURALMEMBER);
-_ifcElements.insert(IFCSTRUCTURALREACTION);
-_ifcElements.insert(IFCSTRUCTURALSURFACEMEMBER);
-_ifcElements.insert(IFCSTRUCTURALSURFACEMEMBERVARYING);
-_ifcElements.insert(IFCANNOTATION);
-_ifcElements.insert(IFCBUILDING);
-_ifcElements.insert(IFCBUILDINGSTOREY);
-_ifcElements.insert(IFCELEMENT);
-_ifcElements.insert(IFCELEMENTASSEMBLY);
-_ifcElements.insert(IFCELEMENTCOMPONENT);
-_ifcElements.insert(IFCEQUIPMENTELEMENT);
-_ifcElements.insert(IFCFASTENER);
-_ifcElements.insert(IFCFEATUREELEMENT);
-_ifcElements.insert(IFCFEATUREELEMENTADDITION);
-_ifcElements.insert(IFCFEATUREELEMENTSUBTRACTION);
-_ifcElements.insert(IFCFURNISHINGELEMENT);
-_ifcElements.insert(IFCGRID);
-_ifcElements.insert(IFCMECHANICALFASTENER);
-_ifcElements.insert(IFCOPENINGELEMENT);
-_ifcElements.insert(IFCPORT);
-_ifcElements.insert(IFCPROJECTIONELEMENT);
-_ifcElements.insert(IFCSITE);
-_ifcElements.insert(IFCSPACE);
-_ifcElements.insert(IFCSTRUCTURALACTION);
-_ifcElements.insert(IFCSTRUCTURALCONNECTION);
-_ifcElements.insert(IFCSTRUCTURALCURVECONNECTION);
-_ifcElements.insert(IFCSTRUCTURALCURVEMEMBER);
-_ifcElements.insert(IFCSTRUCTURALCURVEMEMBERVARYING);
-_ifcElements.insert(IFCSTRUCTURALLINEARACTION);
-_ifcElements.insert(IFCSTRUCTURALLINEARACTIONVARYING);
-_ifcElements.insert(IFCSTRUCTURALPLANARACTION);
-_ifcElements.insert(IFCSTRUCTURALPLANARACTIONVARYING);
-_ifcElements.insert(IFCSTRUCTURALPOINTACTION);
-_ifcElements.insert(IFCSTRUCTURALPOINTCONNECTION);
-_ifcElements.insert(IFCSTRUCTURALPOINTREACTION);
-_ifcElements.insert(IFCSTRUCTURALSURFACECONNECTION);
-_ifcElements.insert(IFCTRANSPORTELEMENT);
-_ifcElements.insert(IFCVIRTUALELEMENT);
-_ifcElements.insert(IFCBUILDINGELEMENT);
-_ifcElements.insert(IFCBUILDINGELEMENTCOMPONENT);
-_ifcElements.insert(IFCBUILDINGELEMENTPART);
-_ifcElements.insert(IFCBUILDINGELEMENTPROXY);
-_ifcElements.insert(IFCCOLUMN);
-_ifcElements.insert(IFCCOVERING);
-_ifcElements.insert(IFCCURTAINWALL);
-_ifcElements.insert(IFCDISCRETEACCESSORY);
-_ifcElements.insert(IFCDISTRIBUTIONELEMENT);
-_ifcElements.insert(IFCDISTRIBUTIONFLOWELEMENT);
-_ifcElements.insert(IFCDISTRIBUTIONPORT);
-_ifcElements.insert(IFCDOOR);
-_ifcElements.insert(IFCEDGEFEATURE);
-_ifcElements.insert(IFCELECTRICALELEMENT);
-_ifcElements.insert(IFCENERGYCONVERSIONDEVICE);
-_ifcElements.insert(IFCFLOWCONTROLLER);
-_ifcElements.insert(IFCFLOWFITTING);
-_ifcElements.insert(IFCFLOWMOVINGDEVICE);
-_ifcElements.insert(IFCFLOWSEGMENT);
-_ifcElements.insert(IFCFLOWSTORAGEDEVICE);
-_ifcElements.insert(IFCFLOWTERMINAL);
-_ifcElements.insert(IFCFLOWTREATMENTDEVICE);
-_ifcElements.insert(IFCFOOTING);
-_ifcElements.insert(IFCMEMBER);
-_ifcElements.insert(IFCPILE);
-_ifcElements.insert(IFCPLATE);
-_ifcElements.insert(IFCRAILING);
-_ifcElements.insert(IFCRAMP);
-_ifcElements.insert(IFCRAMPFLIGHT);
-_ifcElements.insert(IFCREINFORCINGELEMENT);
-_ifcElements.insert(IFCREINFORCINGMESH);
-_ifcElements.insert(IFCROOF);
-_ifcElements.insert(IFCROUNDEDEDGEFEATURE);
-_ifcElements.insert(IFCSLAB);
-_ifcElements.insert(IFCSTAIR);
-_ifcElements.insert(IFCSTAIRFLIGHT);
-_ifcElements.insert(IFCTENDON);
-_ifcElements.insert(IFCTENDONANCHOR);
-_ifcElements.insert(IFCWALL);
-_ifcElements.insert(IFCWALLSTANDARDCASE);
-_ifcElements.insert(IFCWINDOW);
-_ifcElements.insert(IFCBEAM);
-_ifcElements.insert(IFCCHAMFEREDGEFEATURE);
-_ifcElements.insert(IFCDISTRIBUTIONCHAMBERELEMENT);
-_ifcElements.insert(IFCDISTRIBUTIONCONTROLELEMENT);
-_ifcElements.insert(IFCELECTRICDISTRIBUTIONPOINT);
-_ifcElements.insert(IFCREINFORCINGBAR);
-_ifcElements.insert(IFCSPATIALELEMENT);
-_ifcElements.insert(IFCSPATIALZONE);
-_ifcElements.insert(IFCSTRUCTURALSURFACEREACTION);
-_ifcElements.insert(IFCEXTERNALSPATIALSTRUCTUREELEMENT);
-_ifcElements.insert(IFCFURNITURE);
-_ifcElements.insert(IFCGEOGRAPHICELEMENT);
-_ifcElements.insert(IFCOPENINGSTANDARDCASE);
-_ifcElements.insert(IFCSTRUCTURALCURVEACTION);
-_ifcElements.insert(IFCSTRUCTURALCURVEREACTION);
-_ifcElements.insert(IFCSTRUCTURALSURFACEACTION);
-_ifcElements.insert(IFCSURFACEFEATURE);
-_ifcElements.insert(IFCSYSTEMFURNITUREELEMENT);
-_ifcElements.insert(IFCVIBRATIONISOLATOR);
-_ifcElements.insert(IFCVOIDINGFEATURE);
-_ifcElements.insert(IFCCHIMNEY);
-_ifcElements.insert(IFCCIVILELEMENT);
-_ifcElements.insert(IFCCOLUMNSTANDARDCASE);
-_ifcElements.insert(IFCDOORSTANDARDCASE);
-_ifcElements.insert(IFCENGINE);
-_ifcElements.insert(IFCEVAPORATIVECOOLER);
-_ifcElements.insert(IFCEVAPORATOR);
-_ifcElements.insert(IFCEXTERNALSPATIALELEMENT);
-_ifcElements.insert(IFCFLOWMETER);
-_ifcElements.insert(IFCHEATEXCHANGER);
-_ifcElements.insert(IFCHUMIDIFIER);
-_ifcElements.insert(IFCINTERCEPTOR);
-_ifcElements.insert(IFCJUNCTIONBOX);
-_ifcElements.insert(IFCLAMP);
-_ifcElements.insert(IFCLIGHTFIXTURE);
-_ifcElements.insert(IFCMEDICALDEVICE);
-_ifcElements.insert(IFCMEMBERSTANDARDCASE);
-_ifcElements.insert(IFCMOTORCONNECTION);
-_ifcElements.insert(IFCOUTLET);
-_ifcElements.insert(IFCPIPEFITTING);
-_ifcElements.insert(IFCPIPESEGMENT);
-_ifcElements.insert(IFCPLATESTANDARDCASE);
-_ifcElements.insert(IFCPROTECTIVEDEVICE);
-_ifcElements.insert(IFCPUMP);
-_ifcElements.insert(IFCSANITARYTERMINAL);
-_ifcElements.insert(IFCSHADINGDEVICE);
-_ifcElements.insert(IFCSLABELEMENTEDCASE);
-_ifcElements.insert(IFCSLABSTANDARDCASE);
-_ifcElements.insert(IFCSOLARDEVICE);
-_ifcElements.insert(IFCSPACEHEATER);
-_ifcElements.insert(IFCSTACKTERMINAL);
-_ifcElements.insert(IFCSWITCHINGDEVICE);
-_ifcElements.insert(IFCTANK);
-_ifcElements.insert(IFCTRANSFORMER);
-_ifcElements.insert(IFCTUBEBUNDLE);
-_ifcElements.insert(IFCUNITARYEQUIPMENT);
-_ifcElements.insert(IFCVALVE);
-_ifcElements.insert(IFCWALLELEMENTEDCASE);
-_ifcElements.insert(IFCWASTETERMINAL);
-_ifcElements.insert(IFCWINDOWSTANDARDCASE);
-_ifcElements.insert(IFCAIRTERMINAL);
-_ifcElements.insert(IFCAIRTERMINALBOX);
-_ifcElements.insert(IFCAIRTOAIRHEATRECOVERY);
-_ifcElements.insert(IFCAUDIOVISUALAPPLIANCE);
-_ifcElements.insert(IFCBEAMSTANDARDCASE);
-_ifcElements.insert(IFCBOILER);
-_ifcElements.insert(IFCBURNER);
-_ifcElements.insert(IFCCABLECARRIERFITTING);
-_ifcElements.insert(IFCCABLECARRIERSEGMENT);
-_ifcElements.insert(IFCCABLEFITTING);
-_ifcElements.insert(IFCCABLESEGMENT);
-_ifcElements.insert(IFCCHILLER);
-_ifcElements.insert(IFCCOIL);
-_ifcElements.insert(IFCCOMMUNICATIONSAPPLIANCE);
-_ifcElements.insert(IFCCOMPRESSOR);
-_ifcElements.insert(IFCCONDENSER);
-_ifcElements.insert(IFCCOOLEDBEAM);
-_ifcElements.insert(IFCCOOLINGTOWER);
-_ifcElements.insert(IFCDAMPER);
-_ifcElements.insert(IFCDUCTFITTING);
-_ifcElements.insert(IFCDUCTSEGMENT);
-_ifcElements.insert(IFCDUCTSILENCER);
-_ifcElements.insert(IFCELECTRICAPPLIANCE);
-_ifcElements.insert(IFCELECTRICDISTRIBUTIONBOARD);
-_ifcElements.insert(IFCELECTRICFLOWSTORAGEDEVICE);
-_ifcElements.insert(IFCELECTRICGENERATOR);
-_ifcElements.insert(IFCELECTRICMOTOR);
-_ifcElements.insert(IFCELECTRICTIMECONTROL);
-_ifcElements.insert(IFCFAN);
-_ifcElements.insert(IFCFILTER);
-_ifcElements.insert(IFCFIRESUPPRESSIONTERMINAL);
-_ifcElements.insert(IFCFLOWINSTRUMENT);
-_ifcElements.insert(IFCPROTECTIVEDEVICETRIPPINGUNIT);
-_ifcElements.insert(IFCSENSOR);
-_ifcElements.insert(IFCUNITARYCONTROLELEMENT);
-_ifcElements.insert(IFCACTUATOR);
-_ifcElements.insert(IFCALARM);
-_ifcElements.insert(IFCCONTROLLER);
-_ifcElements.insert(IFCFACILITY);
-_ifcElements.insert(IFCFACILITYPART);
-_ifcElements.insert(IFCFACILITYPARTCOMMON);
-_ifcElements.insert(IFCGEOTECHNICALELEMENT);
-_ifcElements.insert(IFCGEOTECHNICALSTRATUM);
-_ifcElements.insert(IFCIMPACTPROTECTIONDEVICE);
-_ifcElements.insert(IFCLINEARELEMENT);
-_ifcElements.insert(IFCMARINEFACILITY);
-_ifcElements.insert(IFCMARINEPART);
-_ifcElements.insert(IFCPOSITIONINGELEMENT);
-_ifcElements.insert(IFCRAILWAY);
-_ifcElements.insert(IFCRAILWAYPART);
-_ifcElements.insert(IFCREFERENT);
-_ifcElements.insert(IFCROAD);
-_ifcElements.insert(IFCROADPART);
-_ifcElements.insert(IFCSIGN);
-_ifcElements.insert(IFCTENDONCONDUIT);
-_ifcElements.insert(IFCTRANSPORTATIONDEVICE);
-_ifcElements.insert(IFCVEHICLE);
-_ifcElements.insert(IFCVIBRATIONDAMPER);
-_ifcElements.insert(IFCALIGNMENTCANT);
-_ifcElements.insert(IFCALIGNMENTHORIZONTAL);
-_ifcElements.insert(IFCALIGNMENTSEGMENT);
-_ifcElements.insert(IFCALIGNMENTVERTICAL);
-_ifcElements.insert(IFCBRIDGE);
-_ifcElements.insert(IFCBRIDGEPART);
-_ifcElements.insert(IFCBUILTELEMENT);
-_ifcElements.insert(IFCCOURSE);
-_ifcElements.insert(IFCDEEPFOUNDATION);
-_ifcElements.insert(IFCEARTHWORKSCUT);
-_ifcElements.insert(IFCEARTHWORKSELEMENT);
-_ifcElements.insert(IFCEARTHWORKSFILL);
-_ifcElements.insert(IFCGEOTECHNICALASSEMBLY);
-_ifcElements.insert(IFCKERB);
-_ifcElements.insert(IFCLINEARPOSITIONINGELEMENT);
-_ifcElements.insert(IFCLIQUIDTERMINAL);
-_ifcElements.insert(IFCMOBILETELECOMMUNICATIONSAPPLIANCE);
-_ifcElements.insert(IFCMOORINGDEVICE);
-_ifcElements.insert(IFCNAVIGATIONELEMENT);
-_ifcElements.insert(IFCPAVEMENT);
-_ifcElements.insert(IFCRAIL);
-_ifcElements.insert(IFCREINFORCEDSOIL);
-_ifcElements.insert(IFCSIGNAL);
-_ifcElements.insert(IFCTRACKELEMENT);
-_ifcElements.insert(IFCALIGNMENT);
-_ifcElements.insert(IFCBEARING);
-_ifcElements.insert(IFCBOREHOLE);
-_ifcElements.insert(IFCCAISSONFOUNDATION);
-_ifcElements.insert(IFCCONVEYORSEGMENT);
-_ifcElements.insert(IFCDISTRIBUTIONBOARD);
-_ifcElements.insert(IFCELECTRICFLOWTREATMENTDEVICE);
-_ifcElements.insert(IFCGEOMODEL);
-_ifcElements.insert(IFCGEOSLICE);
-_schemaNames.push_back("IFC2X3");
-_schemas.push_back(IFC2X3);
-_schemaNames.push_back("IFC4");
-_schemas.push_back(IFC4);
-_schemaNames.push_back("IFC4X3");
-_schemas.push_back(IFC4X3);
+namespace {
+struct SchemaType { uint32_t typeCode; std::string_view name; std::string_view label; bool element; std::array<uint32_t, 3> supertypes; };
+// sorted by type code, the index of a type is its ordinal
+constexpr std::array<SchemaType, SCHEMA_TYPE_COUNT> SCHEMA_TYPES = {{
+{IFCTANKTYPE, "IfcTankType", "IFCTANKTYPE", false, {IFCFLOWSTORAGEDEVICETYPE, IFCFLOWSTORAGEDEVICETYPE, IFCFLOWSTORAGEDEVICETYPE}},
+{IFCCOMPOSITECURVEONSURFACE, "IfcCompositeCurveOnSurface", "IFCCOMPOSITECURVEONSURFACE", false, {0, IFCCOMPOSITECURVE, IFCCOMPOSITECURVE}},
+{IFCFACILITY, "IfcFacility", "IFCFACILITY", true, {0, 0, IFCSPATIALSTRUCTUREELEMENT}},
+{IFCELECTRICFLOWTREATMENTDEVICE, "IfcElectricFlowTreatmentDevice", "IFCELECTRICFLOWTREATMENTDEVICE", true, {0, 0, IFCFLOWTREATMENTDEVICE}},
+{IFCCONTROLLER, "IfcController", "IFCCONTROLLER", true, {0, IFCDISTRIBUTIONCONTROLELEMENT, IFCDISTRIBUTIONCONTROLELEMENT}},
+{IFCLOCALTIME, "IfcLocalTime", "IFCLOCALTIME", false, {0, 0, 0}},
+{IFCBOILER, "IfcBoiler", "IFCBOILER", true, {0, IFCENERGYCONVERSIONDEVICE, IFCENERGYCONVERSIONDEVICE}},
+{IFCDIRECTION, "IfcDirection", "IFCDIRECTION", false, {IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM}},
+{IFCSIGN, "IfcSign", "IFCSIGN", true, {0, 0, IFCELEMENTCOMPONENT}},
+{IFCBUILDINGELEMENTPARTTYPE, "IfcBuildingElementPartType", "IFCBUILDINGELEMENTPARTTYPE", false, {0, IFCELEMENTCOMPONENTTYPE, IFCELEMENTCOMPONENTTYPE}},
+{IFCSINESPIRAL, "IfcSineSpiral", "IFCSINESPIRAL", false, {0, 0, IFCSPIRAL}},
+{IFCCONNECTIONPOINTECCENTRICITY, "IfcConnectionPointEccentricity", "IFCCONNECTIONPOINTECCENTRICITY", false, {IFCCONNECTIONPOINTGEOMETRY, IFCCONNECTIONPOINTGEOMETRY, IFCCONNECTIONPOINTGEOMETRY}},
+{IFCWARPINGCONSTANTMEASURE, "IfcWarpingConstantMeasure", "IFCWARPINGCONSTANTMEASURE", false, {0, 0, 0}},
+{IFCBUILDINGELEMENTCOMPONENT, "IfcBuildingElementComponent", "IFCBUILDINGELEMENTCOMPONENT", true, {IFCBUILDINGELEMENT, 0, 0}},
+{IFCTEMPERATUREGRADIENTMEASURE, "IfcTemperatureGradientMeasure", "IFCTEMPERATUREGRADIENTMEASURE", false, {0, 0, 0}},
+{IFCCARTESIANTRANSFORMATIONOPERATOR, "IfcCartesianTransformationOperator", "IFCCARTESIANTRANSFORMATIONOPERATOR", false, {IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM}},
+{IFCDYNAMICVISCOSITYMEASURE, "IfcDynamicViscosityMeasure", "IFCDYNAMICVISCOSITYMEASURE", false, {0, 0, 0}},
+{IFCLAMP, "IfcLamp", "IFCLAMP", true, {0, IFCFLOWTERMINAL, IFCFLOWTERMINAL}},
+{IFCENERGYPROPERTIES, "IfcEnergyProperties", "IFCENERGYPROPERTIES", false, {IFCPROPERTYSETDEFINITION, 0, 0}},
+{IFCDAYINMONTHNUMBER, "IfcDayInMonthNumber", "IFCDAYINMONTHNUMBER", false, {0, 0, 0}},
+{IFCPUMP, "IfcPump", "IFCPUMP", true, {0, IFCFLOWMOVINGDEVICE, IFCFLOWMOVINGDEVICE}},
+{IFCCURVATUREMEASURE, "IfcCurvatureMeasure", "IFCCURVATUREMEASURE", false, {0, 0, 0}},
+{IFCRATIOMEASURE, "IfcRatioMeasure", "IFCRATIOMEASURE", false, {0, 0, 0}},
+{IFCPERSONANDORGANIZATION, "IfcPersonAndOrganization", "IFCPERSONANDORGANIZATION", false, {0, 0, 0}},
+{IFCMINUTEINHOUR, "IfcMinuteInHour", "IFCMINUTEINHOUR", false, {0, 0, 0}},
+{IFCPROJECT, "IfcProject", "IFCPROJECT", false, {IFCOBJECT, IFCCONTEXT, IFCCONTEXT}},
+{IFCPROPERTYTABLEVALUE, "IfcPropertyTableValue", "IFCPROPERTYTABLEVALUE", false, {IFCSIMPLEPROPERTY, IFCSIMPLEPROPERTY, IFCSIMPLEPROPERTY}},
+{IFCLIGHTSOURCEAMBIENT, "IfcLightSourceAmbient", "IFCLIGHTSOURCEAMBIENT", false, {IFCLIGHTSOURCE, IFCLIGHTSOURCE, IFCLIGHTSOURCE}},
+{IFCAPPROVAL, "IfcApproval", "IFCAPPROVAL", false, {0, 0, 0}},
+{IFCENGINETYPE, "IfcEngineType", "IFCENGINETYPE", false, {0, IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE}},
+{IFCOUTERBOUNDARYCURVE, "IfcOuterBoundaryCurve", "IFCOUTERBOUNDARYCURVE", false, {0, IFCBOUNDARYCURVE, IFCBOUNDARYCURVE}},
+{IFCROAD, "IfcRoad", "IFCROAD", true, {0, 0, IFCFACILITY}},
+{IFCSUBCONTRACTRESOURCE, "IfcSubContractResource", "IFCSUBCONTRACTRESOURCE", false, {IFCCONSTRUCTIONRESOURCE, IFCCONSTRUCTIONRESOURCE, IFCCONSTRUCTIONRESOURCE}},
+{IFCPROPERTYDEPENDENCYRELATIONSHIP, "IfcPropertyDependencyRelationship", "IFCPROPERTYDEPENDENCYRELATIONSHIP", false, {0, IFCRESOURCELEVELRELATIONSHIP, IFCRESOURCELEVELRELATIONSHIP}},
+{IFCLUMINOUSINTENSITYMEASURE, "IfcLuminousIntensityMeasure", "IFCLUMINOUSINTENSITYMEASURE", false, {0, 0, 0}},
+{IFCRELAGGREGATES, "IfcRelAggregates", "IFCRELAGGREGATES", false, {IFCRELDECOMPOSES, IFCRELDECOMPOSES, IFCRELDECOMPOSES}},
+{IFCMATERIALPROFILESET, "IfcMaterialProfileSet", "IFCMATERIALPROFILESET", false, {0, IFCMATERIALDEFINITION, IFCMATERIALDEFINITION}},
+{IFCBSPLINESURFACEWITHKNOTS, "IfcBSplineSurfaceWithKnots", "IFCBSPLINESURFACEWITHKNOTS", false, {0, IFCBSPLINESURFACE, IFCBSPLINESURFACE}},
+{IFCAIRTERMINALBOX, "IfcAirTerminalBox", "IFCAIRTERMINALBOX", true, {0, IFCFLOWCONTROLLER, IFCFLOWCONTROLLER}},
+{IFCGRIDPLACEMENT, "IfcGridPlacement", "IFCGRIDPLACEMENT", false, {IFCOBJECTPLACEMENT, IFCOBJECTPLACEMENT, IFCOBJECTPLACEMENT}},
+{IFCINDEXEDPOLYGONALFACE, "IfcIndexedPolygonalFace", "IFCINDEXEDPOLYGONALFACE", false, {0, IFCTESSELLATEDITEM, IFCTESSELLATEDITEM}},
+{IFCPREDEFINEDPOINTMARKERSYMBOL, "IfcPreDefinedPointMarkerSymbol", "IFCPREDEFINEDPOINTMARKERSYMBOL", false, {IFCPREDEFINEDSYMBOL, 0, 0}},
+{IFCUNITASSIGNMENT, "IfcUnitAssignment", "IFCUNITASSIGNMENT", false, {0, 0, 0}},
+{IFCOPENCROSSPROFILEDEF, "IfcOpenCrossProfileDef", "IFCOPENCROSSPROFILEDEF", false, {0, 0, IFCPROFILEDEF}},
+{IFCFLOWINSTRUMENT, "IfcFlowInstrument", "IFCFLOWINSTRUMENT", true, {0, IFCDISTRIBUTIONCONTROLELEMENT, IFCDISTRIBUTIONCONTROLELEMENT}},
+{IFCLINEARFORCEMEASURE, "IfcLinearForceMeasure", "IFCLINEARFORCEMEASURE", false, {0, 0, 0}},
+{IFCCRANERAILFSHAPEPROFILEDEF, "IfcCraneRailFShapeProfileDef", "IFCCRANERAILFSHAPEPROFILEDEF", false, {IFCPARAMETERIZEDPROFILEDEF, 0, 0}},
+{IFCGASTERMINALTYPE, "IfcGasTerminalType", "IFCGASTERMINALTYPE", false, {IFCFLOWTERMINALTYPE, 0, 0}},
+{IFCREAL, "IfcReal", "IFCREAL", false, {0, 0, 0}},
+{IFCRELOVERRIDESPROPERTIES, "IfcRelOverridesProperties", "IFCRELOVERRIDESPROPERTIES", false, {IFCRELDEFINESBYPROPERTIES, 0, 0}},
+{IFCRELASSIGNSTORESOURCE, "IfcRelAssignsToResource", "IFCRELASSIGNSTORESOURCE", false, {IFCRELASSIGNS, IFCRELASSIGNS, IFCRELASSIGNS}},
+{IFCEVENTTIME, "IfcEventTime", "IFCEVENTTIME", false, {0, IFCSCHEDULINGTIME, IFCSCHEDULINGTIME}},
+{IFCSTRUCTURALCURVEMEMBER, "IfcStructuralCurveMember", "IFCSTRUCTURALCURVEMEMBER", true, {IFCSTRUCTURALMEMBER, IFCSTRUCTURALMEMBER, IFCSTRUCTURALMEMBER}},
+{IFCOBJECTDEFINITION, "IfcObjectDefinition", "IFCOBJECTDEFINITION", false, {IFCROOT, IFCROOT, IFCROOT}},
+{IFCPLANE, "IfcPlane", "IFCPLANE", false, {IFCELEMENTARYSURFACE, IFCELEMENTARYSURFACE, IFCELEMENTARYSURFACE}},
+{IFCTEXTURECOORDINATEINDICES, "IfcTextureCoordinateIndices", "IFCTEXTURECOORDINATEINDICES", false, {0, 0, 0}},
+{IFCSWEPTSURFACE, "IfcSweptSurface", "IFCSWEPTSURFACE", false, {IFCSURFACE, IFCSURFACE, IFCSURFACE}},
+{IFCBOILERTYPE, "IfcBoilerType", "IFCBOILERTYPE", false, {IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE}},
+{IFCTHERMALADMITTANCEMEASURE, "IfcThermalAdmittanceMeasure", "IFCTHERMALADMITTANCEMEASURE", false, {0, 0, 0}},
+{IFCMOORINGDEVICE, "IfcMooringDevice", "IFCMOORINGDEVICE", true, {0, 0, IFCBUILTELEMENT}},
+{IFCMATERIALLAYER, "IfcMaterialLayer", "IFCMATERIALLAYER", false, {0, IFCMATERIALDEFINITION, IFCMATERIALDEFINITION}},
+{IFCFURNISHINGELEMENT, "IfcFurnishingElement", "IFCFURNISHINGELEMENT", true, {IFCELEMENT, IFCELEMENT, IFCELEMENT}},
+{IFCELECTRICGENERATOR, "IfcElectricGenerator", "IFCELECTRICGENERATOR", true, {0, IFCENERGYCONVERSIONDEVICE, IFCENERGYCONVERSIONDEVICE}},
+{IFCAUDIOVISUALAPPLIANCE, "IfcAudioVisualAppliance", "IFCAUDIOVISUALAPPLIANCE", true, {0, IFCFLOWTERMINAL, IFCFLOWTERMINAL}},
+{IFCRELFLOWCONTROLELEMENTS, "IfcRelFlowControlElements", "IFCRELFLOWCONTROLELEMENTS", false, {IFCRELCONNECTS, IFCRELCONNECTS, IFCRELCONNECTS}},
+{IFCTEXTURECOORDINATE, "IfcTextureCoordinate", "IFCTEXTURECOORDINATE", false, {0, IFCPRESENTATIONITEM, IFCPRESENTATIONITEM}},
+{IFCMAGNETICFLUXDENSITYMEASURE, "IfcMagneticFluxDensityMeasure", "IFCMAGNETICFLUXDENSITYMEASURE", false, {0, 0, 0}},
+{IFCTEXTTRANSFORMATION, "IfcTextTransformation", "IFCTEXTTRANSFORMATION", false, {0, 0, 0}},
+{IFCEXTENDEDPROPERTIES, "IfcExtendedProperties", "IFCEXTENDEDPROPERTIES", false, {0, IFCPROPERTYABSTRACTION, IFCPROPERTYABSTRACTION}},
+{IFCDAYLIGHTSAVINGHOUR, "IfcDaylightSavingHour", "IFCDAYLIGHTSAVINGHOUR", false, {0, 0, 0}},
+{IFCCOLUMNTYPE, "IfcColumnType", "IFCCOLUMNTYPE", false, {IFCBUILDINGELEMENTTYPE, IFCBUILDINGELEMENTTYPE, IFCBUILTELEMENTTYPE}},
+{IFCRELDEFINESBYTEMPLATE, "IfcRelDefinesByTemplate", "IFCRELDEFINESBYTEMPLATE", false, {0, IFCRELDEFINES, IFCRELDEFINES}},
+{IFCPIPEFITTING, "IfcPipeFitting", "IFCPIPEFITTING", true, {0, IFCFLOWFITTING, IFCFLOWFITTING}},
+{IFCFILLAREASTYLETILES, "IfcFillAreaStyleTiles", "IFCFILLAREASTYLETILES", false, {IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM}},
+{IFCALIGNMENTSEGMENT, "IfcAlignmentSegment", "IFCALIGNMENTSEGMENT", true, {0, 0, IFCLINEARELEMENT}},
+{IFCALIGNMENT, "IfcAlignment", "IFCALIGNMENT", true, {0, 0, IFCLINEARPOSITIONINGELEMENT}},
+{IFCSTAIR, "IfcStair", "IFCSTAIR", true, {IFCBUILDINGELEMENT, IFCBUILDINGELEMENT, IFCBUILTELEMENT}},
+{IFCCOOLEDBEAMTYPE, "IfcCooledBeamType", "IFCCOOLEDBEAMTYPE", false, {IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE}},
+{IFCWINDOWLININGPROPERTIES, "IfcWindowLiningProperties", "IFCWINDOWLININGPROPERTIES", false, {IFCPROPERTYSETDEFINITION, IFCPREDEFINEDPROPERTYSET, IFCPREDEFINEDPROPERTYSET}},
+{IFCSTAIRTYPE, "IfcStairType", "IFCSTAIRTYPE", false, {0, IFCBUILDINGELEMENTTYPE, IFCBUILTELEMENTTYPE}},
+{IFCELEMENTTYPE, "IfcElementType", "IFCELEMENTTYPE", false, {IFCTYPEPRODUCT, IFCTYPEPRODUCT, IFCTYPEPRODUCT}},
+{IFCDUCTFITTING, "IfcDuctFitting", "IFCDUCTFITTING", true, {0, IFCFLOWFITTING, IFCFLOWFITTING}},
+{IFCFANTYPE, "IfcFanType", "IFCFANTYPE", false, {IFCFLOWMOVINGDEVICETYPE, IFCFLOWMOVINGDEVICETYPE, IFCFLOWMOVINGDEVICETYPE}},
+{IFCCONSTRAINTRELATIONSHIP, "IfcConstraintRelationship", "IFCCONSTRAINTRELATIONSHIP", false, {0, 0, 0}},
+{IFCAMOUNTOFSUBSTANCEMEASURE, "IfcAmountOfSubstanceMeasure", "IFCAMOUNTOFSUBSTANCEMEASURE", false, {0, 0, 0}},
+{IFCELECTRICALBASEPROPERTIES, "IfcElectricalBaseProperties", "IFCELECTRICALBASEPROPERTIES", false, {IFCENERGYPROPERTIES, 0, 0}},
+{IFCSPECULARROUGHNESS, "IfcSpecularRoughness", "IFCSPECULARROUGHNESS", false, {0, 0, 0}},
+{IFCRELSERVICESBUILDINGS, "IfcRelServicesBuildings", "IFCRELSERVICESBUILDINGS", false, {IFCRELCONNECTS, IFCRELCONNECTS, IFCRELCONNECTS}},
+{IFCCONNECTEDFACESET, "IfcConnectedFaceSet", "IFCCONNECTEDFACESET", false, {IFCTOPOLOGICALREPRESENTATIONITEM, IFCTOPOLOGICALREPRESENTATIONITEM, IFCTOPOLOGICALREPRESENTATIONITEM}},
+{IFCFILLAREASTYLEHATCHING, "IfcFillAreaStyleHatching", "IFCFILLAREASTYLEHATCHING", false, {IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM}},
+{IFCMECHANICALFASTENER, "IfcMechanicalFastener", "IFCMECHANICALFASTENER", true, {IFCFASTENER, IFCELEMENTCOMPONENT, IFCELEMENTCOMPONENT}},
+{IFCSTRUCTURALLOADCASE, "IfcStructuralLoadCase", "IFCSTRUCTURALLOADCASE", false, {0, IFCSTRUCTURALLOADGROUP, IFCSTRUCTURALLOADGROUP}},
+{IFCLINEARPLACEMENT, "IfcLinearPlacement", "IFCLINEARPLACEMENT", false, {0, 0, IFCOBJECTPLACEMENT}},
+{IFCSPACETHERMALLOADPROPERTIES, "IfcSpaceThermalLoadProperties", "IFCSPACETHERMALLOADPROPERTIES", false, {IFCPROPERTYSETDEFINITION, 0, 0}},
+{IFCAPPROVALPROPERTYRELATIONSHIP, "IfcApprovalPropertyRelationship", "IFCAPPROVALPROPERTYRELATIONSHIP", false, {0, 0, 0}},
+{IFCCABLECARRIERFITTINGTYPE, "IfcCableCarrierFittingType", "IFCCABLECARRIERFITTINGTYPE", false, {IFCFLOWFITTINGTYPE, IFCFLOWFITTINGTYPE, IFCFLOWFITTINGTYPE}},
+{IFCDOOR, "IfcDoor", "IFCDOOR", true, {IFCBUILDINGELEMENT, IFCBUILDINGELEMENT, IFCBUILTELEMENT}},
+{IFCCOMMUNICATIONSAPPLIANCETYPE, "IfcCommunicationsApplianceType", "IFCCOMMUNICATIONSAPPLIANCETYPE", false, {0, IFCFLOWTERMINALTYPE, IFCFLOWTERMINALTYPE}},
+{IFCELECTRICMOTOR, "IfcElectricMotor", "IFCELECTRICMOTOR", true, {0, IFCENERGYCONVERSIONDEVICE, IFCENERGYCONVERSIONDEVICE}},
+{IFCSHEARMODULUSMEASURE, "IfcShearModulusMeasure", "IFCSHEARMODULUSMEASURE", false, {0, 0, 0}},
+{IFCAPPLIEDVALUE, "IfcAppliedValue", "IFCAPPLIEDVALUE", false, {0, 0, 0}},
+{IFCSYSTEMFURNITUREELEMENT, "IfcSystemFurnitureElement", "IFCSYSTEMFURNITUREELEMENT", true, {0, IFCFURNISHINGELEMENT, IFCFURNISHINGELEMENT}},
+{IFCUSHAPEPROFILEDEF, "IfcUShapeProfileDef", "IFCUSHAPEPROFILEDEF", false, {IFCPARAMETERIZEDPROFILEDEF, IFCPARAMETERIZEDPROFILEDEF, IFCPARAMETERIZEDPROFILEDEF}},
+{IFCRELINTERFERESELEMENTS, "IfcRelInterferesElements", "IFCRELINTERFERESELEMENTS", false, {0, IFCRELCONNECTS, IFCRELCONNECTS}},
+{IFCLABORRESOURCETYPE, "IfcLaborResourceType", "IFCLABORRESOURCETYPE", false, {0, IFCCONSTRUCTIONRESOURCETYPE, IFCCONSTRUCTIONRESOURCETYPE}},
+{IFCPREDEFINEDDIMENSIONSYMBOL, "IfcPreDefinedDimensionSymbol", "IFCPREDEFINEDDIMENSIONSYMBOL", false, {IFCPREDEFINEDSYMBOL, 0, 0}},
+{IFCDRAUGHTINGPREDEFINEDCOLOUR, "IfcDraughtingPreDefinedColour", "IFCDRAUGHTINGPREDEFINEDCOLOUR", false, {IFCPREDEFINEDCOLOUR, IFCPREDEFINEDCOLOUR, IFCPREDEFINEDCOLOUR}},
+{IFCSIUNIT, "IfcSIUnit", "IFCSIUNIT", false, {IFCNAMEDUNIT, IFCNAMEDUNIT, IFCNAMEDUNIT}},
+{IFCSPHERE, "IfcSphere", "IFCSPHERE", false, {IFCCSGPRIMITIVE3D, IFCCSGPRIMITIVE3D, IFCCSGPRIMITIVE3D}},
+{IFCSPATIALZONE, "IfcSpatialZone", "IFCSPATIALZONE", true, {0, IFCSPATIALELEMENT, IFCSPATIALELEMENT}},
+{IFCEDGECURVE, "IfcEdgeCurve", "IFCEDGECURVE", false, {IFCEDGE, IFCEDGE, IFCEDGE}},
+{IFCEXTRUDEDAREASOLID, "IfcExtrudedAreaSolid", "IFCEXTRUDEDAREASOLID", false, {IFCSWEPTAREASOLID, IFCSWEPTAREASOLID, IFCSWEPTAREASOLID}},
+{IFCRELATIONSHIP, "IfcRelationship", "IFCRELATIONSHIP", false, {IFCROOT, IFCROOT, IFCROOT}},
+{IFCDISTRIBUTIONBOARDTYPE, "IfcDistributionBoardType", "IFCDISTRIBUTIONBOARDTYPE", false, {0, 0, IFCFLOWCONTROLLERTYPE}},
+{IFCEVAPORATOR, "IfcEvaporator", "IFCEVAPORATOR", true, {0, IFCENERGYCONVERSIONDEVICE, IFCENERGYCONVERSIONDEVICE}},
+{IFCWINDOWSTANDARDCASE, "IfcWindowStandardCase", "IFCWINDOWSTANDARDCASE", true, {0, IFCWINDOW, 0}},
+{IFCCONSTRUCTIONPRODUCTRESOURCE, "IfcConstructionProductResource", "IFCCONSTRUCTIONPRODUCTRESOURCE", false, {IFCCONSTRUCTIONRESOURCE, IFCCONSTRUCTIONRESOURCE, IFCCONSTRUCTIONRESOURCE}},
+{IFCPROPERTYSETTEMPLATE, "IfcPropertySetTemplate", "IFCPROPERTYSETTEMPLATE", false, {0, IFCPROPERTYTEMPLATEDEFINITION, IFCPROPERTYTEMPLATEDEFINITION}},
+{IFCLOGICAL, "IfcLogical", "IFCLOGICAL", false, {0, 0, 0}},
+{IFCRELCONNECTSWITHECCENTRICITY, "IfcRelConnectsWithEccentricity", "IFCRELCONNECTSWITHECCENTRICITY", false, {IFCRELCONNECTSSTRUCTURALMEMBER, IFCRELCONNECTSSTRUCTURALMEMBER, IFCRELCONNECTSSTRUCTURALMEMBER}},
+{IFCNAVIGATIONELEMENTTYPE, "IfcNavigationElementType", "IFCNAVIGATIONELEMENTTYPE", false, {0, 0, IFCBUILTELEMENTTYPE}},
+{IFCWINDOWPANELPROPERTIES, "IfcWindowPanelProperties", "IFCWINDOWPANELPROPERTIES", false, {IFCPROPERTYSETDEFINITION, IFCPREDEFINEDPROPERTYSET, IFCPREDEFINEDPROPERTYSET}},
+{IFCPAVEMENTTYPE, "IfcPavementType", "IFCPAVEMENTTYPE", false, {0, 0, IFCBUILTELEMENTTYPE}},
+{IFCDOSEEQUIVALENTMEASURE, "IfcDoseEquivalentMeasure", "IFCDOSEEQUIVALENTMEASURE", false, {0, 0, 0}},
+{IFCMARINEFACILITY, "IfcMarineFacility", "IFCMARINEFACILITY", true, {0, 0, IFCFACILITY}},
+{IFCNONNEGATIVELENGTHMEASURE, "IfcNonNegativeLengthMeasure", "IFCNONNEGATIVELENGTHMEASURE", false, {0, 0, 0}},
+{IFCDOORSTYLE, "IfcDoorStyle", "IFCDOORSTYLE", false, {IFCTYPEPRODUCT, IFCTYPEPRODUCT, 0}},
+{IFCSTRUCTURALMEMBER, "IfcStructuralMember", "IFCSTRUCTURALMEMBER", true, {IFCSTRUCTURALITEM, IFCSTRUCTURALITEM, IFCSTRUCTURALITEM}},
+{IFCTABLEROW, "IfcTableRow", "IFCTABLEROW", false, {0, 0, 0}},
+{IFCALIGNMENTHORIZONTALSEGMENT, "IfcAlignmentHorizontalSegment", "IFCALIGNMENTHORIZONTALSEGMENT", false, {0, 0, IFCALIGNMENTPARAMETERSEGMENT}},
+{IFCCURRENCYRELATIONSHIP, "IfcCurrencyRelationship", "IFCCURRENCYRELATIONSHIP", false, {0, IFCRESOURCELEVELRELATIONSHIP, IFCRESOURCELEVELRELATIONSHIP}},
+{IFCSEGMENTEDREFERENCECURVE, "IfcSegmentedReferenceCurve", "IFCSEGMENTEDREFERENCECURVE", false, {0, 0, IFCCOMPOSITECURVE}},
+{IFCROADPART, "IfcRoadPart", "IFCROADPART", true, {0, 0, IFCFACILITYPART}},
+{IFCMATERIALPROFILEWITHOFFSETS, "IfcMaterialProfileWithOffsets", "IFCMATERIALPROFILEWITHOFFSETS", false, {0, IFCMATERIALPROFILE, IFCMATERIALPROFILE}},
+{IFCDISTRIBUTIONCIRCUIT, "IfcDistributionCircuit", "IFCDISTRIBUTIONCIRCUIT", false, {0, IFCDISTRIBUTIONSYSTEM, IFCDISTRIBUTIONSYSTEM}},
+{IFCPROCEDURETYPE, "IfcProcedureType", "IFCPROCEDURETYPE", false, {0, IFCTYPEPROCESS, IFCTYPEPROCESS}},
+{IFCLSHAPEPROFILEDEF, "IfcLShapeProfileDef", "IFCLSHAPEPROFILEDEF", false, {IFCPARAMETERIZEDPROFILEDEF, IFCPARAMETERIZEDPROFILEDEF, IFCPARAMETERIZEDPROFILEDEF}},
+{IFCCARTESIANPOINTLIST, "IfcCartesianPointList", "IFCCARTESIANPOINTLIST", false, {0, IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM}},
+{IFCCONTROLLERTYPE, "IfcControllerType", "IFCCONTROLLERTYPE", false, {IFCDISTRIBUTIONCONTROLELEMENTTYPE, IFCDISTRIBUTIONCONTROLELEMENTTYPE, IFCDISTRIBUTIONCONTROLELEMENTTYPE}},
+{IFCTIMESERIESVALUE, "IfcTimeSeriesValue", "IFCTIMESERIESVALUE", false, {0, 0, 0}},
+{IFCOFFSETCURVE, "IfcOffsetCurve", "IFCOFFSETCURVE", false, {0, 0, IFCCURVE}},
+{IFCDIRECTRIXCURVESWEPTAREASOLID, "IfcDirectrixCurveSweptAreaSolid", "IFCDIRECTRIXCURVESWEPTAREASOLID", false, {0, 0, IFCSWEPTAREASOLID}},
+{IFCPIXELTEXTURE, "IfcPixelTexture", "IFCPIXELTEXTURE", false, {IFCSURFACETEXTURE, IFCSURFACETEXTURE, IFCSURFACETEXTURE}},
+{FILE_DESCRIPTION, "FILE_DESCRIPTION", "FILE_DESCRIPTION", false, {0, 0, 0}},
+{IFCCOSTVALUE, "IfcCostValue", "IFCCOSTVALUE", false, {IFCAPPLIEDVALUE, IFCAPPLIEDVALUE, IFCAPPLIEDVALUE}},
+{IFCPLANARBOX, "IfcPlanarBox", "IFCPLANARBOX", false, {IFCPLANAREXTENT, IFCPLANAREXTENT, IFCPLANAREXTENT}},
+{IFCTEXTFONTNAME, "IfcTextFontName", "IFCTEXTFONTNAME", false, {0, 0, 0}},
+{IFCSTRUCTURALSURFACEREACTION, "IfcStructuralSurfaceReaction", "IFCSTRUCTURALSURFACEREACTION", true, {0, IFCSTRUCTURALREACTION, IFCSTRUCTURALREACTION}},
+{IFCDIMENSIONCURVE, "IfcDimensionCurve", "IFCDIMENSIONCURVE", false, {IFCANNOTATIONCURVEOCCURRENCE, 0, 0}},
+{IFCSTRUCTURALLOADORRESULT, "IfcStructuralLoadOrResult", "IFCSTRUCTURALLOADORRESULT", false, {0, IFCSTRUCTURALLOAD, IFCSTRUCTURALLOAD}},
+{IFCCONSTRAINTCLASSIFICATIONRELATIONSHIP, "IfcConstraintClassificationRelationship", "IFCCONSTRAINTCLASSIFICATIONRELATIONSHIP", false, {0, 0, 0}},
+{IFCBLOBTEXTURE, "IfcBlobTexture", "IFCBLOBTEXTURE", false, {IFCSURFACETEXTURE, IFCSURFACETEXTURE, IFCSURFACETEXTURE}},
+{IFCADDRESS, "IfcAddress", "IFCADDRESS", false, {0, 0, 0}},
+{IFCTRACKELEMENTTYPE, "IfcTrackElementType", "IFCTRACKELEMENTTYPE", false, {0, 0, IFCBUILTELEMENTTYPE}},
+{IFCCALENDARDATE, "IfcCalendarDate", "IFCCALENDARDATE", false, {0, 0, 0}},
+{IFCSURFACETEXTURE, "IfcSurfaceTexture", "IFCSURFACETEXTURE", false, {0, IFCPRESENTATIONITEM, IFCPRESENTATIONITEM}},
+{IFCLIGHTFIXTURE, "IfcLightFixture", "IFCLIGHTFIXTURE", true, {0, IFCFLOWTERMINAL, IFCFLOWTERMINAL}},
+{IFCUNITARYCONTROLELEMENT, "IfcUnitaryControlElement", "IFCUNITARYCONTROLELEMENT", true, {0, IFCDISTRIBUTIONCONTROLELEMENT, IFCDISTRIBUTIONCONTROLELEMENT}},
+{IFCANGULARVELOCITYMEASURE, "IfcAngularVelocityMeasure", "IFCANGULARVELOCITYMEASURE", false, {0, 0, 0}},
+{IFCCABLECARRIERFITTING, "IfcCableCarrierFitting", "IFCCABLECARRIERFITTING", true, {0, IFCFLOWFITTING, IFCFLOWFITTING}},
+{IFCCOIL, "IfcCoil", "IFCCOIL", true, {0, IFCENERGYCONVERSIONDEVICE, IFCENERGYCONVERSIONDEVICE}},
+{IFCAPPLICATION, "IfcApplication", "IFCAPPLICATION", false, {0, 0, 0}},
+{IFCBRIDGE, "IfcBridge", "IFCBRIDGE", true, {0, 0, IFCFACILITY}},
+{IFCFASTENER, "IfcFastener", "IFCFASTENER", true, {IFCELEMENTCOMPONENT, IFCELEMENTCOMPONENT, IFCELEMENTCOMPONENT}},
+{IFCCLASSIFICATIONREFERENCE, "IfcClassificationReference", "IFCCLASSIFICATIONREFERENCE", false, {IFCEXTERNALREFERENCE, IFCEXTERNALREFERENCE, IFCEXTERNALREFERENCE}},
+{IFCSPACEPROGRAM, "IfcSpaceProgram", "IFCSPACEPROGRAM", false, {IFCCONTROL, 0, 0}},
+{IFCPROJECTLIBRARY, "IfcProjectLibrary", "IFCPROJECTLIBRARY", false, {0, IFCCONTEXT, IFCCONTEXT}},
+{IFCPROTECTIVEDEVICETRIPPINGUNITTYPE, "IfcProtectiveDeviceTrippingUnitType", "IFCPROTECTIVEDEVICETRIPPINGUNITTYPE", false, {0, IFCDISTRIBUTIONCONTROLELEMENTTYPE, IFCDISTRIBUTIONCONTROLELEMENTTYPE}},
+{IFCELECTRICAPPLIANCETYPE, "IfcElectricApplianceType", "IFCELECTRICAPPLIANCETYPE", false, {IFCFLOWTERMINALTYPE, IFCFLOWTERMINALTYPE, IFCFLOWTERMINALTYPE}},
+{IFCANNOTATIONFILLAREA, "IfcAnnotationFillArea", "IFCANNOTATIONFILLAREA", false, {IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM}},
+{IFCPRODUCTDEFINITIONSHAPE, "IfcProductDefinitionShape", "IFCPRODUCTDEFINITIONSHAPE", false, {IFCPRODUCTREPRESENTATION, IFCPRODUCTREPRESENTATION, IFCPRODUCTREPRESENTATION}},
+{IFCPRESENTATIONITEM, "IfcPresentationItem", "IFCPRESENTATIONITEM", false, {0, 0, 0}},
+{IFCMECHANICALSTEELMATERIALPROPERTIES, "IfcMechanicalSteelMaterialProperties", "IFCMECHANICALSTEELMATERIALPROPERTIES", false, {IFCMECHANICALMATERIALPROPERTIES, 0, 0}},
+{IFCKERBTYPE, "IfcKerbType", "IFCKERBTYPE", false, {0, 0, IFCBUILTELEMENTTYPE}},
+{IFCDIMENSIONCURVEDIRECTEDCALLOUT, "IfcDimensionCurveDirectedCallout", "IFCDIMENSIONCURVEDIRECTEDCALLOUT", false, {IFCDRAUGHTINGCALLOUT, 0, 0}},
+{IFCSTRUCTURALACTION, "IfcStructuralAction", "IFCSTRUCTURALACTION", true, {IFCSTRUCTURALACTIVITY, IFCSTRUCTURALACTIVITY, IFCSTRUCTURALACTIVITY}},
+{IFCRATIONALBSPLINESURFACEWITHKNOTS, "IfcRationalBSplineSurfaceWithKnots", "IFCRATIONALBSPLINESURFACEWITHKNOTS", false, {0, IFCBSPLINESURFACEWITHKNOTS, IFCBSPLINESURFACEWITHKNOTS}},
+{IFCRELDEFINES, "IfcRelDefines", "IFCRELDEFINES", false, {IFCRELATIONSHIP, IFCRELATIONSHIP, IFCRELATIONSHIP}},
+{IFCDEFINEDSYMBOL, "IfcDefinedSymbol", "IFCDEFINEDSYMBOL", false, {IFCGEOMETRICREPRESENTATIONITEM, 0, 0}},
+{IFCSURFACECURVE, "IfcSurfaceCurve", "IFCSURFACECURVE", false, {0, IFCCURVE, IFCCURVE}},
+{IFCFLOWSTORAGEDEVICE, "IfcFlowStorageDevice", "IFCFLOWSTORAGEDEVICE", true, {IFCDISTRIBUTIONFLOWELEMENT, IFCDISTRIBUTIONFLOWELEMENT, IFCDISTRIBUTIONFLOWELEMENT}},
+{IFCMOORINGDEVICETYPE, "IfcMooringDeviceType", "IFCMOORINGDEVICETYPE", false, {0, 0, IFCBUILTELEMENTTYPE}},
+{IFCSPATIALELEMENTTYPE, "IfcSpatialElementType", "IFCSPATIALELEMENTTYPE", false, {0, IFCTYPEPRODUCT, IFCTYPEPRODUCT}},
+{IFCELECTRICTIMECONTROLTYPE, "IfcElectricTimeControlType", "IFCELECTRICTIMECONTROLTYPE", false, {IFCFLOWCONTROLLERTYPE, IFCFLOWCONTROLLERTYPE, IFCFLOWCONTROLLERTYPE}},
+{IFCSOLIDMODEL, "IfcSolidModel", "IFCSOLIDMODEL", false, {IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM}},
+{IFCVALVETYPE, "IfcValveType", "IFCVALVETYPE", false, {IFCFLOWCONTROLLERTYPE, IFCFLOWCONTROLLERTYPE, IFCFLOWCONTROLLERTYPE}},
+{IFCSTRUCTURALPOINTCONNECTION, "IfcStructuralPointConnection", "IFCSTRUCTURALPOINTCONNECTION", true, {IFCSTRUCTURALCONNECTION, IFCSTRUCTURALCONNECTION, IFCSTRUCTURALCONNECTION}},
+{IFCPROTECTIVEDEVICE, "IfcProtectiveDevice", "IFCPROTECTIVEDEVICE", true, {0, IFCFLOWCONTROLLER, IFCFLOWCONTROLLER}},
+{IFCFILLAREASTYLE, "IfcFillAreaStyle", "IFCFILLAREASTYLE", false, {IFCPRESENTATIONSTYLE, IFCPRESENTATIONSTYLE, IFCPRESENTATIONSTYLE}},
+{IFCTHERMODYNAMICTEMPERATUREMEASURE, "IfcThermodynamicTemperatureMeasure", "IFCTHERMODYNAMICTEMPERATUREMEASURE", false, {0, 0, 0}},
+{IFCCLASSIFICATION, "IfcClassification", "IFCCLASSIFICATION", false, {0, IFCEXTERNALINFORMATION, IFCEXTERNALINFORMATION}},
+{IFCRELPROJECTSELEMENT, "IfcRelProjectsElement", "IFCRELPROJECTSELEMENT", false, {IFCRELCONNECTS, IFCRELDECOMPOSES, IFCRELDECOMPOSES}},
+{IFCBEAM, "IfcBeam", "IFCBEAM", true, {IFCBUILDINGELEMENT, IFCBUILDINGELEMENT, IFCBUILTELEMENT}},
+{IFCPREDEFINEDCOLOUR, "IfcPreDefinedColour", "IFCPREDEFINEDCOLOUR", false, {IFCPREDEFINEDITEM, IFCPREDEFINEDITEM, IFCPREDEFINEDITEM}},
+{IFCMATERIALDEFINITION, "IfcMaterialDefinition", "IFCMATERIALDEFINITION", false, {0, 0, 0}},
+{IFCMONTHINYEARNUMBER, "IfcMonthInYearNumber", "IFCMONTHINYEARNUMBER", false, {0, 0, 0}},
+{IFCDOCUMENTINFORMATIONRELATIONSHIP, "IfcDocumentInformationRelationship", "IFCDOCUMENTINFORMATIONRELATIONSHIP", false, {0, IFCRESOURCELEVELRELATIONSHIP, IFCRESOURCELEVELRELATIONSHIP}},
+{IFCCONNECTIONVOLUMEGEOMETRY, "IfcConnectionVolumeGeometry", "IFCCONNECTIONVOLUMEGEOMETRY", false, {0, IFCCONNECTIONGEOMETRY, IFCCONNECTIONGEOMETRY}},
+{IFCCOLOURRGB, "IfcColourRgb", "IFCCOLOURRGB", false, {IFCCOLOURSPECIFICATION, IFCCOLOURSPECIFICATION, IFCCOLOURSPECIFICATION}},
+{IFCRELDEFINESBYTYPE, "IfcRelDefinesByType", "IFCRELDEFINESBYTYPE", false, {IFCRELDEFINES, IFCRELDEFINES, IFCRELDEFINES}},
+{IFCTHIRDORDERPOLYNOMIALSPIRAL, "IfcThirdOrderPolynomialSpiral", "IFCTHIRDORDERPOLYNOMIALSPIRAL", false, {0, 0, IFCSPIRAL}},
+{IFCFACEOUTERBOUND, "IfcFaceOuterBound", "IFCFACEOUTERBOUND", false, {IFCFACEBOUND, IFCFACEBOUND, IFCFACEBOUND}},
+{IFCGENERALMATERIALPROPERTIES, "IfcGeneralMaterialProperties", "IFCGENERALMATERIALPROPERTIES", false, {IFCMATERIALPROPERTIES, 0, 0}},
+{IFCPIPEFITTINGTYPE, "IfcPipeFittingType", "IFCPIPEFITTINGTYPE", false, {IFCFLOWFITTINGTYPE, IFCFLOWFITTINGTYPE, IFCFLOWFITTINGTYPE}},
+{IFCFACETEDBREP, "IfcFacetedBrep", "IFCFACETEDBREP", false, {IFCMANIFOLDSOLIDBREP, IFCMANIFOLDSOLIDBREP, IFCMANIFOLDSOLIDBREP}},
+{IFCHALFSPACESOLID, "IfcHalfSpaceSolid", "IFCHALFSPACESOLID", false, {IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM}},
+{IFCTANK, "IfcTank", "IFCTANK", true, {0, IFCFLOWSTORAGEDEVICE, IFCFLOWSTORAGEDEVICE}},
+{IFCFURNITURESTANDARD, "IfcFurnitureStandard", "IFCFURNITURESTANDARD", false, {IFCCONTROL, 0, 0}},
+{IFCREPARAMETRISEDCOMPOSITECURVESEGMENT, "IfcReparametrisedCompositeCurveSegment", "IFCREPARAMETRISEDCOMPOSITECURVESEGMENT", false, {0, IFCCOMPOSITECURVESEGMENT, IFCCOMPOSITECURVESEGMENT}},
+{IFCFILTER, "IfcFilter", "IFCFILTER", true, {0, IFCFLOWTREATMENTDEVICE, IFCFLOWTREATMENTDEVICE}},
+{IFCBEAMTYPE, "IfcBeamType", "IFCBEAMTYPE", false, {IFCBUILDINGELEMENTTYPE, IFCBUILDINGELEMENTTYPE, IFCBUILTELEMENTTYPE}},
+{IFCSEGMENT, "IfcSegment", "IFCSEGMENT", false, {0, 0, IFCGEOMETRICREPRESENTATIONITEM}},
+{IFCQUANTITYWEIGHT, "IfcQuantityWeight", "IFCQUANTITYWEIGHT", false, {IFCPHYSICALSIMPLEQUANTITY, IFCPHYSICALSIMPLEQUANTITY, IFCPHYSICALSIMPLEQUANTITY}},
+{IFCRELCONNECTS, "IfcRelConnects", "IFCRELCONNECTS", false, {IFCRELATIONSHIP, IFCRELATIONSHIP, IFCRELATIONSHIP}},
+{IFCVEHICLE, "IfcVehicle", "IFCVEHICLE", true, {0, 0, IFCTRANSPORTATIONDEVICE}},
+{IFCCOLUMN, "IfcColumn", "IFCCOLUMN", true, {IFCBUILDINGELEMENT, IFCBUILDINGELEMENT, IFCBUILTELEMENT}},
+{IFCSOUNDPOWERMEASURE, "IfcSoundPowerMeasure", "IFCSOUNDPOWERMEASURE", false, {0, 0, 0}},
+{IFCSURFACESTYLESHADING, "IfcSurfaceStyleShading", "IFCSURFACESTYLESHADING", false, {0, IFCPRESENTATIONITEM, IFCPRESENTATIONITEM}},
+{IFCGRIDAXIS, "IfcGridAxis", "IFCGRIDAXIS", false, {0, 0, 0}},
+{IFCMATERIALRELATIONSHIP, "IfcMaterialRelationship", "IFCMATERIALRELATIONSHIP", false, {0, IFCRESOURCELEVELRELATIONSHIP, IFCRESOURCELEVELRELATIONSHIP}},
+{IFCEDGEFEATURE, "IfcEdgeFeature", "IFCEDGEFEATURE", true, {IFCFEATUREELEMENTSUBTRACTION, 0, 0}},
+{IFCELECTRICALELEMENT, "IfcElectricalElement", "IFCELECTRICALELEMENT", true, {IFCELEMENT, 0, 0}},
+{IFCTHERMALRESISTANCEMEASURE, "IfcThermalResistanceMeasure", "IFCTHERMALRESISTANCEMEASURE", false, {0, 0, 0}},
+{IFCELECTRICDISTRIBUTIONBOARD, "IfcElectricDistributionBoard", "IFCELECTRICDISTRIBUTIONBOARD", true, {0, IFCFLOWCONTROLLER, IFCFLOWCONTROLLER}},
+{IFCSHAPEASPECT, "IfcShapeAspect", "IFCSHAPEASPECT", false, {0, 0, 0}},
+{IFCDUCTFITTINGTYPE, "IfcDuctFittingType", "IFCDUCTFITTINGTYPE", false, {IFCFLOWFITTINGTYPE, IFCFLOWFITTINGTYPE, IFCFLOWFITTINGTYPE}},
+{IFCPROPERTYBOUNDEDVALUE, "IfcPropertyBoundedValue", "IFCPROPERTYBOUNDEDVALUE", false, {IFCSIMPLEPROPERTY, IFCSIMPLEPROPERTY, IFCSIMPLEPROPERTY}},
+{IFCRELCOVERSBLDGELEMENTS, "IfcRelCoversBldgElements", "IFCRELCOVERSBLDGELEMENTS", false, {IFCRELCONNECTS, IFCRELCONNECTS, IFCRELCONNECTS}},
+{IFCVIRTUALGRIDINTERSECTION, "IfcVirtualGridIntersection", "IFCVIRTUALGRIDINTERSECTION", false, {0, 0, 0}},
+{IFCFOOTING, "IfcFooting", "IFCFOOTING", true, {IFCBUILDINGELEMENT, IFCBUILDINGELEMENT, IFCBUILTELEMENT}},
+{IFCTESSELLATEDITEM, "IfcTessellatedItem", "IFCTESSELLATEDITEM", false, {0, IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM}},
+{IFCCOLUMNSTANDARDCASE, "IfcColumnStandardCase", "IFCCOLUMNSTANDARDCASE", true, {0, IFCCOLUMN, 0}},
+{IFCTELECOMADDRESS, "IfcTelecomAddress", "IFCTELECOMADDRESS", false, {IFCADDRESS, IFCADDRESS, IFCADDRESS}},
+{IFCRELASSOCIATESCLASSIFICATION, "IfcRelAssociatesClassification", "IFCRELASSOCIATESCLASSIFICATION", false, {IFCRELASSOCIATES, IFCRELASSOCIATES, IFCRELASSOCIATES}},
+{IFCVOIDINGFEATURE, "IfcVoidingFeature", "IFCVOIDINGFEATURE", true, {0, IFCFEATUREELEMENTSUBTRACTION, IFCFEATUREELEMENTSUBTRACTION}},
+{IFCPHMEASURE, "IfcPHMeasure", "IFCPHMEASURE", false, {0, 0, 0}},
+{IFCQUANTITYLENGTH, "IfcQuantityLength", "IFCQUANTITYLENGTH", false, {IFCPHYSICALSIMPLEQUANTITY, IFCPHYSICALSIMPLEQUANTITY, IFCPHYSICALSIMPLEQUANTITY}},
+{IFCDATE, "IfcDate", "IFCDATE", false, {0, 0, 0}},
+{IFCCLASSIFICATIONNOTATION, "IfcClassificationNotation", "IFCCLASSIFICATIONNOTATION", false, {0, 0, 0}},
+{IFCPROPERTYREFERENCEVALUE, "IfcPropertyReferenceValue", "IFCPROPERTYREFERENCEVALUE", false, {IFCSIMPLEPROPERTY, IFCSIMPLEPROPERTY, IFCSIMPLEPROPERTY}},
+{IFCURIREFERENCE, "IfcURIReference", "IFCURIREFERENCE", false, {0, 0, 0}},
+{IFCANNOTATIONSURFACEOCCURRENCE, "IfcAnnotationSurfaceOccurrence", "IFCANNOTATIONSURFACEOCCURRENCE", false, {IFCANNOTATIONOCCURRENCE, 0, 0}},
+{IFCBRIDGEPART, "IfcBridgePart", "IFCBRIDGEPART", true, {0, 0, IFCFACILITYPART}},
+{IFCREINFORCINGELEMENTTYPE, "IfcReinforcingElementType", "IFCREINFORCINGELEMENTTYPE", false, {0, IFCELEMENTCOMPONENTTYPE, IFCELEMENTCOMPONENTTYPE}},
+{IFCMARINEPART, "IfcMarinePart", "IFCMARINEPART", true, {0, 0, IFCFACILITYPART}},
+{IFCMOTORCONNECTIONTYPE, "IfcMotorConnectionType", "IFCMOTORCONNECTIONTYPE", false, {IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE}},
+{IFCREINFORCINGBAR, "IfcReinforcingBar", "IFCREINFORCINGBAR", true, {IFCREINFORCINGELEMENT, IFCREINFORCINGELEMENT, IFCREINFORCINGELEMENT}},
+{IFCRELASSOCIATESDOCUMENT, "IfcRelAssociatesDocument", "IFCRELASSOCIATESDOCUMENT", false, {IFCRELASSOCIATES, IFCRELASSOCIATES, IFCRELASSOCIATES}},
+{IFCIDENTIFIER, "IfcIdentifier", "IFCIDENTIFIER", false, {0, 0, 0}},
+{IFCTABLE, "IfcTable", "IFCTABLE", false, {0, 0, 0}},
+{IFCPROPERTYABSTRACTION, "IfcPropertyAbstraction", "IFCPROPERTYABSTRACTION", false, {0, 0, 0}},
+{IFCFLOWSEGMENT, "IfcFlowSegment", "IFCFLOWSEGMENT", true, {IFCDISTRIBUTIONFLOWELEMENT, IFCDISTRIBUTIONFLOWELEMENT, IFCDISTRIBUTIONFLOWELEMENT}},
+{IFCGEOMETRICCURVESET, "IfcGeometricCurveSet", "IFCGEOMETRICCURVESET", false, {IFCGEOMETRICSET, IFCGEOMETRICSET, IFCGEOMETRICSET}},
+{IFCPREDEFINEDSYMBOL, "IfcPreDefinedSymbol", "IFCPREDEFINEDSYMBOL", false, {IFCPREDEFINEDITEM, 0, 0}},
+{IFCSIGNAL, "IfcSignal", "IFCSIGNAL", true, {0, 0, IFCFLOWTERMINAL}},
+{IFCSOUNDPRESSUREMEASURE, "IfcSoundPressureMeasure", "IFCSOUNDPRESSUREMEASURE", false, {0, 0, 0}},
+{IFCELECTRICTIMECONTROL, "IfcElectricTimeControl", "IFCELECTRICTIMECONTROL", true, {0, IFCFLOWCONTROLLER, IFCFLOWCONTROLLER}},
+{IFCSTRUCTURALCURVEACTION, "IfcStructuralCurveAction", "IFCSTRUCTURALCURVEACTION", true, {0, IFCSTRUCTURALACTION, IFCSTRUCTURALACTION}},
+{IFCLOOP, "IfcLoop", "IFCLOOP", false, {IFCTOPOLOGICALREPRESENTATIONITEM, IFCTOPOLOGICALREPRESENTATIONITEM, IFCTOPOLOGICALREPRESENTATIONITEM}},
+{IFCTEXTURECOORDINATEINDICESWITHVOIDS, "IfcTextureCoordinateIndicesWithVoids", "IFCTEXTURECOORDINATEINDICESWITHVOIDS", false, {0, 0, IFCTEXTURECOORDINATEINDICES}},
+{IFCRELASSIGNSTOGROUPBYFACTOR, "IfcRelAssignsToGroupByFactor", "IFCRELASSIGNSTOGROUPBYFACTOR", false, {0, IFCRELASSIGNSTOGROUP, IFCRELASSIGNSTOGROUP}},
+{IFCSEVENTHORDERPOLYNOMIALSPIRAL, "IfcSeventhOrderPolynomialSpiral", "IFCSEVENTHORDERPOLYNOMIALSPIRAL", false, {0, 0, IFCSPIRAL}},
+{IFCWORKCONTROL, "IfcWorkControl", "IFCWORKCONTROL", false, {IFCCONTROL, IFCCONTROL, IFCCONTROL}},
+{IFCORIENTEDEDGE, "IfcOrientedEdge", "IFCORIENTEDEDGE", false, {IFCEDGE, IFCEDGE, IFCEDGE}},
+{IFCRELASSOCIATESPROFILEDEF, "IfcRelAssociatesProfileDef", "IFCRELASSOCIATESPROFILEDEF", false, {0, 0, IFCRELASSOCIATES}},
+{IFCZONE, "IfcZone", "IFCZONE", false, {IFCGROUP, IFCSYSTEM, IFCSYSTEM}},
+{IFCSTAIRFLIGHTTYPE, "IfcStairFlightType", "IFCSTAIRFLIGHTTYPE", false, {IFCBUILDINGELEMENTTYPE, IFCBUILDINGELEMENTTYPE, IFCBUILTELEMENTTYPE}},
+{IFCEXTERNALLYDEFINEDSURFACESTYLE, "IfcExternallyDefinedSurfaceStyle", "IFCEXTERNALLYDEFINEDSURFACESTYLE", false, {IFCEXTERNALREFERENCE, IFCEXTERNALREFERENCE, IFCEXTERNALREFERENCE}},
+{IFCRESOURCETIME, "IfcResourceTime", "IFCRESOURCETIME", false, {0, IFCSCHEDULINGTIME, IFCSCHEDULINGTIME}},
+{IFCDERIVEDUNITELEMENT, "IfcDerivedUnitElement", "IFCDERIVEDUNITELEMENT", false, {0, 0, 0}},
+{IFCLAMPTYPE, "IfcLampType", "IFCLAMPTYPE", false, {IFCFLOWTERMINALTYPE, IFCFLOWTERMINALTYPE, IFCFLOWTERMINALTYPE}},
+{IFCCABLEFITTING, "IfcCableFitting", "IFCCABLEFITTING", true, {0, IFCFLOWFITTING, IFCFLOWFITTING}},
+{IFCDISTRIBUTIONCHAMBERELEMENT, "IfcDistributionChamberElement", "IFCDISTRIBUTIONCHAMBERELEMENT", true, {IFCDISTRIBUTIONFLOWELEMENT, IFCDISTRIBUTIONFLOWELEMENT, IFCDISTRIBUTIONFLOWELEMENT}},
+{IFCMODULUSOFROTATIONALSUBGRADEREACTIONMEASURE, "IfcModulusOfRotationalSubgradeReactionMeasure", "IFCMODULUSOFROTATIONALSUBGRADEREACTIONMEASURE", false, {0, 0, 0}},
+{IFCSCHEDULINGTIME, "IfcSchedulingTime", "IFCSCHEDULINGTIME", false, {0, 0, 0}},
+{IFCRELSCHEDULESCOSTITEMS, "IfcRelSchedulesCostItems", "IFCRELSCHEDULESCOSTITEMS", false, {IFCRELASSIGNSTOCONTROL, 0, 0}},
+{IFCCONSTRUCTIONMATERIALRESOURCE, "IfcConstructionMaterialResource", "IFCCONSTRUCTIONMATERIALRESOURCE", false, {IFCCONSTRUCTIONRESOURCE, IFCCONSTRUCTIONRESOURCE, IFCCONSTRUCTIONRESOURCE}},
+{IFCDISTRIBUTIONCONTROLELEMENT, "IfcDistributionControlElement", "IFCDISTRIBUTIONCONTROLELEMENT", true, {IFCDISTRIBUTIONELEMENT, IFCDISTRIBUTIONELEMENT, IFCDISTRIBUTIONELEMENT}},
+{IFCCOORDINATEDUNIVERSALTIMEOFFSET, "IfcCoordinatedUniversalTimeOffset", "IFCCOORDINATEDUNIVERSALTIMEOFFSET", false, {0, 0, 0}},
+{IFCWATERPROPERTIES, "IfcWaterProperties", "IFCWATERPROPERTIES", false, {IFCMATERIALPROPERTIES, 0, 0}},
+{IFCSOLARDEVICETYPE, "IfcSolarDeviceType", "IFCSOLARDEVICETYPE", false, {0, IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE}},
+{IFCDATEANDTIME, "IfcDateAndTime", "IFCDATEANDTIME", false, {0, 0, 0}},
+{IFCMEMBER, "IfcMember", "IFCMEMBER", true, {IFCBUILDINGELEMENT, IFCBUILDINGELEMENT, IFCBUILTELEMENT}},
+{IFCREPRESENTATION, "IfcRepresentation", "IFCREPRESENTATION", false, {0, 0, 0}},
+{IFCEARTHWORKSELEMENT, "IfcEarthworksElement", "IFCEARTHWORKSELEMENT", true, {0, 0, IFCBUILTELEMENT}},
+{IFCBUILDINGELEMENTPROXY, "IfcBuildingElementProxy", "IFCBUILDINGELEMENTPROXY", true, {IFCBUILDINGELEMENT, IFCBUILDINGELEMENT, IFCBUILTELEMENT}},
+{IFCSWEPTDISKSOLIDPOLYGONAL, "IfcSweptDiskSolidPolygonal", "IFCSWEPTDISKSOLIDPOLYGONAL", false, {0, IFCSWEPTDISKSOLID, IFCSWEPTDISKSOLID}},
+{IFCCLASSIFICATIONITEMRELATIONSHIP, "IfcClassificationItemRelationship", "IFCCLASSIFICATIONITEMRELATIONSHIP", false, {0, 0, 0}},
+{IFCFONTSTYLE, "IfcFontStyle", "IFCFONTSTYLE", false, {0, 0, 0}},
+{IFCCURVESTYLEFONT, "IfcCurveStyleFont", "IFCCURVESTYLEFONT", false, {0, IFCPRESENTATIONITEM, IFCPRESENTATIONITEM}},
+{FILE_SCHEMA, "FILE_SCHEMA", "FILE_SCHEMA", false, {0, 0, 0}},
+{IFCAPPLIEDVALUERELATIONSHIP, "IfcAppliedValueRelationship", "IFCAPPLIEDVALUERELATIONSHIP", false, {0, 0, 0}},
+{IFCMEDICALDEVICETYPE, "IfcMedicalDeviceType", "IFCMEDICALDEVICETYPE", false, {0, IFCFLOWTERMINALTYPE, IFCFLOWTERMINALTYPE}},
+{IFCCARTESIANPOINT, "IfcCartesianPoint", "IFCCARTESIANPOINT", false, {IFCPOINT, IFCPOINT, IFCPOINT}},
+{IFCWASTETERMINALTYPE, "IfcWasteTerminalType", "IFCWASTETERMINALTYPE", false, {IFCFLOWTERMINALTYPE, IFCFLOWTERMINALTYPE, IFCFLOWTERMINALTYPE}},
+{IFCBOUNDARYCURVE, "IfcBoundaryCurve", "IFCBOUNDARYCURVE", false, {0, IFCCOMPOSITECURVEONSURFACE, IFCCOMPOSITECURVEONSURFACE}},
+{IFCDOCUMENTINFORMATION, "IfcDocumentInformation", "IFCDOCUMENTINFORMATION", false, {0, IFCEXTERNALINFORMATION, IFCEXTERNALINFORMATION}},
+{IFCLINEARPOSITIONINGELEMENT, "IfcLinearPositioningElement", "IFCLINEARPOSITIONINGELEMENT", true, {0, 0, IFCPOSITIONINGELEMENT}},
+{IFCPLATESTANDARDCASE, "IfcPlateStandardCase", "IFCPLATESTANDARDCASE", true, {0, IFCPLATE, 0}},
+{IFCPILETYPE, "IfcPileType", "IFCPILETYPE", false, {0, IFCBUILDINGELEMENTTYPE, IFCDEEPFOUNDATIONTYPE}},
+{IFCHEATINGVALUEMEASURE, "IfcHeatingValueMeasure", "IFCHEATINGVALUEMEASURE", false, {0, 0, 0}},
+{IFCLIGHTFIXTURETYPE, "IfcLightFixtureType", "IFCLIGHTFIXTURETYPE", false, {IFCFLOWTERMINALTYPE, IFCFLOWTERMINALTYPE, IFCFLOWTERMINALTYPE}},
+{IFCSWITCHINGDEVICE, "IfcSwitchingDevice", "IFCSWITCHINGDEVICE", true, {0, IFCFLOWCONTROLLER, IFCFLOWCONTROLLER}},
+{IFCCONDITIONCRITERION, "IfcConditionCriterion", "IFCCONDITIONCRITERION", false, {IFCCONTROL, 0, 0}},
+{IFCBUILDINGSYSTEM, "IfcBuildingSystem", "IFCBUILDINGSYSTEM", false, {0, IFCSYSTEM, IFCSYSTEM}},
+{IFCSTRUCTURALCONNECTION, "IfcStructuralConnection", "IFCSTRUCTURALCONNECTION", true, {IFCSTRUCTURALITEM, IFCSTRUCTURALITEM, IFCSTRUCTURALITEM}},
+{IFCSTRUCTURALLOADSINGLEFORCEWARPING, "IfcStructuralLoadSingleForceWarping", "IFCSTRUCTURALLOADSINGLEFORCEWARPING", false, {IFCSTRUCTURALLOADSINGLEFORCE, IFCSTRUCTURALLOADSINGLEFORCE, IFCSTRUCTURALLOADSINGLEFORCE}},
+{IFCTIMEPERIOD, "IfcTimePeriod", "IFCTIMEPERIOD", false, {0, 0, 0}},
+{IFCSOUNDVALUE, "IfcSoundValue", "IFCSOUNDVALUE", false, {IFCPROPERTYSETDEFINITION, 0, 0}},
+{IFCRELCONNECTSELEMENTS, "IfcRelConnectsElements", "IFCRELCONNECTSELEMENTS", false, {IFCRELCONNECTS, IFCRELCONNECTS, IFCRELCONNECTS}},
+{IFCOWNERHISTORY, "IfcOwnerHistory", "IFCOWNERHISTORY", false, {0, 0, 0}},
+{IFCEXTERNALSPATIALELEMENT, "IfcExternalSpatialElement", "IFCEXTERNALSPATIALELEMENT", true, {0, IFCEXTERNALSPATIALSTRUCTUREELEMENT, IFCEXTERNALSPATIALSTRUCTUREELEMENT}},
+{IFCTEMPERATURERATEOFCHANGEMEASURE, "IfcTemperatureRateOfChangeMeasure", "IFCTEMPERATURERATEOFCHANGEMEASURE", false, {0, 0, 0}},
+{IFCTEXTUREVERTEX, "IfcTextureVertex", "IFCTEXTUREVERTEX", false, {0, IFCPRESENTATIONITEM, IFCPRESENTATIONITEM}},
+{IFC2DCOMPOSITECURVE, "Ifc2DCompositeCurve", "IFC2DCOMPOSITECURVE", false, {IFCCOMPOSITECURVE, 0, 0}},
+{IFCCYLINDRICALSURFACE, "IfcCylindricalSurface", "IFCCYLINDRICALSURFACE", false, {0, IFCELEMENTARYSURFACE, IFCELEMENTARYSURFACE}},
+{IFCELECTRICMOTORTYPE, "IfcElectricMotorType", "IFCELECTRICMOTORTYPE", false, {IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE}},
+{IFCRELAXATION, "IfcRelaxation", "IFCRELAXATION", false, {0, 0, 0}},
+{IFCOPTICALMATERIALPROPERTIES, "IfcOpticalMaterialProperties", "IFCOPTICALMATERIALPROPERTIES", false, {IFCMATERIALPROPERTIES, 0, 0}},
+{IFCTRIANGULATEDIRREGULARNETWORK, "IfcTriangulatedIrregularNetwork", "IFCTRIANGULATEDIRREGULARNETWORK", false, {0, 0, IFCTRIANGULATEDFACESET}},
+{IFCRATIONALBSPLINECURVEWITHKNOTS, "IfcRationalBSplineCurveWithKnots", "IFCRATIONALBSPLINECURVEWITHKNOTS", false, {0, IFCBSPLINECURVEWITHKNOTS, IFCBSPLINECURVEWITHKNOTS}},
+{IFCSTRUCTURALPOINTREACTION, "IfcStructuralPointReaction", "IFCSTRUCTURALPOINTREACTION", true, {IFCSTRUCTURALREACTION, IFCSTRUCTURALREACTION, IFCSTRUCTURALREACTION}},
+{IFCWORKTIME, "IfcWorkTime", "IFCWORKTIME", false, {0, IFCSCHEDULINGTIME, IFCSCHEDULINGTIME}},
+{IFCLENGTHMEASURE, "IfcLengthMeasure", "IFCLENGTHMEASURE", false, {0, 0, 0}},
+{IFCRELREFERENCEDINSPATIALSTRUCTURE, "IfcRelReferencedInSpatialStructure", "IFCRELREFERENCEDINSPATIALSTRUCTURE", false, {IFCRELCONNECTS, IFCRELCONNECTS, IFCRELCONNECTS}},
+{IFCPOSITIVERATIOMEASURE, "IfcPositiveRatioMeasure", "IFCPOSITIVERATIOMEASURE", false, {0, 0, 0}},
+{IFCHEATEXCHANGERTYPE, "IfcHeatExchangerType", "IFCHEATEXCHANGERTYPE", false, {IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE}},
+{IFCSTRUCTURALLOADGROUP, "IfcStructuralLoadGroup", "IFCSTRUCTURALLOADGROUP", false, {IFCGROUP, IFCGROUP, IFCGROUP}},
+{IFCBOUNDEDCURVE, "IfcBoundedCurve", "IFCBOUNDEDCURVE", false, {IFCCURVE, IFCCURVE, IFCCURVE}},
+{IFCSWEPTDISKSOLID, "IfcSweptDiskSolid", "IFCSWEPTDISKSOLID", false, {IFCSOLIDMODEL, IFCSOLIDMODEL, IFCSOLIDMODEL}},
+{IFCFURNITURETYPE, "IfcFurnitureType", "IFCFURNITURETYPE", false, {IFCFURNISHINGELEMENTTYPE, IFCFURNISHINGELEMENTTYPE, IFCFURNISHINGELEMENTTYPE}},
+{IFCLANGUAGEID, "IfcLanguageId", "IFCLANGUAGEID", false, {0, 0, 0}},
+{IFCTORQUEMEASURE, "IfcTorqueMeasure", "IFCTORQUEMEASURE", false, {0, 0, 0}},
+{IFCLINE, "IfcLine", "IFCLINE", false, {IFCCURVE, IFCCURVE, IFCCURVE}},
+{IFCCABLESEGMENTTYPE, "IfcCableSegmentType", "IFCCABLESEGMENTTYPE", false, {IFCFLOWSEGMENTTYPE, IFCFLOWSEGMENTTYPE, IFCFLOWSEGMENTTYPE}},
+{IFCFEATUREELEMENTSUBTRACTION, "IfcFeatureElementSubtraction", "IFCFEATUREELEMENTSUBTRACTION", true, {IFCFEATUREELEMENT, IFCFEATUREELEMENT, IFCFEATUREELEMENT}},
+{IFCSYMBOLSTYLE, "IfcSymbolStyle", "IFCSYMBOLSTYLE", false, {IFCPRESENTATIONSTYLE, 0, 0}},
+{IFCSECTIONEDSOLIDHORIZONTAL, "IfcSectionedSolidHorizontal", "IFCSECTIONEDSOLIDHORIZONTAL", false, {0, 0, IFCSECTIONEDSOLID}},
+{IFCWINDOWSTYLE, "IfcWindowStyle", "IFCWINDOWSTYLE", false, {IFCTYPEPRODUCT, IFCTYPEPRODUCT, 0}},
+{IFCSURFACESTYLE, "IfcSurfaceStyle", "IFCSURFACESTYLE", false, {IFCPRESENTATIONSTYLE, IFCPRESENTATIONSTYLE, IFCPRESENTATIONSTYLE}},
+{IFCANNOTATIONSURFACE, "IfcAnnotationSurface", "IFCANNOTATIONSURFACE", false, {IFCGEOMETRICREPRESENTATIONITEM, 0, 0}},
+{IFCMATERIALLAYERSETUSAGE, "IfcMaterialLayerSetUsage", "IFCMATERIALLAYERSETUSAGE", false, {0, IFCMATERIALUSAGEDEFINITION, IFCMATERIALUSAGEDEFINITION}},
+{IFCPRESENTATIONLAYERWITHSTYLE, "IfcPresentationLayerWithStyle", "IFCPRESENTATIONLAYERWITHSTYLE", false, {IFCPRESENTATIONLAYERASSIGNMENT, IFCPRESENTATIONLAYERASSIGNMENT, IFCPRESENTATIONLAYERASSIGNMENT}},
+{IFCSPACEHEATERTYPE, "IfcSpaceHeaterType", "IFCSPACEHEATERTYPE", false, {IFCENERGYCONVERSIONDEVICETYPE, IFCFLOWTERMINALTYPE, IFCFLOWTERMINALTYPE}},
+{IFCDEEPFOUNDATIONTYPE, "IfcDeepFoundationType", "IFCDEEPFOUNDATIONTYPE", false, {0, 0, IFCBUILTELEMENTTYPE}},
+{IFCLINEARSTIFFNESSMEASURE, "IfcLinearStiffnessMeasure", "IFCLINEARSTIFFNESSMEASURE", false, {0, 0, 0}},
+{IFCRELASSIGNSTOGROUP, "IfcRelAssignsToGroup", "IFCRELASSIGNSTOGROUP", false, {IFCRELASSIGNS, IFCRELASSIGNS, IFCRELASSIGNS}},
+{IFCARBITRARYOPENPROFILEDEF, "IfcArbitraryOpenProfileDef", "IFCARBITRARYOPENPROFILEDEF", false, {IFCPROFILEDEF, IFCPROFILEDEF, IFCPROFILEDEF}},
+{IFCFACILITYPART, "IfcFacilityPart", "IFCFACILITYPART", true, {0, 0, IFCSPATIALSTRUCTUREELEMENT}},
+{IFCRELASSOCIATESAPPLIEDVALUE, "IfcRelAssociatesAppliedValue", "IFCRELASSOCIATESAPPLIEDVALUE", false, {IFCRELASSOCIATES, 0, 0}},
+{IFCSHADINGDEVICE, "IfcShadingDevice", "IFCSHADINGDEVICE", true, {0, IFCBUILDINGELEMENT, IFCBUILTELEMENT}},
+{IFCBLOCK, "IfcBlock", "IFCBLOCK", false, {IFCCSGPRIMITIVE3D, IFCCSGPRIMITIVE3D, IFCCSGPRIMITIVE3D}},
+{IFCDISCRETEACCESSORY, "IfcDiscreteAccessory", "IFCDISCRETEACCESSORY", true, {IFCELEMENTCOMPONENT, IFCELEMENTCOMPONENT, IFCELEMENTCOMPONENT}},
+{IFCFLOWSTORAGEDEVICETYPE, "IfcFlowStorageDeviceType", "IFCFLOWSTORAGEDEVICETYPE", false, {IFCDISTRIBUTIONFLOWELEMENTTYPE, IFCDISTRIBUTIONFLOWELEMENTTYPE, IFCDISTRIBUTIONFLOWELEMENTTYPE}},
+{IFCTWODIRECTIONREPEATFACTOR, "IfcTwoDirectionRepeatFactor", "IFCTWODIRECTIONREPEATFACTOR", false, {IFCONEDIRECTIONREPEATFACTOR, 0, 0}},
+{IFCSURFACESTYLEWITHTEXTURES, "IfcSurfaceStyleWithTextures", "IFCSURFACESTYLEWITHTEXTURES", false, {0, IFCPRESENTATIONITEM, IFCPRESENTATIONITEM}},
+{IFCSECTIONEDSURFACE, "IfcSectionedSurface", "IFCSECTIONEDSURFACE", false, {0, 0, IFCSURFACE}},
+{IFCDUCTSILENCER, "IfcDuctSilencer", "IFCDUCTSILENCER", true, {0, IFCFLOWTREATMENTDEVICE, IFCFLOWTREATMENTDEVICE}},
+{IFCFORCEMEASURE, "IfcForceMeasure", "IFCFORCEMEASURE", false, {0, 0, 0}},
+{IFCPOWERMEASURE, "IfcPowerMeasure", "IFCPOWERMEASURE", false, {0, 0, 0}},
+{IFCELECTRICHEATERTYPE, "IfcElectricHeaterType", "IFCELECTRICHEATERTYPE", false, {IFCFLOWTERMINALTYPE, 0, 0}},
+{IFCDOCUMENTELECTRONICFORMAT, "IfcDocumentElectronicFormat", "IFCDOCUMENTELECTRONICFORMAT", false, {0, 0, 0}},
+{IFCROUNDEDEDGEFEATURE, "IfcRoundedEdgeFeature", "IFCROUNDEDEDGEFEATURE", true, {IFCEDGEFEATURE, 0, 0}},
+{IFCTOPOLOGICALREPRESENTATIONITEM, "IfcTopologicalRepresentationItem", "IFCTOPOLOGICALREPRESENTATIONITEM", false, {IFCREPRESENTATIONITEM, IFCREPRESENTATIONITEM, IFCREPRESENTATIONITEM}},
+{IFCCIRCLEPROFILEDEF, "IfcCircleProfileDef", "IFCCIRCLEPROFILEDEF", false, {IFCPARAMETERIZEDPROFILEDEF, IFCPARAMETERIZEDPROFILEDEF, IFCPARAMETERIZEDPROFILEDEF}},
+{IFCPAVEMENT, "IfcPavement", "IFCPAVEMENT", true, {0, 0, IFCBUILTELEMENT}},
+{IFCBOUNDARYNODECONDITION, "IfcBoundaryNodeCondition", "IFCBOUNDARYNODECONDITION", false, {IFCBOUNDARYCONDITION, IFCBOUNDARYCONDITION, IFCBOUNDARYCONDITION}},
+{FILE_NAME, "FILE_NAME", "FILE_NAME", false, {0, 0, 0}},
+{IFCRELVOIDSELEMENT, "IfcRelVoidsElement", "IFCRELVOIDSELEMENT", false, {IFCRELCONNECTS, IFCRELDECOMPOSES, IFCRELDECOMPOSES}},
+{IFCLIGHTSOURCE, "IfcLightSource", "IFCLIGHTSOURCE", false, {IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM}},
+{IFCSTACKTERMINAL, "IfcStackTerminal", "IFCSTACKTERMINAL", true, {0, IFCFLOWTERMINAL, IFCFLOWTERMINAL}},
+{IFCORGANIZATIONRELATIONSHIP, "IfcOrganizationRelationship", "IFCORGANIZATIONRELATIONSHIP", false, {0, IFCRESOURCELEVELRELATIONSHIP, IFCRESOURCELEVELRELATIONSHIP}},
+{IFCAIRTERMINALBOXTYPE, "IfcAirTerminalBoxType", "IFCAIRTERMINALBOXTYPE", false, {IFCFLOWCONTROLLERTYPE, IFCFLOWCONTROLLERTYPE, IFCFLOWCONTROLLERTYPE}},
+{IFCSPATIALELEMENT, "IfcSpatialElement", "IFCSPATIALELEMENT", true, {0, IFCPRODUCT, IFCPRODUCT}},
+{IFCCARTESIANTRANSFORMATIONOPERATOR3DNONUNIFORM, "IfcCartesianTransformationOperator3DnonUniform", "IFCCARTESIANTRANSFORMATIONOPERATOR3DNONUNIFORM", false, {IFCCARTESIANTRANSFORMATIONOPERATOR3D, IFCCARTESIANTRANSFORMATIONOPERATOR3D, IFCCARTESIANTRANSFORMATIONOPERATOR3D}},
+{IFCVECTOR, "IfcVector", "IFCVECTOR", false, {IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM}},
+{IFCCOSTSCHEDULE, "IfcCostSchedule", "IFCCOSTSCHEDULE", false, {IFCCONTROL, IFCCONTROL, IFCCONTROL}},
+{IFCPOINTONSURFACE, "IfcPointOnSurface", "IFCPOINTONSURFACE", false, {IFCPOINT, IFCPOINT, IFCPOINT}},
+{IFCMANIFOLDSOLIDBREP, "IfcManifoldSolidBrep", "IFCMANIFOLDSOLIDBREP", false, {IFCSOLIDMODEL, IFCSOLIDMODEL, IFCSOLIDMODEL}},
+{IFCFIRESUPPRESSIONTERMINAL, "IfcFireSuppressionTerminal", "IFCFIRESUPPRESSIONTERMINAL", true, {0, IFCFLOWTERMINAL, IFCFLOWTERMINAL}},
+{IFCMECHANICALCONCRETEMATERIALPROPERTIES, "IfcMechanicalConcreteMaterialProperties", "IFCMECHANICALCONCRETEMATERIALPROPERTIES", false, {IFCMECHANICALMATERIALPROPERTIES, 0, 0}},
+{IFCMEDICALDEVICE, "IfcMedicalDevice", "IFCMEDICALDEVICE", true, {0, IFCFLOWTERMINAL, IFCFLOWTERMINAL}},
+{IFCEXTERNALREFERENCERELATIONSHIP, "IfcExternalReferenceRelationship", "IFCEXTERNALREFERENCERELATIONSHIP", false, {0, IFCRESOURCELEVELRELATIONSHIP, IFCRESOURCELEVELRELATIONSHIP}},
+{IFCINDEXEDTEXTUREMAP, "IfcIndexedTextureMap", "IFCINDEXEDTEXTUREMAP", false, {0, IFCTEXTURECOORDINATE, IFCTEXTURECOORDINATE}},
+{IFCRELPOSITIONS, "IfcRelPositions", "IFCRELPOSITIONS", false, {0, 0, IFCRELCONNECTS}},
+{IFCGENERALPROFILEPROPERTIES, "IfcGeneralProfileProperties", "IFCGENERALPROFILEPROPERTIES", false, {IFCPROFILEPROPERTIES, 0, 0}},
+{IFCTEXTSTYLE, "IfcTextStyle", "IFCTEXTSTYLE", false, {IFCPRESENTATIONSTYLE, IFCPRESENTATIONSTYLE, IFCPRESENTATIONSTYLE}},
+{IFCPROPERTYSET, "IfcPropertySet", "IFCPROPERTYSET", false, {IFCPROPERTYSETDEFINITION, IFCPROPERTYSETDEFINITION, IFCPROPERTYSETDEFINITION}},
+{IFCCURTAINWALLTYPE, "IfcCurtainWallType", "IFCCURTAINWALLTYPE", false, {IFCBUILDINGELEMENTTYPE, IFCBUILDINGELEMENTTYPE, IFCBUILTELEMENTTYPE}},
+{IFCTEXTALIGNMENT, "IfcTextAlignment", "IFCTEXTALIGNMENT", false, {0, 0, 0}},
+{IFCRELDEFINESBYOBJECT, "IfcRelDefinesByObject", "IFCRELDEFINESBYOBJECT", false, {0, IFCRELDEFINES, IFCRELDEFINES}},
+{IFCCOORDINATEREFERENCESYSTEM, "IfcCoordinateReferenceSystem", "IFCCOORDINATEREFERENCESYSTEM", false, {0, 0, 0}},
+{IFCRAMPTYPE, "IfcRampType", "IFCRAMPTYPE", false, {0, IFCBUILDINGELEMENTTYPE, IFCBUILTELEMENTTYPE}},
+{IFCEDGELOOP, "IfcEdgeLoop", "IFCEDGELOOP", false, {IFCLOOP, IFCLOOP, IFCLOOP}},
+{IFCMASSDENSITYMEASURE, "IfcMassDensityMeasure", "IFCMASSDENSITYMEASURE", false, {0, 0, 0}},
+{IFCPROPERTYTEMPLATEDEFINITION, "IfcPropertyTemplateDefinition", "IFCPROPERTYTEMPLATEDEFINITION", false, {0, IFCPROPERTYDEFINITION, IFCPROPERTYDEFINITION}},
+{IFCFLOWMOVINGDEVICETYPE, "IfcFlowMovingDeviceType", "IFCFLOWMOVINGDEVICETYPE", false, {IFCDISTRIBUTIONFLOWELEMENTTYPE, IFCDISTRIBUTIONFLOWELEMENTTYPE, IFCDISTRIBUTIONFLOWELEMENTTYPE}},
+{IFCISHAPEPROFILEDEF, "IfcIShapeProfileDef", "IFCISHAPEPROFILEDEF", false, {IFCPARAMETERIZEDPROFILEDEF, IFCPARAMETERIZEDPROFILEDEF, IFCPARAMETERIZEDPROFILEDEF}},
+{IFCTEXTSTYLEWITHBOXCHARACTERISTICS, "IfcTextStyleWithBoxCharacteristics", "IFCTEXTSTYLEWITHBOXCHARACTERISTICS", false, {0, 0, 0}},
+{IFCCOMPOSITEPROFILEDEF, "IfcCompositeProfileDef", "IFCCOMPOSITEPROFILEDEF", false, {IFCPROFILEDEF, IFCPROFILEDEF, IFCPROFILEDEF}},
+{IFCAREADENSITYMEASURE, "IfcAreaDensityMeasure", "IFCAREADENSITYMEASURE", false, {0, 0, 0}},
+{IFCCOURSE, "IfcCourse", "IFCCOURSE", true, {0, 0, IFCBUILTELEMENT}},
+{IFCMATERIALUSAGEDEFINITION, "IfcMaterialUsageDefinition", "IFCMATERIALUSAGEDEFINITION", false, {0, 0, 0}},
+{IFCSECTIONEDSPINE, "IfcSectionedSpine", "IFCSECTIONEDSPINE", false, {IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM}},
+{IFCFURNITURE, "IfcFurniture", "IFCFURNITURE", true, {0, IFCFURNISHINGELEMENT, IFCFURNISHINGELEMENT}},
+{IFCDESCRIPTIVEMEASURE, "IfcDescriptiveMeasure", "IFCDESCRIPTIVEMEASURE", false, {0, 0, 0}},
+{IFCLIGHTSOURCEPOSITIONAL, "IfcLightSourcePositional", "IFCLIGHTSOURCEPOSITIONAL", false, {IFCLIGHTSOURCE, IFCLIGHTSOURCE, IFCLIGHTSOURCE}},
+{IFCRELSPACEBOUNDARY2NDLEVEL, "IfcRelSpaceBoundary2ndLevel", "IFCRELSPACEBOUNDARY2NDLEVEL", false, {0, IFCRELSPACEBOUNDARY1STLEVEL, IFCRELSPACEBOUNDARY1STLEVEL}},
+{IFCCONSTRUCTIONPRODUCTRESOURCETYPE, "IfcConstructionProductResourceType", "IFCCONSTRUCTIONPRODUCTRESOURCETYPE", false, {0, IFCCONSTRUCTIONRESOURCETYPE, IFCCONSTRUCTIONRESOURCETYPE}},
+{IFCSLAB, "IfcSlab", "IFCSLAB", true, {IFCBUILDINGELEMENT, IFCBUILDINGELEMENT, IFCBUILTELEMENT}},
+{IFCVIBRATIONDAMPER, "IfcVibrationDamper", "IFCVIBRATIONDAMPER", true, {0, 0, IFCELEMENTCOMPONENT}},
+{IFCAUDIOVISUALAPPLIANCETYPE, "IfcAudioVisualApplianceType", "IFCAUDIOVISUALAPPLIANCETYPE", false, {0, IFCFLOWTERMINALTYPE, IFCFLOWTERMINALTYPE}},
+{IFCELECTRICGENERATORTYPE, "IfcElectricGeneratorType", "IFCELECTRICGENERATORTYPE", false, {IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE}},
+{IFCALIGNMENTHORIZONTAL, "IfcAlignmentHorizontal", "IFCALIGNMENTHORIZONTAL", true, {0, 0, IFCLINEARELEMENT}},
+{IFCTASKTIME, "IfcTaskTime", "IFCTASKTIME", false, {0, IFCSCHEDULINGTIME, IFCSCHEDULINGTIME}},
+{IFCBOUNDARYEDGECONDITION, "IfcBoundaryEdgeCondition", "IFCBOUNDARYEDGECONDITION", false, {IFCBOUNDARYCONDITION, IFCBOUNDARYCONDITION, IFCBOUNDARYCONDITION}},
+{IFCLIGHTINTENSITYDISTRIBUTION, "IfcLightIntensityDistribution", "IFCLIGHTINTENSITYDISTRIBUTION", false, {0, 0, 0}},
+{IFCREINFORCEMENTBARPROPERTIES, "IfcReinforcementBarProperties", "IFCREINFORCEMENTBARPROPERTIES", false, {0, IFCPREDEFINEDPROPERTIES, IFCPREDEFINEDPROPERTIES}},
+{IFCSYSTEMFURNITUREELEMENTTYPE, "IfcSystemFurnitureElementType", "IFCSYSTEMFURNITUREELEMENTTYPE", false, {IFCFURNISHINGELEMENTTYPE, IFCFURNISHINGELEMENTTYPE, IFCFURNISHINGELEMENTTYPE}},
+{IFCLAGTIME, "IfcLagTime", "IFCLAGTIME", false, {0, IFCSCHEDULINGTIME, IFCSCHEDULINGTIME}},
+{IFCGEOTECHNICALSTRATUM, "IfcGeotechnicalStratum", "IFCGEOTECHNICALSTRATUM", true, {0, 0, IFCGEOTECHNICALELEMENT}},
+{IFCSTRUCTURALLOADLINEARFORCE, "IfcStructuralLoadLinearForce", "IFCSTRUCTURALLOADLINEARFORCE", false, {IFCSTRUCTURALLOADSTATIC, IFCSTRUCTURALLOADSTATIC, IFCSTRUCTURALLOADSTATIC}},
+{IFCSTRUCTURALLOADSINGLEFORCE, "IfcStructuralLoadSingleForce", "IFCSTRUCTURALLOADSINGLEFORCE", false, {IFCSTRUCTURALLOADSTATIC, IFCSTRUCTURALLOADSTATIC, IFCSTRUCTURALLOADSTATIC}},
+{IFCDISTRIBUTIONCHAMBERELEMENTTYPE, "IfcDistributionChamberElementType", "IFCDISTRIBUTIONCHAMBERELEMENTTYPE", false, {IFCDISTRIBUTIONFLOWELEMENTTYPE, IFCDISTRIBUTIONFLOWELEMENTTYPE, IFCDISTRIBUTIONFLOWELEMENTTYPE}},
+{IFCTUBEBUNDLETYPE, "IfcTubeBundleType", "IFCTUBEBUNDLETYPE", false, {IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE}},
+{IFCSURFACESTYLEREFRACTION, "IfcSurfaceStyleRefraction", "IFCSURFACESTYLEREFRACTION", false, {0, IFCPRESENTATIONITEM, IFCPRESENTATIONITEM}},
+{IFCRESOURCECONSTRAINTRELATIONSHIP, "IfcResourceConstraintRelationship", "IFCRESOURCECONSTRAINTRELATIONSHIP", false, {0, IFCRESOURCELEVELRELATIONSHIP, IFCRESOURCELEVELRELATIONSHIP}},
+{IFCTRANSPORTELEMENT, "IfcTransportElement", "IFCTRANSPORTELEMENT", true, {IFCELEMENT, IFCELEMENT, IFCTRANSPORTATIONDEVICE}},
+{IFCSTRUCTURALPLANARACTION, "IfcStructuralPlanarAction", "IFCSTRUCTURALPLANARACTION", true, {IFCSTRUCTURALACTION, IFCSTRUCTURALSURFACEACTION, IFCSTRUCTURALSURFACEACTION}},
+{IFCELEMENTCOMPONENT, "IfcElementComponent", "IFCELEMENTCOMPONENT", true, {IFCELEMENT, IFCELEMENT, IFCELEMENT}},
+{IFCBUILTELEMENTTYPE, "IfcBuiltElementType", "IFCBUILTELEMENTTYPE", false, {0, 0, IFCELEMENTTYPE}},
+{IFCTYPEOBJECT, "IfcTypeObject", "IFCTYPEOBJECT", false, {IFCOBJECTDEFINITION, IFCOBJECTDEFINITION, IFCOBJECTDEFINITION}},
+{IFCAIRTERMINAL, "IfcAirTerminal", "IFCAIRTERMINAL", true, {0, IFCFLOWTERMINAL, IFCFLOWTERMINAL}},
+{IFCELECTRICALCIRCUIT, "IfcElectricalCircuit", "IFCELECTRICALCIRCUIT", false, {IFCSYSTEM, 0, 0}},
+{IFCADVANCEDBREP, "IfcAdvancedBrep", "IFCADVANCEDBREP", false, {0, IFCMANIFOLDSOLIDBREP, IFCMANIFOLDSOLIDBREP}},
+{IFCTIMESERIESSCHEDULE, "IfcTimeSeriesSchedule", "IFCTIMESERIESSCHEDULE", false, {IFCCONTROL, 0, 0}},
+{IFCRELCONNECTSSTRUCTURALMEMBER, "IfcRelConnectsStructuralMember", "IFCRELCONNECTSSTRUCTURALMEMBER", false, {IFCRELCONNECTS, IFCRELCONNECTS, IFCRELCONNECTS}},
+{IFCLIQUIDTERMINAL, "IfcLiquidTerminal", "IFCLIQUIDTERMINAL", true, {0, 0, IFCFLOWTERMINAL}},
+{IFCTEXTSTYLETEXTMODEL, "IfcTextStyleTextModel", "IFCTEXTSTYLETEXTMODEL", false, {0, IFCPRESENTATIONITEM, IFCPRESENTATIONITEM}},
+{IFCENVIRONMENTALIMPACTVALUE, "IfcEnvironmentalImpactValue", "IFCENVIRONMENTALIMPACTVALUE", false, {IFCAPPLIEDVALUE, 0, 0}},
+{IFCMOLECULARWEIGHTMEASURE, "IfcMolecularWeightMeasure", "IFCMOLECULARWEIGHTMEASURE", false, {0, 0, 0}},
+{IFCCONSTRAINTAGGREGATIONRELATIONSHIP, "IfcConstraintAggregationRelationship", "IFCCONSTRAINTAGGREGATIONRELATIONSHIP", false, {0, 0, 0}},
+{IFCENERGYCONVERSIONDEVICE, "IfcEnergyConversionDevice", "IFCENERGYCONVERSIONDEVICE", true, {IFCDISTRIBUTIONFLOWELEMENT, IFCDISTRIBUTIONFLOWELEMENT, IFCDISTRIBUTIONFLOWELEMENT}},
+{IFCREPRESENTATIONMAP, "IfcRepresentationMap", "IFCREPRESENTATIONMAP", false, {0, 0, 0}},
+{IFCALIGNMENTVERTICAL, "IfcAlignmentVertical", "IFCALIGNMENTVERTICAL", true, {0, 0, IFCLINEARELEMENT}},
+{IFCPLANAREXTENT, "IfcPlanarExtent", "IFCPLANAREXTENT", false, {IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM}},
+{IFCANNOTATION, "IfcAnnotation", "IFCANNOTATION", true, {IFCPRODUCT, IFCPRODUCT, IFCPRODUCT}},
+{IFCCARTESIANPOINTLIST2D, "IfcCartesianPointList2D", "IFCCARTESIANPOINTLIST2D", false, {0, IFCCARTESIANPOINTLIST, IFCCARTESIANPOINTLIST}},
+{IFCCIVILELEMENT, "IfcCivilElement", "IFCCIVILELEMENT", true, {0, IFCELEMENT, IFCELEMENT}},
+{IFCPROPERTYDEFINITION, "IfcPropertyDefinition", "IFCPROPERTYDEFINITION", false, {IFCROOT, IFCROOT, IFCROOT}},
+{IFCPCURVE, "IfcPcurve", "IFCPCURVE", false, {0, IFCCURVE, IFCCURVE}},
+{IFCCARDINALPOINTREFERENCE, "IfcCardinalPointReference", "IFCCARDINALPOINTREFERENCE", false, {0, 0, 0}},
+{IFCRELASSIGNSTOACTOR, "IfcRelAssignsToActor", "IFCRELASSIGNSTOACTOR", false, {IFCRELASSIGNS, IFCRELASSIGNS, IFCRELASSIGNS}},
+{IFCPILE, "IfcPile", "IFCPILE", true, {IFCBUILDINGELEMENT, IFCBUILDINGELEMENT, IFCDEEPFOUNDATION}},
+{IFCTRANSFORMERTYPE, "IfcTransformerType", "IFCTRANSFORMERTYPE", false, {IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE}},
+{IFCDIMENSIONPAIR, "IfcDimensionPair", "IFCDIMENSIONPAIR", false, {IFCDRAUGHTINGCALLOUTRELATIONSHIP, 0, 0}},
+{IFCELLIPSE, "IfcEllipse", "IFCELLIPSE", false, {IFCCONIC, IFCCONIC, IFCCONIC}},
+{IFCDOORPANELPROPERTIES, "IfcDoorPanelProperties", "IFCDOORPANELPROPERTIES", false, {IFCPROPERTYSETDEFINITION, IFCPREDEFINEDPROPERTYSET, IFCPREDEFINEDPROPERTYSET}},
+{IFCWARPINGMOMENTMEASURE, "IfcWarpingMomentMeasure", "IFCWARPINGMOMENTMEASURE", false, {0, 0, 0}},
+{IFCTIMESERIESREFERENCERELATIONSHIP, "IfcTimeSeriesReferenceRelationship", "IFCTIMESERIESREFERENCERELATIONSHIP", false, {0, 0, 0}},
+{IFCSTRUCTURALLINEARACTIONVARYING, "IfcStructuralLinearActionVarying", "IFCSTRUCTURALLINEARACTIONVARYING", true, {IFCSTRUCTURALLINEARACTION, 0, 0}},
+{IFCTOPOLOGYREPRESENTATION, "IfcTopologyRepresentation", "IFCTOPOLOGYREPRESENTATION", false, {IFCSHAPEMODEL, IFCSHAPEMODEL, IFCSHAPEMODEL}},
+{IFCTEXTURECOORDINATEGENERATOR, "IfcTextureCoordinateGenerator", "IFCTEXTURECOORDINATEGENERATOR", false, {IFCTEXTURECOORDINATE, IFCTEXTURECOORDINATE, IFCTEXTURECOORDINATE}},
+{IFCMODULUSOFSUBGRADEREACTIONMEASURE, "IfcModulusOfSubgradeReactionMeasure", "IFCMODULUSOFSUBGRADEREACTIONMEASURE", false, {0, 0, 0}},
+{IFCROTATIONALMASSMEASURE, "IfcRotationalMassMeasure", "IFCROTATIONALMASSMEASURE", false, {0, 0, 0}},
+{IFCELEMENT, "IfcElement", "IFCELEMENT", true, {IFCPRODUCT, IFCPRODUCT, IFCPRODUCT}},
+{IFCRAILTYPE, "IfcRailType", "IFCRAILTYPE", false, {0, 0, IFCBUILTELEMENTTYPE}},
+{IFCDERIVEDUNIT, "IfcDerivedUnit", "IFCDERIVEDUNIT", false, {0, 0, 0}},
+{IFCCLASSIFICATIONITEM, "IfcClassificationItem", "IFCCLASSIFICATIONITEM", false, {0, 0, 0}},
+{IFCSANITARYTERMINALTYPE, "IfcSanitaryTerminalType", "IFCSANITARYTERMINALTYPE", false, {IFCFLOWTERMINALTYPE, IFCFLOWTERMINALTYPE, IFCFLOWTERMINALTYPE}},
+{IFCLIQUIDTERMINALTYPE, "IfcLiquidTerminalType", "IFCLIQUIDTERMINALTYPE", false, {0, 0, IFCFLOWTERMINALTYPE}},
+{IFCLINEINDEX, "IfcLineIndex", "IFCLINEINDEX", false, {0, 0, 0}},
+{IFCPREDEFINEDTEXTFONT, "IfcPreDefinedTextFont", "IFCPREDEFINEDTEXTFONT", false, {IFCPREDEFINEDITEM, IFCPREDEFINEDITEM, IFCPREDEFINEDITEM}},
+{IFCCOUNTMEASURE, "IfcCountMeasure", "IFCCOUNTMEASURE", false, {0, 0, 0}},
+{IFCSENSORTYPE, "IfcSensorType", "IFCSENSORTYPE", false, {IFCDISTRIBUTIONCONTROLELEMENTTYPE, IFCDISTRIBUTIONCONTROLELEMENTTYPE, IFCDISTRIBUTIONCONTROLELEMENTTYPE}},
+{IFCCOORDINATEOPERATION, "IfcCoordinateOperation", "IFCCOORDINATEOPERATION", false, {0, 0, 0}},
+{IFCPOSITIVEINTEGER, "IfcPositiveInteger", "IFCPOSITIVEINTEGER", false, {0, 0, 0}},
+{IFCHUMIDIFIERTYPE, "IfcHumidifierType", "IFCHUMIDIFIERTYPE", false, {IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE}},
+{IFCSTRUCTURALLINEARACTION, "IfcStructuralLinearAction", "IFCSTRUCTURALLINEARACTION", true, {IFCSTRUCTURALACTION, IFCSTRUCTURALCURVEACTION, IFCSTRUCTURALCURVEACTION}},
+{IFCFACEBOUND, "IfcFaceBound", "IFCFACEBOUND", false, {IFCTOPOLOGICALREPRESENTATIONITEM, IFCTOPOLOGICALREPRESENTATIONITEM, IFCTOPOLOGICALREPRESENTATIONITEM}},
+{IFCFILTERTYPE, "IfcFilterType", "IFCFILTERTYPE", false, {IFCFLOWTREATMENTDEVICETYPE, IFCFLOWTREATMENTDEVICETYPE, IFCFLOWTREATMENTDEVICETYPE}},
+{IFCCREWRESOURCETYPE, "IfcCrewResourceType", "IFCCREWRESOURCETYPE", false, {0, IFCCONSTRUCTIONRESOURCETYPE, IFCCONSTRUCTIONRESOURCETYPE}},
+{IFCELECTRICCAPACITANCEMEASURE, "IfcElectricCapacitanceMeasure", "IFCELECTRICCAPACITANCEMEASURE", false, {0, 0, 0}},
+{IFCFLOWSEGMENTTYPE, "IfcFlowSegmentType", "IFCFLOWSEGMENTTYPE", false, {IFCDISTRIBUTIONFLOWELEMENTTYPE, IFCDISTRIBUTIONFLOWELEMENTTYPE, IFCDISTRIBUTIONFLOWELEMENTTYPE}},
+{IFCMATERIAL, "IfcMaterial", "IFCMATERIAL", false, {0, IFCMATERIALDEFINITION, IFCMATERIALDEFINITION}},
+{IFCPROTECTIVEDEVICETYPE, "IfcProtectiveDeviceType", "IFCPROTECTIVEDEVICETYPE", false, {IFCFLOWCONTROLLERTYPE, IFCFLOWCONTROLLERTYPE, IFCFLOWCONTROLLERTYPE}},
+{IFCMATERIALCLASSIFICATIONRELATIONSHIP, "IfcMaterialClassificationRelationship", "IFCMATERIALCLASSIFICATIONRELATIONSHIP", false, {0, 0, 0}},
+{IFCMATERIALLAYERWITHOFFSETS, "IfcMaterialLayerWithOffsets", "IFCMATERIALLAYERWITHOFFSETS", false, {0, IFCMATERIALLAYER, IFCMATERIALLAYER}},
+{IFCREVOLVEDAREASOLID, "IfcRevolvedAreaSolid", "IFCREVOLVEDAREASOLID", false, {IFCSWEPTAREASOLID, IFCSWEPTAREASOLID, IFCSWEPTAREASOLID}},
+{IFCEXTENDEDMATERIALPROPERTIES, "IfcExtendedMaterialProperties", "IFCEXTENDEDMATERIALPROPERTIES", false, {IFCMATERIALPROPERTIES, 0, 0}},
+{IFCSECTIONEDSOLID, "IfcSectionedSolid", "IFCSECTIONEDSOLID", false, {0, 0, IFCSOLIDMODEL}},
+{IFCRELASSOCIATES, "IfcRelAssociates", "IFCRELASSOCIATES", false, {IFCRELATIONSHIP, IFCRELATIONSHIP, IFCRELATIONSHIP}},
+{IFCBOXALIGNMENT, "IfcBoxAlignment", "IFCBOXALIGNMENT", false, {0, 0, 0}},
+{IFCAIRTOAIRHEATRECOVERYTYPE, "IfcAirToAirHeatRecoveryType", "IFCAIRTOAIRHEATRECOVERYTYPE", false, {IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE}},
+{IFCBUILTELEMENT, "IfcBuiltElement", "IFCBUILTELEMENT", true, {0, 0, IFCELEMENT}},
+{IFCSURFACESTYLERENDERING, "IfcSurfaceStyleRendering", "IFCSURFACESTYLERENDERING", false, {IFCSURFACESTYLESHADING, IFCSURFACESTYLESHADING, IFCSURFACESTYLESHADING}},
+{IFCELEMENTQUANTITY, "IfcElementQuantity", "IFCELEMENTQUANTITY", false, {IFCPROPERTYSETDEFINITION, IFCQUANTITYSET, IFCQUANTITYSET}},
+{IFCRAILWAYPART, "IfcRailwayPart", "IFCRAILWAYPART", true, {0, 0, IFCFACILITYPART}},
+{IFCFOOTINGTYPE, "IfcFootingType", "IFCFOOTINGTYPE", false, {0, IFCBUILDINGELEMENTTYPE, IFCBUILTELEMENTTYPE}},
+{IFCSIGNALTYPE, "IfcSignalType", "IFCSIGNALTYPE", false, {0, 0, IFCFLOWTERMINALTYPE}},
+{IFCWALLTYPE, "IfcWallType", "IFCWALLTYPE", false, {IFCBUILDINGELEMENTTYPE, IFCBUILDINGELEMENTTYPE, IFCBUILTELEMENTTYPE}},
+{IFCELECTRICAPPLIANCE, "IfcElectricAppliance", "IFCELECTRICAPPLIANCE", true, {0, IFCFLOWTERMINAL, IFCFLOWTERMINAL}},
+{IFCVERTEXPOINT, "IfcVertexPoint", "IFCVERTEXPOINT", false, {IFCVERTEX, IFCVERTEX, IFCVERTEX}},
+{IFCBUILDINGELEMENTPROXYTYPE, "IfcBuildingElementProxyType", "IFCBUILDINGELEMENTPROXYTYPE", false, {IFCBUILDINGELEMENTTYPE, IFCBUILDINGELEMENTTYPE, IFCBUILTELEMENTTYPE}},
+{IFCUNITARYEQUIPMENTTYPE, "IfcUnitaryEquipmentType", "IFCUNITARYEQUIPMENTTYPE", false, {IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE}},
+{IFCMEMBERSTANDARDCASE, "IfcMemberStandardCase", "IFCMEMBERSTANDARDCASE", true, {0, IFCMEMBER, 0}},
+{IFCCOVERINGTYPE, "IfcCoveringType", "IFCCOVERINGTYPE", false, {IFCBUILDINGELEMENTTYPE, IFCBUILDINGELEMENTTYPE, IFCBUILTELEMENTTYPE}},
+{IFCMOVE, "IfcMove", "IFCMOVE", false, {IFCTASK, 0, 0}},
+{IFCBEZIERCURVE, "IfcBezierCurve", "IFCBEZIERCURVE", false, {IFCBSPLINECURVE, 0, 0}},
+{IFCNAMEDUNIT, "IfcNamedUnit", "IFCNAMEDUNIT", false, {0, 0, 0}},
+{IFCTOROIDALSURFACE, "IfcToroidalSurface", "IFCTOROIDALSURFACE", false, {0, IFCELEMENTARYSURFACE, IFCELEMENTARYSURFACE}},
+{IFCINTEGER, "IfcInteger", "IFCINTEGER", false, {0, 0, 0}},
+{IFCDISTRIBUTIONELEMENT, "IfcDistributionElement", "IFCDISTRIBUTIONELEMENT", true, {IFCELEMENT, IFCELEMENT, IFCELEMENT}},
+{IFCPOSITIONINGELEMENT, "IfcPositioningElement", "IFCPOSITIONINGELEMENT", true, {0, 0, IFCPRODUCT}},
+{IFCMOBILETELECOMMUNICATIONSAPPLIANCETYPE, "IfcMobileTelecommunicationsApplianceType", "IFCMOBILETELECOMMUNICATIONSAPPLIANCETYPE", false, {0, 0, IFCFLOWTERMINALTYPE}},
+{IFCBUILDINGELEMENTTYPE, "IfcBuildingElementType", "IFCBUILDINGELEMENTTYPE", false, {IFCELEMENTTYPE, IFCELEMENTTYPE, 0}},
+{IFCTRANSPORTATIONDEVICE, "IfcTransportationDevice", "IFCTRANSPORTATIONDEVICE", true, {0, 0, IFCELEMENT}},
+{IFCCONSTRAINT, "IfcConstraint", "IFCCONSTRAINT", false, {0, 0, 0}},
+{IFCEQUIPMENTELEMENT, "IfcEquipmentElement", "IFCEQUIPMENTELEMENT", true, {IFCELEMENT, 0, 0}},
+{IFCBSPLINECURVE, "IfcBSplineCurve", "IFCBSPLINECURVE", false, {IFCBOUNDEDCURVE, IFCBOUNDEDCURVE, IFCBOUNDEDCURVE}},
+{IFCGEOSLICE, "IfcGeoslice", "IFCGEOSLICE", true, {0, 0, IFCGEOTECHNICALASSEMBLY}},
+{IFCSTRUCTURALLOADSINGLEDISPLACEMENTDISTORTION, "IfcStructuralLoadSingleDisplacementDistortion", "IFCSTRUCTURALLOADSINGLEDISPLACEMENTDISTORTION", false, {IFCSTRUCTURALLOADSINGLEDISPLACEMENT, IFCSTRUCTURALLOADSINGLEDISPLACEMENT, IFCSTRUCTURALLOADSINGLEDISPLACEMENT}},
+{IFCCOVERING, "IfcCovering", "IFCCOVERING", true, {IFCBUILDINGELEMENT, IFCBUILDINGELEMENT, IFCBUILTELEMENT}},
+{IFCSTRUCTURALSURFACECONNECTION, "IfcStructuralSurfaceConnection", "IFCSTRUCTURALSURFACECONNECTION", true, {IFCSTRUCTURALCONNECTION, IFCSTRUCTURALCONNECTION, IFCSTRUCTURALCONNECTION}},
+{IFCCONNECTIONCURVEGEOMETRY, "IfcConnectionCurveGeometry", "IFCCONNECTIONCURVEGEOMETRY", false, {IFCCONNECTIONGEOMETRY, IFCCONNECTIONGEOMETRY, IFCCONNECTIONGEOMETRY}},
+{IFCTEXTSTYLEFONTMODEL, "IfcTextStyleFontModel", "IFCTEXTSTYLEFONTMODEL", false, {IFCPREDEFINEDTEXTFONT, IFCPREDEFINEDTEXTFONT, IFCPREDEFINEDTEXTFONT}},
+{IFCSPACEHEATER, "IfcSpaceHeater", "IFCSPACEHEATER", true, {0, IFCFLOWTERMINAL, IFCFLOWTERMINAL}},
+{IFCCOSINESPIRAL, "IfcCosineSpiral", "IFCCOSINESPIRAL", false, {0, 0, IFCSPIRAL}},
+{IFCPLACEMENT, "IfcPlacement", "IFCPLACEMENT", false, {IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM}},
+{IFCTHERMALTRANSMITTANCEMEASURE, "IfcThermalTransmittanceMeasure", "IFCTHERMALTRANSMITTANCEMEASURE", false, {0, 0, 0}},
+{IFCROOF, "IfcRoof", "IFCROOF", true, {IFCBUILDINGELEMENT, IFCBUILDINGELEMENT, IFCBUILTELEMENT}},
+{IFCMATERIALDEFINITIONREPRESENTATION, "IfcMaterialDefinitionRepresentation", "IFCMATERIALDEFINITIONREPRESENTATION", false, {IFCPRODUCTREPRESENTATION, IFCPRODUCTREPRESENTATION, IFCPRODUCTREPRESENTATION}},
+{IFCPRESENTATIONLAYERASSIGNMENT, "IfcPresentationLayerAssignment", "IFCPRESENTATIONLAYERASSIGNMENT", false, {0, 0, 0}},
+{IFCSURFACECURVESWEPTAREASOLID, "IfcSurfaceCurveSweptAreaSolid", "IFCSURFACECURVESWEPTAREASOLID", false, {IFCSWEPTAREASOLID, IFCSWEPTAREASOLID, IFCDIRECTRIXCURVESWEPTAREASOLID}},
+{IFCDUCTSILENCERTYPE, "IfcDuctSilencerType", "IFCDUCTSILENCERTYPE", false, {IFCFLOWTREATMENTDEVICETYPE, IFCFLOWTREATMENTDEVICETYPE, IFCFLOWTREATMENTDEVICETYPE}},
+{IFCSECTIONPROPERTIES, "IfcSectionProperties", "IFCSECTIONPROPERTIES", false, {0, IFCPREDEFINEDPROPERTIES, IFCPREDEFINEDPROPERTIES}},
+{IFCTABLECOLUMN, "IfcTableColumn", "IFCTABLECOLUMN", false, {0, 0, 0}},
+{IFCQUANTITYAREA, "IfcQuantityArea", "IFCQUANTITYAREA", false, {IFCPHYSICALSIMPLEQUANTITY, IFCPHYSICALSIMPLEQUANTITY, IFCPHYSICALSIMPLEQUANTITY}},
+{IFCFACEBASEDSURFACEMODEL, "IfcFaceBasedSurfaceModel", "IFCFACEBASEDSURFACEMODEL", false, {IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM}},
+{IFCRELOCCUPIESSPACES, "IfcRelOccupiesSpaces", "IFCRELOCCUPIESSPACES", false, {IFCRELASSIGNSTOACTOR, 0, 0}},
+{IFCKINEMATICVISCOSITYMEASURE, "IfcKinematicViscosityMeasure", "IFCKINEMATICVISCOSITYMEASURE", false, {0, 0, 0}},
+{IFCAIRTOAIRHEATRECOVERY, "IfcAirToAirHeatRecovery", "IFCAIRTOAIRHEATRECOVERY", true, {0, IFCENERGYCONVERSIONDEVICE, IFCENERGYCONVERSIONDEVICE}},
+{IFCFLOWCONTROLLER, "IfcFlowController", "IFCFLOWCONTROLLER", true, {IFCDISTRIBUTIONFLOWELEMENT, IFCDISTRIBUTIONFLOWELEMENT, IFCDISTRIBUTIONFLOWELEMENT}},
+{IFCCARTESIANPOINTLIST3D, "IfcCartesianPointList3D", "IFCCARTESIANPOINTLIST3D", false, {0, IFCCARTESIANPOINTLIST, IFCCARTESIANPOINTLIST}},
+{IFCDISTRIBUTIONCONTROLELEMENTTYPE, "IfcDistributionControlElementType", "IFCDISTRIBUTIONCONTROLELEMENTTYPE", false, {IFCDISTRIBUTIONELEMENTTYPE, IFCDISTRIBUTIONELEMENTTYPE, IFCDISTRIBUTIONELEMENTTYPE}},
+{IFCPOINT, "IfcPoint", "IFCPOINT", false, {IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM}},
+{IFCHUMIDIFIER, "IfcHumidifier", "IFCHUMIDIFIER", true, {0, IFCENERGYCONVERSIONDEVICE, IFCENERGYCONVERSIONDEVICE}},
+{IFCBOUNDARYNODECONDITIONWARPING, "IfcBoundaryNodeConditionWarping", "IFCBOUNDARYNODECONDITIONWARPING", false, {IFCBOUNDARYNODECONDITION, IFCBOUNDARYNODECONDITION, IFCBOUNDARYNODECONDITION}},
+{IFCPERSON, "IfcPerson", "IFCPERSON", false, {0, 0, 0}},
+{IFCENERGYMEASURE, "IfcEnergyMeasure", "IFCENERGYMEASURE", false, {0, 0, 0}},
+{IFCMOBILETELECOMMUNICATIONSAPPLIANCE, "IfcMobileTelecommunicationsAppliance", "IFCMOBILETELECOMMUNICATIONSAPPLIANCE", true, {0, 0, IFCFLOWTERMINAL}},
+{IFCAPPROVALACTORRELATIONSHIP, "IfcApprovalActorRelationship", "IFCAPPROVALACTORRELATIONSHIP", false, {0, 0, 0}},
+{IFCSTRUCTURALPOINTACTION, "IfcStructuralPointAction", "IFCSTRUCTURALPOINTACTION", true, {IFCSTRUCTURALACTION, IFCSTRUCTURALACTION, IFCSTRUCTURALACTION}},
+{IFCQUANTITYSET, "IfcQuantitySet", "IFCQUANTITYSET", false, {0, IFCPROPERTYSETDEFINITION, IFCPROPERTYSETDEFINITION}},
+{IFCELECTRICCONDUCTANCEMEASURE, "IfcElectricConductanceMeasure", "IFCELECTRICCONDUCTANCEMEASURE", false, {0, 0, 0}},
+{IFCQUANTITYCOUNT, "IfcQuantityCount", "IFCQUANTITYCOUNT", false, {IFCPHYSICALSIMPLEQUANTITY, IFCPHYSICALSIMPLEQUANTITY, IFCPHYSICALSIMPLEQUANTITY}},
+{IFCLUMINOUSFLUXMEASURE, "IfcLuminousFluxMeasure", "IFCLUMINOUSFLUXMEASURE", false, {0, 0, 0}},
+{IFCNORMALISEDRATIOMEASURE, "IfcNormalisedRatioMeasure", "IFCNORMALISEDRATIOMEASURE", false, {0, 0, 0}},
+{IFCPRODUCTREPRESENTATION, "IfcProductRepresentation", "IFCPRODUCTREPRESENTATION", false, {0, 0, 0}},
+{IFCTRANSPORTELEMENTTYPE, "IfcTransportElementType", "IFCTRANSPORTELEMENTTYPE", false, {IFCELEMENTTYPE, IFCELEMENTTYPE, IFCTRANSPORTATIONDEVICETYPE}},
+{IFCENERGYCONVERSIONDEVICETYPE, "IfcEnergyConversionDeviceType", "IFCENERGYCONVERSIONDEVICETYPE", false, {IFCDISTRIBUTIONFLOWELEMENTTYPE, IFCDISTRIBUTIONFLOWELEMENTTYPE, IFCDISTRIBUTIONFLOWELEMENTTYPE}},
+{IFCMECHANICALFASTENERTYPE, "IfcMechanicalFastenerType", "IFCMECHANICALFASTENERTYPE", false, {IFCFASTENERTYPE, IFCELEMENTCOMPONENTTYPE, IFCELEMENTCOMPONENTTYPE}},
+{IFCRELCONNECTSSTRUCTURALACTIVITY, "IfcRelConnectsStructuralActivity", "IFCRELCONNECTSSTRUCTURALACTIVITY", false, {IFCRELCONNECTS, IFCRELCONNECTS, IFCRELCONNECTS}},
+{IFCLINEARMOMENTMEASURE, "IfcLinearMomentMeasure", "IFCLINEARMOMENTMEASURE", false, {0, 0, 0}},
+{IFCINDEXEDTRIANGLETEXTUREMAP, "IfcIndexedTriangleTextureMap", "IFCINDEXEDTRIANGLETEXTUREMAP", false, {0, IFCINDEXEDTEXTUREMAP, IFCINDEXEDTEXTUREMAP}},
+{IFCROTATIONALFREQUENCYMEASURE, "IfcRotationalFrequencyMeasure", "IFCROTATIONALFREQUENCYMEASURE", false, {0, 0, 0}},
+{IFCELECTRICFLOWTREATMENTDEVICETYPE, "IfcElectricFlowTreatmentDeviceType", "IFCELECTRICFLOWTREATMENTDEVICETYPE", false, {0, 0, IFCFLOWTREATMENTDEVICETYPE}},
+{IFCFEATUREELEMENTADDITION, "IfcFeatureElementAddition", "IFCFEATUREELEMENTADDITION", true, {IFCFEATUREELEMENT, IFCFEATUREELEMENT, IFCFEATUREELEMENT}},
+{IFCCSGSOLID, "IfcCsgSolid", "IFCCSGSOLID", false, {IFCSOLIDMODEL, IFCSOLIDMODEL, IFCSOLIDMODEL}},
+{IFCSEAMCURVE, "IfcSeamCurve", "IFCSEAMCURVE", false, {0, IFCSURFACECURVE, IFCSURFACECURVE}},
+{IFCSTRUCTURALLOAD, "IfcStructuralLoad", "IFCSTRUCTURALLOAD", false, {0, 0, 0}},
+{IFCPOINTBYDISTANCEEXPRESSION, "IfcPointByDistanceExpression", "IFCPOINTBYDISTANCEEXPRESSION", false, {0, 0, IFCPOINT}},
+{IFCPRESENTABLETEXT, "IfcPresentableText", "IFCPRESENTABLETEXT", false, {0, 0, 0}},
+{IFCMODULUSOFLINEARSUBGRADEREACTIONMEASURE, "IfcModulusOfLinearSubgradeReactionMeasure", "IFCMODULUSOFLINEARSUBGRADEREACTIONMEASURE", false, {0, 0, 0}},
+{IFCJUNCTIONBOX, "IfcJunctionBox", "IFCJUNCTIONBOX", true, {0, IFCFLOWFITTING, IFCFLOWFITTING}},
+{IFCLINEARELEMENT, "IfcLinearElement", "IFCLINEARELEMENT", true, {0, 0, IFCPRODUCT}},
+{IFCNAVIGATIONELEMENT, "IfcNavigationElement", "IFCNAVIGATIONELEMENT", true, {0, 0, IFCBUILTELEMENT}},
+{IFCCONSTRUCTIONEQUIPMENTRESOURCETYPE, "IfcConstructionEquipmentResourceType", "IFCCONSTRUCTIONEQUIPMENTRESOURCETYPE", false, {0, IFCCONSTRUCTIONRESOURCETYPE, IFCCONSTRUCTIONRESOURCETYPE}},
+{IFCFLOWMETER, "IfcFlowMeter", "IFCFLOWMETER", true, {0, IFCFLOWCONTROLLER, IFCFLOWCONTROLLER}},
+{IFCBURNERTYPE, "IfcBurnerType", "IFCBURNERTYPE", false, {0, IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE}},
+{IFCCONDITION, "IfcCondition", "IFCCONDITION", false, {IFCGROUP, 0, 0}},
+{IFCSECTIONALAREAINTEGRALMEASURE, "IfcSectionalAreaIntegralMeasure", "IFCSECTIONALAREAINTEGRALMEASURE", false, {0, 0, 0}},
+{IFCDATETIME, "IfcDateTime", "IFCDATETIME", false, {0, 0, 0}},
+{IFCCHIMNEYTYPE, "IfcChimneyType", "IFCCHIMNEYTYPE", false, {0, IFCBUILDINGELEMENTTYPE, IFCBUILTELEMENTTYPE}},
+{IFCMATERIALLIST, "IfcMaterialList", "IFCMATERIALLIST", false, {0, 0, 0}},
+{IFCCLOSEDSHELL, "IfcClosedShell", "IFCCLOSEDSHELL", false, {IFCCONNECTEDFACESET, IFCCONNECTEDFACESET, IFCCONNECTEDFACESET}},
+{IFCSTRUCTURALSURFACEMEMBERVARYING, "IfcStructuralSurfaceMemberVarying", "IFCSTRUCTURALSURFACEMEMBERVARYING", true, {IFCSTRUCTURALSURFACEMEMBER, IFCSTRUCTURALSURFACEMEMBER, IFCSTRUCTURALSURFACEMEMBER}},
+{IFCFLOWTERMINAL, "IfcFlowTerminal", "IFCFLOWTERMINAL", true, {IFCDISTRIBUTIONFLOWELEMENT, IFCDISTRIBUTIONFLOWELEMENT, IFCDISTRIBUTIONFLOWELEMENT}},
+{IFCPHYSICALSIMPLEQUANTITY, "IfcPhysicalSimpleQuantity", "IFCPHYSICALSIMPLEQUANTITY", false, {IFCPHYSICALQUANTITY, IFCPHYSICALQUANTITY, IFCPHYSICALQUANTITY}},
+{IFCSUBEDGE, "IfcSubedge", "IFCSUBEDGE", false, {IFCEDGE, IFCEDGE, IFCEDGE}},
+{IFCMATERIALPROFILE, "IfcMaterialProfile", "IFCMATERIALPROFILE", false, {0, IFCMATERIALDEFINITION, IFCMATERIALDEFINITION}},
+{IFCEXTERNALLYDEFINEDHATCHSTYLE, "IfcExternallyDefinedHatchStyle", "IFCEXTERNALLYDEFINEDHATCHSTYLE", false, {IFCEXTERNALREFERENCE, IFCEXTERNALREFERENCE, IFCEXTERNALREFERENCE}},
+{IFCSWEPTAREASOLID, "IfcSweptAreaSolid", "IFCSWEPTAREASOLID", false, {IFCSOLIDMODEL, IFCSOLIDMODEL, IFCSOLIDMODEL}},
+{IFCPUMPTYPE, "IfcPumpType", "IFCPUMPTYPE", false, {IFCFLOWMOVINGDEVICETYPE, IFCFLOWMOVINGDEVICETYPE, IFCFLOWMOVINGDEVICETYPE}},
+{IFCOBJECTIVE, "IfcObjective", "IFCOBJECTIVE", false, {IFCCONSTRAINT, IFCCONSTRAINT, IFCCONSTRAINT}},
+{IFCSYSTEM, "IfcSystem", "IFCSYSTEM", false, {IFCGROUP, IFCGROUP, IFCGROUP}},
+{IFCPARAMETERVALUE, "IfcParameterValue", "IFCPARAMETERVALUE", false, {0, 0, 0}},
+{IFCRAILING, "IfcRailing", "IFCRAILING", true, {IFCBUILDINGELEMENT, IFCBUILDINGELEMENT, IFCBUILTELEMENT}},
+{IFCANNOTATIONFILLAREAOCCURRENCE, "IfcAnnotationFillAreaOccurrence", "IFCANNOTATIONFILLAREAOCCURRENCE", false, {IFCANNOTATIONOCCURRENCE, 0, 0}},
+{IFCPRODUCTSOFCOMBUSTIONPROPERTIES, "IfcProductsOfCombustionProperties", "IFCPRODUCTSOFCOMBUSTIONPROPERTIES", false, {IFCMATERIALPROPERTIES, 0, 0}},
+{IFCCONDENSER, "IfcCondenser", "IFCCONDENSER", true, {0, IFCENERGYCONVERSIONDEVICE, IFCENERGYCONVERSIONDEVICE}},
+{IFCDIMENSIONCALLOUTRELATIONSHIP, "IfcDimensionCalloutRelationship", "IFCDIMENSIONCALLOUTRELATIONSHIP", false, {IFCDRAUGHTINGCALLOUTRELATIONSHIP, 0, 0}},
+{IFCSTRUCTURALCONNECTIONCONDITION, "IfcStructuralConnectionCondition", "IFCSTRUCTURALCONNECTIONCONDITION", false, {0, 0, 0}},
+{IFCTENDONCONDUITTYPE, "IfcTendonConduitType", "IFCTENDONCONDUITTYPE", false, {0, 0, IFCREINFORCINGELEMENTTYPE}},
+{IFCTHERMALEXPANSIONCOEFFICIENTMEASURE, "IfcThermalExpansionCoefficientMeasure", "IFCTHERMALEXPANSIONCOEFFICIENTMEASURE", false, {0, 0, 0}},
+{IFCINDEXEDPOLYGONALFACEWITHVOIDS, "IfcIndexedPolygonalFaceWithVoids", "IFCINDEXEDPOLYGONALFACEWITHVOIDS", false, {0, IFCINDEXEDPOLYGONALFACE, IFCINDEXEDPOLYGONALFACE}},
+{IFCPROTECTIVEDEVICETRIPPINGUNIT, "IfcProtectiveDeviceTrippingUnit", "IFCPROTECTIVEDEVICETRIPPINGUNIT", true, {0, IFCDISTRIBUTIONCONTROLELEMENT, IFCDISTRIBUTIONCONTROLELEMENT}},
+{IFCACTOR, "IfcActor", "IFCACTOR", false, {IFCOBJECT, IFCOBJECT, IFCOBJECT}},
+{IFCFLOWTERMINALTYPE, "IfcFlowTerminalType", "IFCFLOWTERMINALTYPE", false, {IFCDISTRIBUTIONFLOWELEMENTTYPE, IFCDISTRIBUTIONFLOWELEMENTTYPE, IFCDISTRIBUTIONFLOWELEMENTTYPE}},
+{IFCANNOTATIONTEXTOCCURRENCE, "IfcAnnotationTextOccurrence", "IFCANNOTATIONTEXTOCCURRENCE", false, {IFCANNOTATIONOCCURRENCE, 0, 0}},
+{IFCCOILTYPE, "IfcCoilType", "IFCCOILTYPE", false, {IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE}},
+{IFCREINFORCINGMESHTYPE, "IfcReinforcingMeshType", "IFCREINFORCINGMESHTYPE", false, {0, IFCREINFORCINGELEMENTTYPE, IFCREINFORCINGELEMENTTYPE}},
+{IFCBINARY, "IfcBinary", "IFCBINARY", false, {0, 0, 0}},
+{IFCSWITCHINGDEVICETYPE, "IfcSwitchingDeviceType", "IFCSWITCHINGDEVICETYPE", false, {IFCFLOWCONTROLLERTYPE, IFCFLOWCONTROLLERTYPE, IFCFLOWCONTROLLERTYPE}},
+{IFCREINFORCINGMESH, "IfcReinforcingMesh", "IFCREINFORCINGMESH", true, {IFCREINFORCINGELEMENT, IFCREINFORCINGELEMENT, IFCREINFORCINGELEMENT}},
+{IFCDOORTYPE, "IfcDoorType", "IFCDOORTYPE", false, {0, IFCBUILDINGELEMENTTYPE, IFCBUILTELEMENTTYPE}},
+{IFCRAMPFLIGHTTYPE, "IfcRampFlightType", "IFCRAMPFLIGHTTYPE", false, {IFCBUILDINGELEMENTTYPE, IFCBUILDINGELEMENTTYPE, IFCBUILTELEMENTTYPE}},
+{IFCROOT, "IfcRoot", "IFCROOT", false, {0, 0, 0}},
+{IFCMAPPEDITEM, "IfcMappedItem", "IFCMAPPEDITEM", false, {IFCREPRESENTATIONITEM, IFCREPRESENTATIONITEM, IFCREPRESENTATIONITEM}},
+{IFCTENDONANCHOR, "IfcTendonAnchor", "IFCTENDONANCHOR", true, {IFCREINFORCINGELEMENT, IFCREINFORCINGELEMENT, IFCREINFORCINGELEMENT}},
+{IFCTYPEPRODUCT, "IfcTypeProduct", "IFCTYPEPRODUCT", false, {IFCTYPEOBJECT, IFCTYPEOBJECT, IFCTYPEOBJECT}},
+{IFCCURVESTYLEFONTANDSCALING, "IfcCurveStyleFontAndScaling", "IFCCURVESTYLEFONTANDSCALING", false, {0, IFCPRESENTATIONITEM, IFCPRESENTATIONITEM}},
+{IFCPERFORMANCEHISTORY, "IfcPerformanceHistory", "IFCPERFORMANCEHISTORY", false, {IFCCONTROL, IFCCONTROL, IFCCONTROL}},
+{IFCTESSELLATEDFACESET, "IfcTessellatedFaceSet", "IFCTESSELLATEDFACESET", false, {0, IFCTESSELLATEDITEM, IFCTESSELLATEDITEM}},
+{IFCINVENTORY, "IfcInventory", "IFCINVENTORY", false, {IFCGROUP, IFCGROUP, IFCGROUP}},
+{IFCVIBRATIONISOLATOR, "IfcVibrationIsolator", "IFCVIBRATIONISOLATOR", true, {0, IFCELEMENTCOMPONENT, IFCELEMENTCOMPONENT}},
+{IFCWALL, "IfcWall", "IFCWALL", true, {IFCBUILDINGELEMENT, IFCBUILDINGELEMENT, IFCBUILTELEMENT}},
+{IFCNUMERICMEASURE, "IfcNumericMeasure", "IFCNUMERICMEASURE", false, {0, 0, 0}},
+{IFCELEMENTASSEMBLYTYPE, "IfcElementAssemblyType", "IFCELEMENTASSEMBLYTYPE", false, {0, IFCELEMENTTYPE, IFCELEMENTTYPE}},
+{IFCQUANTITYVOLUME, "IfcQuantityVolume", "IFCQUANTITYVOLUME", false, {IFCPHYSICALSIMPLEQUANTITY, IFCPHYSICALSIMPLEQUANTITY, IFCPHYSICALSIMPLEQUANTITY}},
+{IFCSERVICELIFEFACTOR, "IfcServiceLifeFactor", "IFCSERVICELIFEFACTOR", false, {IFCPROPERTYSETDEFINITION, 0, 0}},
+{IFCTENDONTYPE, "IfcTendonType", "IFCTENDONTYPE", false, {0, IFCREINFORCINGELEMENTTYPE, IFCREINFORCINGELEMENTTYPE}},
+{IFCELECTRICDISTRIBUTIONBOARDTYPE, "IfcElectricDistributionBoardType", "IFCELECTRICDISTRIBUTIONBOARDTYPE", false, {0, IFCFLOWCONTROLLERTYPE, IFCFLOWCONTROLLERTYPE}},
+{IFCPRESENTATIONSTYLEASSIGNMENT, "IfcPresentationStyleAssignment", "IFCPRESENTATIONSTYLEASSIGNMENT", false, {0, 0, 0}},
+{IFCREFERENCE, "IfcReference", "IFCREFERENCE", false, {0, 0, 0}},
+{IFCRESOURCELEVELRELATIONSHIP, "IfcResourceLevelRelationship", "IFCRESOURCELEVELRELATIONSHIP", false, {0, 0, 0}},
+{IFCANNOTATIONOCCURRENCE, "IfcAnnotationOccurrence", "IFCANNOTATIONOCCURRENCE", false, {IFCSTYLEDITEM, 0, 0}},
+{IFCHYGROSCOPICMATERIALPROPERTIES, "IfcHygroscopicMaterialProperties", "IFCHYGROSCOPICMATERIALPROPERTIES", false, {IFCMATERIALPROPERTIES, 0, 0}},
+{IFCSTRUCTURALCURVEMEMBERVARYING, "IfcStructuralCurveMemberVarying", "IFCSTRUCTURALCURVEMEMBERVARYING", true, {IFCSTRUCTURALCURVEMEMBER, IFCSTRUCTURALCURVEMEMBER, IFCSTRUCTURALCURVEMEMBER}},
+{IFCGEOMETRICREPRESENTATIONITEM, "IfcGeometricRepresentationItem", "IFCGEOMETRICREPRESENTATIONITEM", false, {IFCREPRESENTATIONITEM, IFCREPRESENTATIONITEM, IFCREPRESENTATIONITEM}},
+{IFCCHAMFEREDGEFEATURE, "IfcChamferEdgeFeature", "IFCCHAMFEREDGEFEATURE", true, {IFCEDGEFEATURE, 0, 0}},
+{IFCBSPLINECURVEWITHKNOTS, "IfcBSplineCurveWithKnots", "IFCBSPLINECURVEWITHKNOTS", false, {0, IFCBSPLINECURVE, IFCBSPLINECURVE}},
+{IFCANGULARDIMENSION, "IfcAngularDimension", "IFCANGULARDIMENSION", false, {IFCDIMENSIONCURVEDIRECTEDCALLOUT, 0, 0}},
+{IFCSTRUCTURALLOADSINGLEDISPLACEMENT, "IfcStructuralLoadSingleDisplacement", "IFCSTRUCTURALLOADSINGLEDISPLACEMENT", false, {IFCSTRUCTURALLOADSTATIC, IFCSTRUCTURALLOADSTATIC, IFCSTRUCTURALLOADSTATIC}},
+{IFCMOTORCONNECTION, "IfcMotorConnection", "IFCMOTORCONNECTION", true, {0, IFCENERGYCONVERSIONDEVICE, IFCENERGYCONVERSIONDEVICE}},
+{IFCSPATIALZONETYPE, "IfcSpatialZoneType", "IFCSPATIALZONETYPE", false, {0, IFCSPATIALELEMENTTYPE, IFCSPATIALELEMENTTYPE}},
+{IFCPHYSICALQUANTITY, "IfcPhysicalQuantity", "IFCPHYSICALQUANTITY", false, {0, 0, 0}},
+{IFCCOMPOSITECURVESEGMENT, "IfcCompositeCurveSegment", "IFCCOMPOSITECURVESEGMENT", false, {IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM, IFCSEGMENT}},
+{IFCSOUNDPROPERTIES, "IfcSoundProperties", "IFCSOUNDPROPERTIES", false, {IFCPROPERTYSETDEFINITION, 0, 0}},
+{IFCOFFSETCURVEBYDISTANCES, "IfcOffsetCurveByDistances", "IFCOFFSETCURVEBYDISTANCES", false, {0, 0, IFCOFFSETCURVE}},
+{IFCMAGNETICFLUXMEASURE, "IfcMagneticFluxMeasure", "IFCMAGNETICFLUXMEASURE", false, {0, 0, 0}},
+{IFCFASTENERTYPE, "IfcFastenerType", "IFCFASTENERTYPE", false, {IFCELEMENTCOMPONENTTYPE, IFCELEMENTCOMPONENTTYPE, IFCELEMENTCOMPONENTTYPE}},
+{IFCRELASSIGNSTOCONTROL, "IfcRelAssignsToControl", "IFCRELASSIGNSTOCONTROL", false, {IFCRELASSIGNS, IFCRELASSIGNS, IFCRELASSIGNS}},
+{IFCCSGPRIMITIVE3D, "IfcCsgPrimitive3D", "IFCCSGPRIMITIVE3D", false, {IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM}},
+{IFCELECTRICVOLTAGEMEASURE, "IfcElectricVoltageMeasure", "IFCELECTRICVOLTAGEMEASURE", false, {0, 0, 0}},
+{IFCLINEARDIMENSION, "IfcLinearDimension", "IFCLINEARDIMENSION", false, {IFCDIMENSIONCURVEDIRECTEDCALLOUT, 0, 0}},
+{IFCCONIC, "IfcConic", "IFCCONIC", false, {IFCCURVE, IFCCURVE, IFCCURVE}},
+{IFCSURFACE, "IfcSurface", "IFCSURFACE", false, {IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM}},
+{IFCSTRUCTURALANALYSISMODEL, "IfcStructuralAnalysisModel", "IFCSTRUCTURALANALYSISMODEL", false, {IFCSYSTEM, IFCSYSTEM, IFCSYSTEM}},
+{IFCPATH, "IfcPath", "IFCPATH", false, {IFCTOPOLOGICALREPRESENTATIONITEM, IFCTOPOLOGICALREPRESENTATIONITEM, IFCTOPOLOGICALREPRESENTATIONITEM}},
+{IFCSTRUCTURALLOADSTATIC, "IfcStructuralLoadStatic", "IFCSTRUCTURALLOADSTATIC", false, {IFCSTRUCTURALLOAD, IFCSTRUCTURALLOADORRESULT, IFCSTRUCTURALLOADORRESULT}},
+{IFCPARAMETERIZEDPROFILEDEF, "IfcParameterizedProfileDef", "IFCPARAMETERIZEDPROFILEDEF", false, {IFCPROFILEDEF, IFCPROFILEDEF, IFCPROFILEDEF}},
+{IFCSLABTYPE, "IfcSlabType", "IFCSLABTYPE", false, {IFCBUILDINGELEMENTTYPE, IFCBUILDINGELEMENTTYPE, IFCBUILTELEMENTTYPE}},
+{IFCDURATION, "IfcDuration", "IFCDURATION", false, {0, 0, 0}},
+{IFCCOMPLEXPROPERTY, "IfcComplexProperty", "IFCCOMPLEXPROPERTY", false, {IFCPROPERTY, IFCPROPERTY, IFCPROPERTY}},
+{IFCZSHAPEPROFILEDEF, "IfcZShapeProfileDef", "IFCZSHAPEPROFILEDEF", false, {IFCPARAMETERIZEDPROFILEDEF, IFCPARAMETERIZEDPROFILEDEF, IFCPARAMETERIZEDPROFILEDEF}},
+{IFCRELDECOMPOSES, "IfcRelDecomposes", "IFCRELDECOMPOSES", false, {IFCRELATIONSHIP, IFCRELATIONSHIP, IFCRELATIONSHIP}},
+{IFCTEXTUREMAP, "IfcTextureMap", "IFCTEXTUREMAP", false, {IFCTEXTURECOORDINATE, IFCTEXTURECOORDINATE, IFCTEXTURECOORDINATE}},
+{IFCFACE, "IfcFace", "IFCFACE", false, {IFCTOPOLOGICALREPRESENTATIONITEM, IFCTOPOLOGICALREPRESENTATIONITEM, IFCTOPOLOGICALREPRESENTATIONITEM}},
+{IFCPREDEFINEDCURVEFONT, "IfcPreDefinedCurveFont", "IFCPREDEFINEDCURVEFONT", false, {IFCPREDEFINEDITEM, IFCPREDEFINEDITEM, IFCPREDEFINEDITEM}},
+{IFCCONSTRUCTIONRESOURCE, "IfcConstructionResource", "IFCCONSTRUCTIONRESOURCE", false, {IFCRESOURCE, IFCRESOURCE, IFCRESOURCE}},
+{IFCRELDECLARES, "IfcRelDeclares", "IFCRELDECLARES", false, {0, IFCRELATIONSHIP, IFCRELATIONSHIP}},
+{IFCIMPACTPROTECTIONDEVICE, "IfcImpactProtectionDevice", "IFCIMPACTPROTECTIONDEVICE", true, {0, 0, IFCELEMENTCOMPONENT}},
+{IFCINDEXEDPOLYCURVE, "IfcIndexedPolyCurve", "IFCINDEXEDPOLYCURVE", false, {0, IFCBOUNDEDCURVE, IFCBOUNDEDCURVE}},
+{IFCREINFORCINGBARTYPE, "IfcReinforcingBarType", "IFCREINFORCINGBARTYPE", false, {0, IFCREINFORCINGELEMENTTYPE, IFCREINFORCINGELEMENTTYPE}},
+{IFCCONSTRUCTIONRESOURCETYPE, "IfcConstructionResourceType", "IFCCONSTRUCTIONRESOURCETYPE", false, {0, IFCTYPERESOURCE, IFCTYPERESOURCE}},
+{IFCBOUNDINGBOX, "IfcBoundingBox", "IFCBOUNDINGBOX", false, {IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM}},
+{IFCHOURINDAY, "IfcHourInDay", "IFCHOURINDAY", false, {0, 0, 0}},
+{IFCFONTWEIGHT, "IfcFontWeight", "IFCFONTWEIGHT", false, {0, 0, 0}},
+{IFCELEMENTCOMPONENTTYPE, "IfcElementComponentType", "IFCELEMENTCOMPONENTTYPE", false, {IFCELEMENTTYPE, IFCELEMENTTYPE, IFCELEMENTTYPE}},
+{IFCTIMESTAMP, "IfcTimeStamp", "IFCTIMESTAMP", false, {0, 0, 0}},
+{IFCVOLUMETRICFLOWRATEMEASURE, "IfcVolumetricFlowRateMeasure", "IFCVOLUMETRICFLOWRATEMEASURE", false, {0, 0, 0}},
+{IFCMEASUREWITHUNIT, "IfcMeasureWithUnit", "IFCMEASUREWITHUNIT", false, {0, 0, 0}},
+{IFCPROPERTY, "IfcProperty", "IFCPROPERTY", false, {0, IFCPROPERTYABSTRACTION, IFCPROPERTYABSTRACTION}},
+{IFCCURVE, "IfcCurve", "IFCCURVE", false, {IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM}},
+{IFCADVANCEDBREPWITHVOIDS, "IfcAdvancedBrepWithVoids", "IFCADVANCEDBREPWITHVOIDS", false, {0, IFCADVANCEDBREP, IFCADVANCEDBREP}},
+{IFCLIGHTSOURCEDIRECTIONAL, "IfcLightSourceDirectional", "IFCLIGHTSOURCEDIRECTIONAL", false, {IFCLIGHTSOURCE, IFCLIGHTSOURCE, IFCLIGHTSOURCE}},
+{IFCSLIPPAGECONNECTIONCONDITION, "IfcSlippageConnectionCondition", "IFCSLIPPAGECONNECTIONCONDITION", false, {IFCSTRUCTURALCONNECTIONCONDITION, IFCSTRUCTURALCONNECTIONCONDITION, IFCSTRUCTURALCONNECTIONCONDITION}},
+{IFCCIRCLE, "IfcCircle", "IFCCIRCLE", false, {IFCCONIC, IFCCONIC, IFCCONIC}},
+{IFCCONNECTIONPOINTGEOMETRY, "IfcConnectionPointGeometry", "IFCCONNECTIONPOINTGEOMETRY", false, {IFCCONNECTIONGEOMETRY, IFCCONNECTIONGEOMETRY, IFCCONNECTIONGEOMETRY}},
+{IFCMONETARYMEASURE, "IfcMonetaryMeasure", "IFCMONETARYMEASURE", false, {0, 0, 0}},
+{IFCLOCALPLACEMENT, "IfcLocalPlacement", "IFCLOCALPLACEMENT", false, {IFCOBJECTPLACEMENT, IFCOBJECTPLACEMENT, IFCOBJECTPLACEMENT}},
+{IFCCURVEBOUNDEDSURFACE, "IfcCurveBoundedSurface", "IFCCURVEBOUNDEDSURFACE", false, {0, IFCBOUNDEDSURFACE, IFCBOUNDEDSURFACE}},
+{IFCDISCRETEACCESSORYTYPE, "IfcDiscreteAccessoryType", "IFCDISCRETEACCESSORYTYPE", false, {IFCELEMENTCOMPONENTTYPE, IFCELEMENTCOMPONENTTYPE, IFCELEMENTCOMPONENTTYPE}},
+{IFCTEXTSTYLEFORDEFINEDFONT, "IfcTextStyleForDefinedFont", "IFCTEXTSTYLEFORDEFINEDFONT", false, {0, IFCPRESENTATIONITEM, IFCPRESENTATIONITEM}},
+{IFCPLANARFORCEMEASURE, "IfcPlanarForceMeasure", "IFCPLANARFORCEMEASURE", false, {0, 0, 0}},
+{IFCTHERMALCONDUCTIVITYMEASURE, "IfcThermalConductivityMeasure", "IFCTHERMALCONDUCTIVITYMEASURE", false, {0, 0, 0}},
+{IFCAREAMEASURE, "IfcAreaMeasure", "IFCAREAMEASURE", false, {0, 0, 0}},
+{IFCFIXEDREFERENCESWEPTAREASOLID, "IfcFixedReferenceSweptAreaSolid", "IFCFIXEDREFERENCESWEPTAREASOLID", false, {0, IFCSWEPTAREASOLID, IFCDIRECTRIXCURVESWEPTAREASOLID}},
+{IFCLIBRARYINFORMATION, "IfcLibraryInformation", "IFCLIBRARYINFORMATION", false, {0, IFCEXTERNALINFORMATION, IFCEXTERNALINFORMATION}},
+{IFCRELASSOCIATESMATERIAL, "IfcRelAssociatesMaterial", "IFCRELASSOCIATESMATERIAL", false, {IFCRELASSOCIATES, IFCRELASSOCIATES, IFCRELASSOCIATES}},
+{IFCOPENSHELL, "IfcOpenShell", "IFCOPENSHELL", false, {IFCCONNECTEDFACESET, IFCCONNECTEDFACESET, IFCCONNECTEDFACESET}},
+{IFCSTRUCTURALLOADPLANARFORCE, "IfcStructuralLoadPlanarForce", "IFCSTRUCTURALLOADPLANARFORCE", false, {IFCSTRUCTURALLOADSTATIC, IFCSTRUCTURALLOADSTATIC, IFCSTRUCTURALLOADSTATIC}},
+{IFCCABLEFITTINGTYPE, "IfcCableFittingType", "IFCCABLEFITTINGTYPE", false, {0, IFCFLOWFITTINGTYPE, IFCFLOWFITTINGTYPE}},
+{IFCINDUCTANCEMEASURE, "IfcInductanceMeasure", "IFCINDUCTANCEMEASURE", false, {0, 0, 0}},
+{IFCGEOMODEL, "IfcGeomodel", "IFCGEOMODEL", true, {0, 0, IFCGEOTECHNICALASSEMBLY}},
+{IFCQUANTITYNUMBER, "IfcQuantityNumber", "IFCQUANTITYNUMBER", false, {0, 0, IFCPHYSICALSIMPLEQUANTITY}},
+{IFCREFERENCESVALUEDOCUMENT, "IfcReferencesValueDocument", "IFCREFERENCESVALUEDOCUMENT", false, {0, 0, 0}},
+{IFCKERB, "IfcKerb", "IFCKERB", true, {0, 0, IFCBUILTELEMENT}},
+{IFCARBITRARYPROFILEDEFWITHVOIDS, "IfcArbitraryProfileDefWithVoids", "IFCARBITRARYPROFILEDEFWITHVOIDS", false, {IFCARBITRARYCLOSEDPROFILEDEF, IFCARBITRARYCLOSEDPROFILEDEF, IFCARBITRARYCLOSEDPROFILEDEF}},
+{IFCGROUP, "IfcGroup", "IFCGROUP", false, {IFCOBJECT, IFCOBJECT, IFCOBJECT}},
+{IFCSPATIALSTRUCTUREELEMENT, "IfcSpatialStructureElement", "IFCSPATIALSTRUCTUREELEMENT", true, {IFCPRODUCT, IFCSPATIALELEMENT, IFCSPATIALELEMENT}},
+{IFCMONETARYUNIT, "IfcMonetaryUnit", "IFCMONETARYUNIT", false, {0, 0, 0}},
+{IFCBOXEDHALFSPACE, "IfcBoxedHalfSpace", "IFCBOXEDHALFSPACE", false, {IFCHALFSPACESOLID, IFCHALFSPACESOLID, IFCHALFSPACESOLID}},
+{IFCCONVERSIONBASEDUNITWITHOFFSET, "IfcConversionBasedUnitWithOffset", "IFCCONVERSIONBASEDUNITWITHOFFSET", false, {0, IFCCONVERSIONBASEDUNIT, IFCCONVERSIONBASEDUNIT}},
+{IFCGEOTECHNICALASSEMBLY, "IfcGeotechnicalAssembly", "IFCGEOTECHNICALASSEMBLY", true, {0, 0, IFCGEOTECHNICALELEMENT}},
+{IFCTRAPEZIUMPROFILEDEF, "IfcTrapeziumProfileDef", "IFCTRAPEZIUMPROFILEDEF", false, {IFCPARAMETERIZEDPROFILEDEF, IFCPARAMETERIZEDPROFILEDEF, IFCPARAMETERIZEDPROFILEDEF}},
+{IFCFONTVARIANT, "IfcFontVariant", "IFCFONTVARIANT", false, {0, 0, 0}},
+{IFCTIMEMEASURE, "IfcTimeMeasure", "IFCTIMEMEASURE", false, {0, 0, 0}},
+{IFCRELASSOCIATESCONSTRAINT, "IfcRelAssociatesConstraint", "IFCRELASSOCIATESCONSTRAINT", false, {IFCRELASSOCIATES, IFCRELASSOCIATES, IFCRELASSOCIATES}},
+{IFCCONNECTIONSURFACEGEOMETRY, "IfcConnectionSurfaceGeometry", "IFCCONNECTIONSURFACEGEOMETRY", false, {IFCCONNECTIONGEOMETRY, IFCCONNECTIONGEOMETRY, IFCCONNECTIONGEOMETRY}},
+{IFCSPIRAL, "IfcSpiral", "IFCSPIRAL", false, {0, 0, IFCCURVE}},
+{IFCBOOLEAN, "IfcBoolean", "IFCBOOLEAN", false, {0, 0, 0}},
+{IFCBOOLEANRESULT, "IfcBooleanResult", "IFCBOOLEANRESULT", false, {IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM}},
+{IFCAXIS2PLACEMENT3D, "IfcAxis2Placement3D", "IFCAXIS2PLACEMENT3D", false, {IFCPLACEMENT, IFCPLACEMENT, IFCPLACEMENT}},
+{IFCPROCEDURE, "IfcProcedure", "IFCPROCEDURE", false, {IFCPROCESS, IFCPROCESS, IFCPROCESS}},
+{IFCPROPERTYLISTVALUE, "IfcPropertyListValue", "IFCPROPERTYLISTVALUE", false, {IFCSIMPLEPROPERTY, IFCSIMPLEPROPERTY, IFCSIMPLEPROPERTY}},
+{IFCLUMINOUSINTENSITYDISTRIBUTIONMEASURE, "IfcLuminousIntensityDistributionMeasure", "IFCLUMINOUSINTENSITYDISTRIBUTIONMEASURE", false, {0, 0, 0}},
+{IFCSTRUCTURALCURVEREACTION, "IfcStructuralCurveReaction", "IFCSTRUCTURALCURVEREACTION", true, {0, IFCSTRUCTURALREACTION, IFCSTRUCTURALREACTION}},
+{IFCSPECULAREXPONENT, "IfcSpecularExponent", "IFCSPECULAREXPONENT", false, {0, 0, 0}},
+{IFCVERTEXLOOP, "IfcVertexLoop", "IFCVERTEXLOOP", false, {IFCLOOP, IFCLOOP, IFCLOOP}},
+{IFCSECONDINMINUTE, "IfcSecondInMinute", "IFCSECONDINMINUTE", false, {0, 0, 0}},
+{IFCVIRTUALELEMENT, "IfcVirtualElement", "IFCVIRTUALELEMENT", true, {IFCELEMENT, IFCELEMENT, IFCELEMENT}},
+{IFCRECTANGLEHOLLOWPROFILEDEF, "IfcRectangleHollowProfileDef", "IFCRECTANGLEHOLLOWPROFILEDEF", false, {IFCRECTANGLEPROFILEDEF, IFCRECTANGLEPROFILEDEF, IFCRECTANGLEPROFILEDEF}},
+{IFCTASKTIMERECURRING, "IfcTaskTimeRecurring", "IFCTASKTIMERECURRING", false, {0, IFCTASKTIME, IFCTASKTIME}},
+{IFCPOLYGONALBOUNDEDHALFSPACE, "IfcPolygonalBoundedHalfSpace", "IFCPOLYGONALBOUNDEDHALFSPACE", false, {IFCHALFSPACESOLID, IFCHALFSPACESOLID, IFCHALFSPACESOLID}},
+{IFCELEMENTARYSURFACE, "IfcElementarySurface", "IFCELEMENTARYSURFACE", false, {IFCSURFACE, IFCSURFACE, IFCSURFACE}},
+{IFCROUNDEDRECTANGLEPROFILEDEF, "IfcRoundedRectangleProfileDef", "IFCROUNDEDRECTANGLEPROFILEDEF", false, {IFCRECTANGLEPROFILEDEF, IFCRECTANGLEPROFILEDEF, IFCRECTANGLEPROFILEDEF}},
+{IFCROOFTYPE, "IfcRoofType", "IFCROOFTYPE", false, {0, IFCBUILDINGELEMENTTYPE, IFCBUILTELEMENTTYPE}},
+{IFCPROPERTYSETDEFINITIONSET, "IfcPropertySetDefinitionSet", "IFCPROPERTYSETDEFINITIONSET", false, {0, 0, 0}},
+{IFCRECTANGULARPYRAMID, "IfcRectangularPyramid", "IFCRECTANGULARPYRAMID", false, {IFCCSGPRIMITIVE3D, IFCCSGPRIMITIVE3D, IFCCSGPRIMITIVE3D}},
+{IFCVERTEX, "IfcVertex", "IFCVERTEX", false, {IFCTOPOLOGICALREPRESENTATIONITEM, IFCTOPOLOGICALREPRESENTATIONITEM, IFCTOPOLOGICALREPRESENTATIONITEM}},
+{IFCTEXT, "IfcText", "IFCTEXT", false, {0, 0, 0}},
+{IFCRELCOVERSSPACES, "IfcRelCoversSpaces", "IFCRELCOVERSSPACES", false, {IFCRELCONNECTS, IFCRELCONNECTS, IFCRELCONNECTS}},
+{IFCPROFILEPROPERTIES, "IfcProfileProperties", "IFCPROFILEPROPERTIES", false, {0, IFCEXTENDEDPROPERTIES, IFCEXTENDEDPROPERTIES}},
+{IFCEXTRUDEDAREASOLIDTAPERED, "IfcExtrudedAreaSolidTapered", "IFCEXTRUDEDAREASOLIDTAPERED", false, {0, IFCEXTRUDEDAREASOLID, IFCEXTRUDEDAREASOLID}},
+{IFCSURFACEOFLINEAREXTRUSION, "IfcSurfaceOfLinearExtrusion", "IFCSURFACEOFLINEAREXTRUSION", false, {IFCSWEPTSURFACE, IFCSWEPTSURFACE, IFCSWEPTSURFACE}},
+{IFCENGINE, "IfcEngine", "IFCENGINE", true, {0, IFCENERGYCONVERSIONDEVICE, IFCENERGYCONVERSIONDEVICE}},
+{IFCPOSITIVELENGTHMEASURE, "IfcPositiveLengthMeasure", "IFCPOSITIVELENGTHMEASURE", false, {0, 0, 0}},
+{IFCCONDENSERTYPE, "IfcCondenserType", "IFCCONDENSERTYPE", false, {IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE}},
+{IFCFEATUREELEMENT, "IfcFeatureElement", "IFCFEATUREELEMENT", true, {IFCELEMENT, IFCELEMENT, IFCELEMENT}},
+{IFCCURVEBOUNDEDPLANE, "IfcCurveBoundedPlane", "IFCCURVEBOUNDEDPLANE", false, {IFCBOUNDEDSURFACE, IFCBOUNDEDSURFACE, IFCBOUNDEDSURFACE}},
+{IFCSTYLEMODEL, "IfcStyleModel", "IFCSTYLEMODEL", false, {IFCREPRESENTATION, IFCREPRESENTATION, IFCREPRESENTATION}},
+{IFCONEDIRECTIONREPEATFACTOR, "IfcOneDirectionRepeatFactor", "IFCONEDIRECTIONREPEATFACTOR", false, {IFCGEOMETRICREPRESENTATIONITEM, 0, 0}},
+{IFCELLIPSEPROFILEDEF, "IfcEllipseProfileDef", "IFCELLIPSEPROFILEDEF", false, {IFCPARAMETERIZEDPROFILEDEF, IFCPARAMETERIZEDPROFILEDEF, IFCPARAMETERIZEDPROFILEDEF}},
+{IFCOUTLETTYPE, "IfcOutletType", "IFCOUTLETTYPE", false, {IFCFLOWTERMINALTYPE, IFCFLOWTERMINALTYPE, IFCFLOWTERMINALTYPE}},
+{IFCPOLYGONALFACESET, "IfcPolygonalFaceSet", "IFCPOLYGONALFACESET", false, {0, IFCTESSELLATEDFACESET, IFCTESSELLATEDFACESET}},
+{IFCRELASSOCIATESPROFILEPROPERTIES, "IfcRelAssociatesProfileProperties", "IFCRELASSOCIATESPROFILEPROPERTIES", false, {IFCRELASSOCIATES, 0, 0}},
+{IFCMATERIALCONSTITUENTSET, "IfcMaterialConstituentSet", "IFCMATERIALCONSTITUENTSET", false, {0, IFCMATERIALDEFINITION, IFCMATERIALDEFINITION}},
+{IFCEXTERNALSPATIALSTRUCTUREELEMENT, "IfcExternalSpatialStructureElement", "IFCEXTERNALSPATIALSTRUCTUREELEMENT", true, {0, IFCSPATIALELEMENT, IFCSPATIALELEMENT}},
+{IFCRELASSIGNSTOPRODUCT, "IfcRelAssignsToProduct", "IFCRELASSIGNSTOPRODUCT", false, {IFCRELASSIGNS, IFCRELASSIGNS, IFCRELASSIGNS}},
+{IFCCONNECTIONGEOMETRY, "IfcConnectionGeometry", "IFCCONNECTIONGEOMETRY", false, {0, 0, 0}},
+{IFCRELASSIGNSTASKS, "IfcRelAssignsTasks", "IFCRELASSIGNSTASKS", false, {IFCRELASSIGNSTOCONTROL, 0, 0}},
+{IFCACTUATORTYPE, "IfcActuatorType", "IFCACTUATORTYPE", false, {IFCDISTRIBUTIONCONTROLELEMENTTYPE, IFCDISTRIBUTIONCONTROLELEMENTTYPE, IFCDISTRIBUTIONCONTROLELEMENTTYPE}},
+{IFCALIGNMENTPARAMETERSEGMENT, "IfcAlignmentParameterSegment", "IFCALIGNMENTPARAMETERSEGMENT", false, {0, 0, 0}},
+{IFCBSPLINESURFACE, "IfcBSplineSurface", "IFCBSPLINESURFACE", false, {0, IFCBOUNDEDSURFACE, IFCBOUNDEDSURFACE}},
+{IFCCONVERSIONBASEDUNIT, "IfcConversionBasedUnit", "IFCCONVERSIONBASEDUNIT", false, {IFCNAMEDUNIT, IFCNAMEDUNIT, IFCNAMEDUNIT}},
+{IFCRAILINGTYPE, "IfcRailingType", "IFCRAILINGTYPE", false, {IFCBUILDINGELEMENTTYPE, IFCBUILDINGELEMENTTYPE, IFCBUILTELEMENTTYPE}},
+{IFCGRADIENTCURVE, "IfcGradientCurve", "IFCGRADIENTCURVE", false, {0, 0, IFCCOMPOSITECURVE}},
+{IFCCSHAPEPROFILEDEF, "IfcCShapeProfileDef", "IFCCSHAPEPROFILEDEF", false, {IFCPARAMETERIZEDPROFILEDEF, IFCPARAMETERIZEDPROFILEDEF, IFCPARAMETERIZEDPROFILEDEF}},
+{IFCPROJECTORDER, "IfcProjectOrder", "IFCPROJECTORDER", false, {IFCCONTROL, IFCCONTROL, IFCCONTROL}},
+{IFCBEAMSTANDARDCASE, "IfcBeamStandardCase", "IFCBEAMSTANDARDCASE", true, {0, IFCBEAM, 0}},
+{IFCRESOURCE, "IfcResource", "IFCRESOURCE", false, {IFCOBJECT, IFCOBJECT, IFCOBJECT}},
+{IFCTRIANGULATEDFACESET, "IfcTriangulatedFaceSet", "IFCTRIANGULATEDFACESET", false, {0, IFCTESSELLATEDFACESET, IFCTESSELLATEDFACESET}},
+{IFCPOLYLOOP, "IfcPolyLoop", "IFCPOLYLOOP", false, {IFCLOOP, IFCLOOP, IFCLOOP}},
+{IFCSURFACEREINFORCEMENTAREA, "IfcSurfaceReinforcementArea", "IFCSURFACEREINFORCEMENTAREA", false, {0, IFCSTRUCTURALLOADORRESULT, IFCSTRUCTURALLOADORRESULT}},
+{IFCCIRCLEHOLLOWPROFILEDEF, "IfcCircleHollowProfileDef", "IFCCIRCLEHOLLOWPROFILEDEF", false, {IFCCIRCLEPROFILEDEF, IFCCIRCLEPROFILEDEF, IFCCIRCLEPROFILEDEF}},
+{IFCBURNER, "IfcBurner", "IFCBURNER", true, {0, IFCENERGYCONVERSIONDEVICE, IFCENERGYCONVERSIONDEVICE}},
+{IFCCONVEYORSEGMENTTYPE, "IfcConveyorSegmentType", "IFCCONVEYORSEGMENTTYPE", false, {0, 0, IFCFLOWSEGMENTTYPE}},
+{IFCRESOURCEAPPROVALRELATIONSHIP, "IfcResourceApprovalRelationship", "IFCRESOURCEAPPROVALRELATIONSHIP", false, {0, IFCRESOURCELEVELRELATIONSHIP, IFCRESOURCELEVELRELATIONSHIP}},
+{IFCPROCESS, "IfcProcess", "IFCPROCESS", false, {IFCOBJECT, IFCOBJECT, IFCOBJECT}},
+{IFCDIMENSIONALEXPONENTS, "IfcDimensionalExponents", "IFCDIMENSIONALEXPONENTS", false, {0, 0, 0}},
+{IFCCHILLERTYPE, "IfcChillerType", "IFCCHILLERTYPE", false, {IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE}},
+{IFCELECTRICRESISTANCEMEASURE, "IfcElectricResistanceMeasure", "IFCELECTRICRESISTANCEMEASURE", false, {0, 0, 0}},
+{IFCCOOLINGTOWERTYPE, "IfcCoolingTowerType", "IFCCOOLINGTOWERTYPE", false, {IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE}},
+{IFCDOORLININGPROPERTIES, "IfcDoorLiningProperties", "IFCDOORLININGPROPERTIES", false, {IFCPROPERTYSETDEFINITION, IFCPREDEFINEDPROPERTYSET, IFCPREDEFINEDPROPERTYSET}},
+{IFCBUILDINGELEMENTPART, "IfcBuildingElementPart", "IFCBUILDINGELEMENTPART", true, {IFCBUILDINGELEMENTCOMPONENT, IFCELEMENTCOMPONENT, IFCELEMENTCOMPONENT}},
+{IFCSTRUCTURALRESULTGROUP, "IfcStructuralResultGroup", "IFCSTRUCTURALRESULTGROUP", false, {IFCGROUP, IFCGROUP, IFCGROUP}},
+{IFCCOMPLEXNUMBER, "IfcComplexNumber", "IFCCOMPLEXNUMBER", false, {0, 0, 0}},
+{IFCMIRROREDPROFILEDEF, "IfcMirroredProfileDef", "IFCMIRROREDPROFILEDEF", false, {0, IFCDERIVEDPROFILEDEF, IFCDERIVEDPROFILEDEF}},
+{IFCALARMTYPE, "IfcAlarmType", "IFCALARMTYPE", false, {IFCDISTRIBUTIONCONTROLELEMENTTYPE, IFCDISTRIBUTIONCONTROLELEMENTTYPE, IFCDISTRIBUTIONCONTROLELEMENTTYPE}},
+{IFCFACESURFACE, "IfcFaceSurface", "IFCFACESURFACE", false, {IFCFACE, IFCFACE, IFCFACE}},
+{IFCREPRESENTATIONITEM, "IfcRepresentationItem", "IFCREPRESENTATIONITEM", false, {0, 0, 0}},
+{IFCGRID, "IfcGrid", "IFCGRID", true, {IFCPRODUCT, IFCPRODUCT, IFCPOSITIONINGELEMENT}},
+{IFCFLOWTREATMENTDEVICETYPE, "IfcFlowTreatmentDeviceType", "IFCFLOWTREATMENTDEVICETYPE", false, {IFCDISTRIBUTIONFLOWELEMENTTYPE, IFCDISTRIBUTIONFLOWELEMENTTYPE, IFCDISTRIBUTIONFLOWELEMENTTYPE}},
+{IFCIRREGULARTIMESERIESVALUE, "IfcIrregularTimeSeriesValue", "IFCIRREGULARTIMESERIESVALUE", false, {0, 0, 0}},
+{IFCPHYSICALCOMPLEXQUANTITY, "IfcPhysicalComplexQuantity", "IFCPHYSICALCOMPLEXQUANTITY", false, {IFCPHYSICALQUANTITY, IFCPHYSICALQUANTITY, IFCPHYSICALQUANTITY}},
+{IFCRAMP, "IfcRamp", "IFCRAMP", true, {IFCBUILDINGELEMENT, IFCBUILDINGELEMENT, IFCBUILTELEMENT}},
+{IFCTUBEBUNDLE, "IfcTubeBundle", "IFCTUBEBUNDLE", true, {0, IFCENERGYCONVERSIONDEVICE, IFCENERGYCONVERSIONDEVICE}},
+{IFCREINFORCINGELEMENT, "IfcReinforcingElement", "IFCREINFORCINGELEMENT", true, {IFCBUILDINGELEMENTCOMPONENT, IFCELEMENTCOMPONENT, IFCELEMENTCOMPONENT}},
+{IFCSLABSTANDARDCASE, "IfcSlabStandardCase", "IFCSLABSTANDARDCASE", true, {0, IFCSLAB, 0}},
+{IFCTERMINATORSYMBOL, "IfcTerminatorSymbol", "IFCTERMINATORSYMBOL", false, {IFCANNOTATIONSYMBOLOCCURRENCE, 0, 0}},
+{IFCDISTRIBUTIONFLOWELEMENT, "IfcDistributionFlowElement", "IFCDISTRIBUTIONFLOWELEMENT", true, {IFCDISTRIBUTIONELEMENT, IFCDISTRIBUTIONELEMENT, IFCDISTRIBUTIONELEMENT}},
+{IFCDISTRIBUTIONPORT, "IfcDistributionPort", "IFCDISTRIBUTIONPORT", true, {IFCPORT, IFCPORT, IFCPORT}},
+{IFCFREQUENCYMEASURE, "IfcFrequencyMeasure", "IFCFREQUENCYMEASURE", false, {0, 0, 0}},
+{IFCSTYLEDREPRESENTATION, "IfcStyledRepresentation", "IFCSTYLEDREPRESENTATION", false, {IFCSTYLEMODEL, IFCSTYLEMODEL, IFCSTYLEMODEL}},
+{IFCCONTEXTDEPENDENTUNIT, "IfcContextDependentUnit", "IFCCONTEXTDEPENDENTUNIT", false, {IFCNAMEDUNIT, IFCNAMEDUNIT, IFCNAMEDUNIT}},
+{IFCSANITARYTERMINAL, "IfcSanitaryTerminal", "IFCSANITARYTERMINAL", true, {0, IFCFLOWTERMINAL, IFCFLOWTERMINAL}},
+{IFCPOSITIVEPLANEANGLEMEASURE, "IfcPositivePlaneAngleMeasure", "IFCPOSITIVEPLANEANGLEMEASURE", false, {0, 0, 0}},
+{IFCRATIONALBEZIERCURVE, "IfcRationalBezierCurve", "IFCRATIONALBEZIERCURVE", false, {IFCBEZIERCURVE, 0, 0}},
+{IFCMAPCONVERSION, "IfcMapConversion", "IFCMAPCONVERSION", false, {0, IFCCOORDINATEOPERATION, IFCCOORDINATEOPERATION}},
+{IFCGLOBALLYUNIQUEID, "IfcGloballyUniqueId", "IFCGLOBALLYUNIQUEID", false, {0, 0, 0}},
+{IFCEARTHWORKSCUT, "IfcEarthworksCut", "IFCEARTHWORKSCUT", true, {0, 0, IFCFEATUREELEMENTSUBTRACTION}},
+{IFCTSHAPEPROFILEDEF, "IfcTShapeProfileDef", "IFCTSHAPEPROFILEDEF", false, {IFCPARAMETERIZEDPROFILEDEF, IFCPARAMETERIZEDPROFILEDEF, IFCPARAMETERIZEDPROFILEDEF}},
+{IFCDRAUGHTINGCALLOUT, "IfcDraughtingCallout", "IFCDRAUGHTINGCALLOUT", false, {IFCGEOMETRICREPRESENTATIONITEM, 0, 0}},
+{IFCMATERIALPROFILESETUSAGE, "IfcMaterialProfileSetUsage", "IFCMATERIALPROFILESETUSAGE", false, {0, IFCMATERIALUSAGEDEFINITION, IFCMATERIALUSAGEDEFINITION}},
+{IFCOPENINGSTANDARDCASE, "IfcOpeningStandardCase", "IFCOPENINGSTANDARDCASE", true, {0, IFCOPENINGELEMENT, 0}},
+{IFCTENDONANCHORTYPE, "IfcTendonAnchorType", "IFCTENDONANCHORTYPE", false, {0, IFCREINFORCINGELEMENTTYPE, IFCREINFORCINGELEMENTTYPE}},
+{IFCLINEARVELOCITYMEASURE, "IfcLinearVelocityMeasure", "IFCLINEARVELOCITYMEASURE", false, {0, 0, 0}},
+{IFCALARM, "IfcAlarm", "IFCALARM", true, {0, IFCDISTRIBUTIONCONTROLELEMENT, IFCDISTRIBUTIONCONTROLELEMENT}},
+{IFCTIMESERIES, "IfcTimeSeries", "IFCTIMESERIES", false, {0, 0, 0}},
+{IFCSURFACEFEATURE, "IfcSurfaceFeature", "IFCSURFACEFEATURE", true, {0, IFCFEATUREELEMENT, IFCFEATUREELEMENT}},
+{IFCSTACKTERMINALTYPE, "IfcStackTerminalType", "IFCSTACKTERMINALTYPE", false, {IFCFLOWTERMINALTYPE, IFCFLOWTERMINALTYPE, IFCFLOWTERMINALTYPE}},
+{IFCHEATFLUXDENSITYMEASURE, "IfcHeatFluxDensityMeasure", "IFCHEATFLUXDENSITYMEASURE", false, {0, 0, 0}},
+{IFCINTERSECTIONCURVE, "IfcIntersectionCurve", "IFCINTERSECTIONCURVE", false, {0, IFCSURFACECURVE, IFCSURFACECURVE}},
+{IFCMOMENTOFINERTIAMEASURE, "IfcMomentOfInertiaMeasure", "IFCMOMENTOFINERTIAMEASURE", false, {0, 0, 0}},
+{IFCPRESENTATIONSTYLE, "IfcPresentationStyle", "IFCPRESENTATIONSTYLE", false, {0, 0, 0}},
+{IFCBUILDINGSTOREY, "IfcBuildingStorey", "IFCBUILDINGSTOREY", true, {IFCSPATIALSTRUCTUREELEMENT, IFCSPATIALSTRUCTUREELEMENT, IFCSPATIALSTRUCTUREELEMENT}},
+{IFCMASSMEASURE, "IfcMassMeasure", "IFCMASSMEASURE", false, {0, 0, 0}},
+{IFCTEXTLITERALWITHEXTENT, "IfcTextLiteralWithExtent", "IFCTEXTLITERALWITHEXTENT", false, {IFCTEXTLITERAL, IFCTEXTLITERAL, IFCTEXTLITERAL}},
+{IFCAXIS2PLACEMENT2D, "IfcAxis2Placement2D", "IFCAXIS2PLACEMENT2D", false, {IFCPLACEMENT, IFCPLACEMENT, IFCPLACEMENT}},
+{IFCSLABELEMENTEDCASE, "IfcSlabElementedCase", "IFCSLABELEMENTEDCASE", true, {0, IFCSLAB, 0}},
+{IFCFLOWMOVINGDEVICE, "IfcFlowMovingDevice", "IFCFLOWMOVINGDEVICE", true, {IFCDISTRIBUTIONFLOWELEMENT, IFCDISTRIBUTIONFLOWELEMENT, IFCDISTRIBUTIONFLOWELEMENT}},
+{IFCSTRUCTURALITEM, "IfcStructuralItem", "IFCSTRUCTURALITEM", true, {IFCPRODUCT, IFCPRODUCT, IFCPRODUCT}},
+{IFCCENTERLINEPROFILEDEF, "IfcCenterLineProfileDef", "IFCCENTERLINEPROFILEDEF", false, {IFCARBITRARYOPENPROFILEDEF, IFCARBITRARYOPENPROFILEDEF, IFCARBITRARYOPENPROFILEDEF}},
+{IFCPLATE, "IfcPlate", "IFCPLATE", true, {IFCBUILDINGELEMENT, IFCBUILDINGELEMENT, IFCBUILTELEMENT}},
+{IFCEVAPORATIVECOOLERTYPE, "IfcEvaporativeCoolerType", "IFCEVAPORATIVECOOLERTYPE", false, {IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE}},
+{IFCMOISTUREDIFFUSIVITYMEASURE, "IfcMoistureDiffusivityMeasure", "IFCMOISTUREDIFFUSIVITYMEASURE", false, {0, 0, 0}},
+{IFCUNITARYCONTROLELEMENTTYPE, "IfcUnitaryControlElementType", "IFCUNITARYCONTROLELEMENTTYPE", false, {0, IFCDISTRIBUTIONCONTROLELEMENTTYPE, IFCDISTRIBUTIONCONTROLELEMENTTYPE}},
+{IFCMEMBERTYPE, "IfcMemberType", "IFCMEMBERTYPE", false, {IFCBUILDINGELEMENTTYPE, IFCBUILDINGELEMENTTYPE, IFCBUILTELEMENTTYPE}},
+{IFCRELCONNECTSPORTS, "IfcRelConnectsPorts", "IFCRELCONNECTSPORTS", false, {IFCRELCONNECTS, IFCRELCONNECTS, IFCRELCONNECTS}},
+{IFCISOTHERMALMOISTURECAPACITYMEASURE, "IfcIsothermalMoistureCapacityMeasure", "IFCISOTHERMALMOISTURECAPACITYMEASURE", false, {0, 0, 0}},
+{IFCFLOWFITTINGTYPE, "IfcFlowFittingType", "IFCFLOWFITTINGTYPE", false, {IFCDISTRIBUTIONFLOWELEMENTTYPE, IFCDISTRIBUTIONFLOWELEMENTTYPE, IFCDISTRIBUTIONFLOWELEMENTTYPE}},
+{IFCEXTERNALREFERENCE, "IfcExternalReference", "IFCEXTERNALREFERENCE", false, {0, 0, 0}},
+{IFCCAISSONFOUNDATIONTYPE, "IfcCaissonFoundationType", "IFCCAISSONFOUNDATIONTYPE", false, {0, 0, IFCDEEPFOUNDATIONTYPE}},
+{IFCDISTRIBUTIONSYSTEM, "IfcDistributionSystem", "IFCDISTRIBUTIONSYSTEM", false, {0, IFCSYSTEM, IFCSYSTEM}},
+{IFCTASKTYPE, "IfcTaskType", "IFCTASKTYPE", false, {0, IFCTYPEPROCESS, IFCTYPEPROCESS}},
+{IFCEXTERNALLYDEFINEDSYMBOL, "IfcExternallyDefinedSymbol", "IFCEXTERNALLYDEFINEDSYMBOL", false, {IFCEXTERNALREFERENCE, 0, 0}},
+{IFCASYMMETRICISHAPEPROFILEDEF, "IfcAsymmetricIShapeProfileDef", "IFCASYMMETRICISHAPEPROFILEDEF", false, {IFCISHAPEPROFILEDEF, IFCPARAMETERIZEDPROFILEDEF, IFCPARAMETERIZEDPROFILEDEF}},
+{IFCROTATIONALSTIFFNESSMEASURE, "IfcRotationalStiffnessMeasure", "IFCROTATIONALSTIFFNESSMEASURE", false, {0, 0, 0}},
+{IFCPREDEFINEDTERMINATORSYMBOL, "IfcPreDefinedTerminatorSymbol", "IFCPREDEFINEDTERMINATORSYMBOL", false, {IFCPREDEFINEDSYMBOL, 0, 0}},
+{IFCPROXY, "IfcProxy", "IFCPROXY", true, {IFCPRODUCT, IFCPRODUCT, 0}},
+{IFCCOMMUNICATIONSAPPLIANCE, "IfcCommunicationsAppliance", "IFCCOMMUNICATIONSAPPLIANCE", true, {0, IFCFLOWTERMINAL, IFCFLOWTERMINAL}},
+{IFCCONTEXTDEPENDENTMEASURE, "IfcContextDependentMeasure", "IFCCONTEXTDEPENDENTMEASURE", false, {0, 0, 0}},
+{IFCDOORSTANDARDCASE, "IfcDoorStandardCase", "IFCDOORSTANDARDCASE", true, {0, IFCDOOR, 0}},
+{IFCRELCONTAINEDINSPATIALSTRUCTURE, "IfcRelContainedInSpatialStructure", "IFCRELCONTAINEDINSPATIALSTRUCTURE", false, {IFCRELCONNECTS, IFCRELCONNECTS, IFCRELCONNECTS}},
+{IFCREVOLVEDAREASOLIDTAPERED, "IfcRevolvedAreaSolidTapered", "IFCREVOLVEDAREASOLIDTAPERED", false, {0, IFCREVOLVEDAREASOLID, IFCREVOLVEDAREASOLID}},
+{IFCRADIUSDIMENSION, "IfcRadiusDimension", "IFCRADIUSDIMENSION", false, {IFCDIMENSIONCURVEDIRECTEDCALLOUT, 0, 0}},
+{IFCQUANTITYTIME, "IfcQuantityTime", "IFCQUANTITYTIME", false, {IFCPHYSICALSIMPLEQUANTITY, IFCPHYSICALSIMPLEQUANTITY, IFCPHYSICALSIMPLEQUANTITY}},
+{IFCDISTRIBUTIONELEMENTTYPE, "IfcDistributionElementType", "IFCDISTRIBUTIONELEMENTTYPE", false, {IFCELEMENTTYPE, IFCELEMENTTYPE, IFCELEMENTTYPE}},
+{IFCLABEL, "IfcLabel", "IFCLABEL", false, {0, 0, 0}},
+{IFCCOLOURSPECIFICATION, "IfcColourSpecification", "IFCCOLOURSPECIFICATION", false, {0, IFCPRESENTATIONITEM, IFCPRESENTATIONITEM}},
+{IFCMATERIALPROPERTIES, "IfcMaterialProperties", "IFCMATERIALPROPERTIES", false, {0, IFCEXTENDEDPROPERTIES, IFCEXTENDEDPROPERTIES}},
+{IFCRELNESTS, "IfcRelNests", "IFCRELNESTS", false, {IFCRELDECOMPOSES, IFCRELDECOMPOSES, IFCRELDECOMPOSES}},
+{IFCEQUIPMENTSTANDARD, "IfcEquipmentStandard", "IFCEQUIPMENTSTANDARD", false, {IFCCONTROL, 0, 0}},
+{IFCELECTRICFLOWSTORAGEDEVICETYPE, "IfcElectricFlowStorageDeviceType", "IFCELECTRICFLOWSTORAGEDEVICETYPE", false, {IFCFLOWSTORAGEDEVICETYPE, IFCFLOWSTORAGEDEVICETYPE, IFCFLOWSTORAGEDEVICETYPE}},
+{IFCRAMPFLIGHT, "IfcRampFlight", "IFCRAMPFLIGHT", true, {IFCBUILDINGELEMENT, IFCBUILDINGELEMENT, IFCBUILTELEMENT}},
+{IFCCOLOURRGBLIST, "IfcColourRgbList", "IFCCOLOURRGBLIST", false, {0, IFCPRESENTATIONITEM, IFCPRESENTATIONITEM}},
+{IFCANNOTATIONCURVEOCCURRENCE, "IfcAnnotationCurveOccurrence", "IFCANNOTATIONCURVEOCCURRENCE", false, {IFCANNOTATIONOCCURRENCE, 0, 0}},
+{IFCRAIL, "IfcRail", "IFCRAIL", true, {0, 0, IFCBUILTELEMENT}},
+{IFCCONTROL, "IfcControl", "IFCCONTROL", false, {IFCOBJECT, IFCOBJECT, IFCOBJECT}},
+{IFCCABLECARRIERSEGMENTTYPE, "IfcCableCarrierSegmentType", "IFCCABLECARRIERSEGMENTTYPE", false, {IFCFLOWSEGMENTTYPE, IFCFLOWSEGMENTTYPE, IFCFLOWSEGMENTTYPE}},
+{IFCCREWRESOURCE, "IfcCrewResource", "IFCCREWRESOURCE", false, {IFCCONSTRUCTIONRESOURCE, IFCCONSTRUCTIONRESOURCE, IFCCONSTRUCTIONRESOURCE}},
+{IFCCHIMNEY, "IfcChimney", "IFCCHIMNEY", true, {0, IFCBUILDINGELEMENT, IFCBUILTELEMENT}},
+{IFCBUILDINGELEMENT, "IfcBuildingElement", "IFCBUILDINGELEMENT", true, {IFCELEMENT, IFCELEMENT, 0}},
+{IFCSURFACESTYLELIGHTING, "IfcSurfaceStyleLighting", "IFCSURFACESTYLELIGHTING", false, {0, IFCPRESENTATIONITEM, IFCPRESENTATIONITEM}},
+{IFCMATERIALLAYERSET, "IfcMaterialLayerSet", "IFCMATERIALLAYERSET", false, {0, IFCMATERIALDEFINITION, IFCMATERIALDEFINITION}},
+{IFCWINDOW, "IfcWindow", "IFCWINDOW", true, {IFCBUILDINGELEMENT, IFCBUILDINGELEMENT, IFCBUILTELEMENT}},
+{IFCVERTEXBASEDTEXTUREMAP, "IfcVertexBasedTextureMap", "IFCVERTEXBASEDTEXTUREMAP", false, {0, 0, 0}},
+{IFCELECTRICFLOWSTORAGEDEVICE, "IfcElectricFlowStorageDevice", "IFCELECTRICFLOWSTORAGEDEVICE", true, {0, IFCFLOWSTORAGEDEVICE, IFCFLOWSTORAGEDEVICE}},
+{IFCVIBRATIONISOLATORTYPE, "IfcVibrationIsolatorType", "IFCVIBRATIONISOLATORTYPE", false, {IFCDISCRETEACCESSORYTYPE, IFCELEMENTCOMPONENTTYPE, IFCELEMENTCOMPONENTTYPE}},
+{IFCBOREHOLE, "IfcBorehole", "IFCBOREHOLE", true, {0, 0, IFCGEOTECHNICALASSEMBLY}},
+{IFCTHERMALMATERIALPROPERTIES, "IfcThermalMaterialProperties", "IFCTHERMALMATERIALPROPERTIES", false, {IFCMATERIALPROPERTIES, 0, 0}},
+{IFCHEATEXCHANGER, "IfcHeatExchanger", "IFCHEATEXCHANGER", true, {0, IFCENERGYCONVERSIONDEVICE, IFCENERGYCONVERSIONDEVICE}},
+{IFCPERMIT, "IfcPermit", "IFCPERMIT", false, {IFCCONTROL, IFCCONTROL, IFCCONTROL}},
+{IFCCARTESIANTRANSFORMATIONOPERATOR3D, "IfcCartesianTransformationOperator3D", "IFCCARTESIANTRANSFORMATIONOPERATOR3D", false, {IFCCARTESIANTRANSFORMATIONOPERATOR, IFCCARTESIANTRANSFORMATIONOPERATOR, IFCCARTESIANTRANSFORMATIONOPERATOR}},
+{IFCMODULUSOFELASTICITYMEASURE, "IfcModulusOfElasticityMeasure", "IFCMODULUSOFELASTICITYMEASURE", false, {0, 0, 0}},
+{IFCWORKSCHEDULE, "IfcWorkSchedule", "IFCWORKSCHEDULE", false, {IFCWORKCONTROL, IFCWORKCONTROL, IFCWORKCONTROL}},
+{IFCVAPORPERMEABILITYMEASURE, "IfcVaporPermeabilityMeasure", "IFCVAPORPERMEABILITYMEASURE", false, {0, 0, 0}},
+{IFCAIRTERMINALTYPE, "IfcAirTerminalType", "IFCAIRTERMINALTYPE", false, {IFCFLOWTERMINALTYPE, IFCFLOWTERMINALTYPE, IFCFLOWTERMINALTYPE}},
+{IFCPOSTALADDRESS, "IfcPostalAddress", "IFCPOSTALADDRESS", false, {IFCADDRESS, IFCADDRESS, IFCADDRESS}},
+{IFCPROPERTYSETDEFINITION, "IfcPropertySetDefinition", "IFCPROPERTYSETDEFINITION", false, {IFCPROPERTYDEFINITION, IFCPROPERTYDEFINITION, IFCPROPERTYDEFINITION}},
+{IFCILLUMINANCEMEASURE, "IfcIlluminanceMeasure", "IFCILLUMINANCEMEASURE", false, {0, 0, 0}},
+{IFCBOUNDARYFACECONDITION, "IfcBoundaryFaceCondition", "IFCBOUNDARYFACECONDITION", false, {IFCBOUNDARYCONDITION, IFCBOUNDARYCONDITION, IFCBOUNDARYCONDITION}},
+{IFCMETRIC, "IfcMetric", "IFCMETRIC", false, {IFCCONSTRAINT, IFCCONSTRAINT, IFCCONSTRAINT}},
+{IFCRELASSIGNSTOPROJECTORDER, "IfcRelAssignsToProjectOrder", "IFCRELASSIGNSTOPROJECTORDER", false, {IFCRELASSIGNSTOCONTROL, 0, 0}},
+{IFCEARTHWORKSFILL, "IfcEarthworksFill", "IFCEARTHWORKSFILL", true, {0, 0, IFCEARTHWORKSELEMENT}},
+{IFCREPRESENTATIONCONTEXT, "IfcRepresentationContext", "IFCREPRESENTATIONCONTEXT", false, {0, 0, 0}},
+{IFCPOLYNOMIALCURVE, "IfcPolynomialCurve", "IFCPOLYNOMIALCURVE", false, {0, 0, IFCCURVE}},
+{IFCOFFSETCURVE2D, "IfcOffsetCurve2D", "IFCOFFSETCURVE2D", false, {IFCCURVE, IFCCURVE, IFCOFFSETCURVE}},
+{IFCEVAPORATORTYPE, "IfcEvaporatorType", "IFCEVAPORATORTYPE", false, {IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE, IFCENERGYCONVERSIONDEVICETYPE}},
+{IFCMATERIALPROFILESETUSAGETAPERING, "IfcMaterialProfileSetUsageTapering", "IFCMATERIALPROFILESETUSAGETAPERING", false, {0, IFCMATERIALPROFILESETUSAGE, IFCMATERIALPROFILESETUSAGE}},
+{IFCADVANCEDFACE, "IfcAdvancedFace", "IFCADVANCEDFACE", false, {0, IFCFACESURFACE, IFCFACESURFACE}},
+{IFCSTRUCTURALLOADTEMPERATURE, "IfcStructuralLoadTemperature", "IFCSTRUCTURALLOADTEMPERATURE", false, {IFCSTRUCTURALLOADSTATIC, IFCSTRUCTURALLOADSTATIC, IFCSTRUCTURALLOADSTATIC}},
+{IFCREGULARTIMESERIES, "IfcRegularTimeSeries", "IFCREGULARTIMESERIES", false, {IFCTIMESERIES, IFCTIMESERIES, IFCTIMESERIES}},
+{IFCFAN, "IfcFan", "IFCFAN", true, {0, IFCFLOWMOVINGDEVICE, IFCFLOWMOVINGDEVICE}},
+{IFCCONTEXT, "IfcContext", "IFCCONTEXT", false, {0, IFCOBJECTDEFINITION, IFCOBJECTDEFINITION}},
+{IFCSOLARDEVICE, "IfcSolarDevice", "IFCSOLARDEVICE", true, {0, IFCENERGYCONVERSIONDEVICE, IFCENERGYCONVERSIONDEVICE}},
+{IFCLIGHTSOURCESPOT, "IfcLightSourceSpot", "IFCLIGHTSOURCESPOT", false, {IFCLIGHTSOURCEPOSITIONAL, IFCLIGHTSOURCEPOSITIONAL, IFCLIGHTSOURCEPOSITIONAL}},
+{IFCAXIS2PLACEMENTLINEAR, "IfcAxis2PlacementLinear", "IFCAXIS2PLACEMENTLINEAR", false, {0, 0, IFCPLACEMENT}},
+{IFCORDERACTION, "IfcOrderAction", "IFCORDERACTION", false, {IFCTASK, 0, 0}},
+{IFCTRACKELEMENT, "IfcTrackElement", "IFCTRACKELEMENT", true, {0, 0, IFCBUILTELEMENT}},
+{IFCDEEPFOUNDATION, "IfcDeepFoundation", "IFCDEEPFOUNDATION", true, {0, 0, IFCBUILTELEMENT}},
+{IFCGEOMETRICREPRESENTATIONCONTEXT, "IfcGeometricRepresentationContext", "IFCGEOMETRICREPRESENTATIONCONTEXT", false, {IFCREPRESENTATIONCONTEXT, IFCREPRESENTATIONCONTEXT, IFCREPRESENTATIONCONTEXT}},
+{IFCRELSPACEBOUNDARY, "IfcRelSpaceBoundary", "IFCRELSPACEBOUNDARY", false, {IFCRELCONNECTS, IFCRELCONNECTS, IFCRELCONNECTS}},
+{IFCLIBRARYREFERENCE, "IfcLibraryReference", "IFCLIBRARYREFERENCE", false, {IFCEXTERNALREFERENCE, IFCEXTERNALREFERENCE, IFCEXTERNALREFERENCE}},
+{IFCRECTANGULARTRIMMEDSURFACE, "IfcRectangularTrimmedSurface", "IFCRECTANGULARTRIMMEDSURFACE", false, {IFCBOUNDEDSURFACE, IFCBOUNDEDSURFACE, IFCBOUNDEDSURFACE}},
+{IFCFLUIDFLOWPROPERTIES, "IfcFluidFlowProperties", "IFCFLUIDFLOWPROPERTIES", false, {IFCPROPERTYSETDEFINITION, 0, 0}},
+{IFCSOUNDPRESSURELEVELMEASURE, "IfcSoundPressureLevelMeasure", "IFCSOUNDPRESSURELEVELMEASURE", false, {0, 0, 0}},
+{IFCVOLUMEMEASURE, "IfcVolumeMeasure", "IFCVOLUMEMEASURE", false, {0, 0, 0}},
+{IFCASSET, "IfcAsset", "IFCASSET", false, {IFCGROUP, IFCGROUP, IFCGROUP}},
+{IFCCONVEYORSEGMENT, "IfcConveyorSegment", "IFCCONVEYORSEGMENT", true, {0, 0, IFCFLOWSEGMENT}},
+{IFCINDEXEDPOLYGONALTEXTUREMAP, "IfcIndexedPolygonalTextureMap", "IFCINDEXEDPOLYGONALTEXTUREMAP", false, {0, 0, IFCINDEXEDTEXTUREMAP}},
+{IFCSECTIONMODULUSMEASURE, "IfcSectionModulusMeasure", "IFCSECTIONMODULUSMEASURE", false, {0, 0, 0}},
+{IFCSOLIDANGLEMEASURE, "IfcSolidAngleMeasure", "IFCSOLIDANGLEMEASURE", false, {0, 0, 0}},
+{IFCTASK, "IfcTask", "IFCTASK", false, {IFCPROCESS, IFCPROCESS, IFCPROCESS}},
+{IFCSPECIFICHEATCAPACITYMEASURE, "IfcSpecificHeatCapacityMeasure", "IFCSPECIFICHEATCAPACITYMEASURE", false, {0, 0, 0}},
+{IFCSTRUCTURALLOADCONFIGURATION, "IfcStructuralLoadConfiguration", "IFCSTRUCTURALLOADCONFIGURATION", false, {0, IFCSTRUCTURALLOAD, IFCSTRUCTURALLOAD}},
+{IFCCARTESIANTRANSFORMATIONOPERATOR2DNONUNIFORM, "IfcCartesianTransformationOperator2DnonUniform", "IFCCARTESIANTRANSFORMATIONOPERATOR2DNONUNIFORM", false, {IFCCARTESIANTRANSFORMATIONOPERATOR2D, IFCCARTESIANTRANSFORMATIONOPERATOR2D, IFCCARTESIANTRANSFORMATIONOPERATOR2D}},
+{IFCTEXTDECORATION, "IfcTextDecoration", "IFCTEXTDECORATION", false, {0, 0, 0}},
+{IFCGEOGRAPHICELEMENT, "IfcGeographicElement", "IFCGEOGRAPHICELEMENT", true, {0, IFCELEMENT, IFCELEMENT}},
+{IFCCURTAINWALL, "IfcCurtainWall", "IFCCURTAINWALL", true, {IFCBUILDINGELEMENT, IFCBUILDINGELEMENT, IFCBUILTELEMENT}},
+{IFCCLOTHOID, "IfcClothoid", "IFCCLOTHOID", false, {0, 0, IFCSPIRAL}},
+{IFCOFFSETCURVE3D, "IfcOffsetCurve3D", "IFCOFFSETCURVE3D", false, {IFCCURVE, IFCCURVE, IFCOFFSETCURVE}},
+{IFCFLOWTREATMENTDEVICE, "IfcFlowTreatmentDevice", "IFCFLOWTREATMENTDEVICE", true, {IFCDISTRIBUTIONFLOWELEMENT, IFCDISTRIBUTIONFLOWELEMENT, IFCDISTRIBUTIONFLOWELEMENT}},
+{IFCCURVESTYLEFONTPATTERN, "IfcCurveStyleFontPattern", "IFCCURVESTYLEFONTPATTERN", false, {0, IFCPRESENTATIONITEM, IFCPRESENTATIONITEM}},
+{IFCWALLSTANDARDCASE, "IfcWallStandardCase", "IFCWALLSTANDARDCASE", true, {IFCWALL, IFCWALL, IFCWALL}},
+{IFCSCHEDULETIMECONTROL, "IfcScheduleTimeControl", "IFCSCHEDULETIMECONTROL", false, {IFCCONTROL, 0, 0}},
+{IFCDUCTSEGMENT, "IfcDuctSegment", "IFCDUCTSEGMENT", true, {0, IFCFLOWSEGMENT, IFCFLOWSEGMENT}},
+{IFCPROPERTYTEMPLATE, "IfcPropertyTemplate", "IFCPROPERTYTEMPLATE", false, {0, IFCPROPERTYTEMPLATEDEFINITION, IFCPROPERTYTEMPLATEDEFINITION}},
+{IFCRELSPACEBOUNDARY1STLEVEL, "IfcRelSpaceBoundary1stLevel", "IFCRELSPACEBOUNDARY1STLEVEL", false, {0, IFCRELSPACEBOUNDARY, IFCRELSPACEBOUNDARY}},
+{IFCMASSPERLENGTHMEASURE, "IfcMassPerLengthMeasure", "IFCMASSPERLENGTHMEASURE", false, {0, 0, 0}},
+{IFCSTRUCTURALACTIVITY, "IfcStructuralActivity", "IFCSTRUCTURALACTIVITY", true, {IFCPRODUCT, IFCPRODUCT, IFCPRODUCT}},
+{IFCEXTERNALLYDEFINEDTEXTFONT, "IfcExternallyDefinedTextFont", "IFCEXTERNALLYDEFINEDTEXTFONT", false, {IFCEXTERNALREFERENCE, IFCEXTERNALREFERENCE, IFCEXTERNALREFERENCE}},
+{IFCPERMEABLECOVERINGPROPERTIES, "IfcPermeableCoveringProperties", "IFCPERMEABLECOVERINGPROPERTIES", false, {IFCPROPERTYSETDEFINITION, IFCPREDEFINEDPROPERTYSET, IFCPREDEFINEDPROPERTYSET}},
+{IFCINDEXEDCOLOURMAP, "IfcIndexedColourMap", "IFCINDEXEDCOLOURMAP", false, {0, IFCPRESENTATIONITEM, IFCPRESENTATIONITEM}},
+{IFCCOMPRESSOR, "IfcCompressor", "IFCCOMPRESSOR", true, {0, IFCFLOWMOVINGDEVICE, IFCFLOWMOVINGDEVICE}},
+{IFCOPENINGELEMENT, "IfcOpeningElement", "IFCOPENINGELEMENT", true, {IFCFEATUREELEMENTSUBTRACTION, IFCFEATUREELEMENTSUBTRACTION, IFCFEATUREELEMENTSUBTRACTION}},
+{IFCGEOMETRICSET, "IfcGeometricSet", "IFCGEOMETRICSET", false, {IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM}},
+{IFCTRIMMEDCURVE, "IfcTrimmedCurve", "IFCTRIMMEDCURVE", false, {IFCBOUNDEDCURVE, IFCBOUNDEDCURVE, IFCBOUNDEDCURVE}},
+{IFCSIGNTYPE, "IfcSignType", "IFCSIGNTYPE", false, {0, 0, IFCELEMENTCOMPONENTTYPE}},
+{IFCTEXTUREVERTEXLIST, "IfcTextureVertexList", "IFCTEXTUREVERTEXLIST", false, {0, IFCPRESENTATIONITEM, IFCPRESENTATIONITEM}},
+{IFCPIPESEGMENT, "IfcPipeSegment", "IFCPIPESEGMENT", true, {0, IFCFLOWSEGMENT, IFCFLOWSEGMENT}},
+{IFCANNOTATIONSYMBOLOCCURRENCE, "IfcAnnotationSymbolOccurrence", "IFCANNOTATIONSYMBOLOCCURRENCE", false, {IFCANNOTATIONOCCURRENCE, 0, 0}},
+{IFCRECTANGLEPROFILEDEF, "IfcRectangleProfileDef", "IFCRECTANGLEPROFILEDEF", false, {IFCPARAMETERIZEDPROFILEDEF, IFCPARAMETERIZEDPROFILEDEF, IFCPARAMETERIZEDPROFILEDEF}},
+{IFCRIGHTCIRCULARCYLINDER, "IfcRightCircularCylinder", "IFCRIGHTCIRCULARCYLINDER", false, {IFCCSGPRIMITIVE3D, IFCCSGPRIMITIVE3D, IFCCSGPRIMITIVE3D}},
+{IFCACTORROLE, "IfcActorRole", "IFCACTORROLE", false, {0, 0, 0}},
+{IFCDERIVEDPROFILEDEF, "IfcDerivedProfileDef", "IFCDERIVEDPROFILEDEF", false, {IFCPROFILEDEF, IFCPROFILEDEF, IFCPROFILEDEF}},
+{IFCALIGNMENTVERTICALSEGMENT, "IfcAlignmentVerticalSegment", "IFCALIGNMENTVERTICALSEGMENT", false, {0, 0, IFCALIGNMENTPARAMETERSEGMENT}},
+{IFCCLASSIFICATIONNOTATIONFACET, "IfcClassificationNotationFacet", "IFCCLASSIFICATIONNOTATIONFACET", false, {0, 0, 0}},
+{IFCCOOLINGTOWER, "IfcCoolingTower", "IFCCOOLINGTOWER", true, {0, IFCENERGYCONVERSIONDEVICE, IFCENERGYCONVERSIONDEVICE}},
+{IFCPROJECTORDERRECORD, "IfcProjectOrderRecord", "IFCPROJECTORDERRECORD", false, {IFCCONTROL, 0, 0}},
+{IFCBOOLEANCLIPPINGRESULT, "IfcBooleanClippingResult", "IFCBOOLEANCLIPPINGRESULT", false, {IFCBOOLEANRESULT, IFCBOOLEANRESULT, IFCBOOLEANRESULT}},
+{IFCBEARINGTYPE, "IfcBearingType", "IFCBEARINGTYPE", false, {0, 0, IFCBUILTELEMENTTYPE}},
+{IFCSECONDORDERPOLYNOMIALSPIRAL, "IfcSecondOrderPolynomialSpiral", "IFCSECONDORDERPOLYNOMIALSPIRAL", false, {0, 0, IFCSPIRAL}},
+{IFCPROPERTYSINGLEVALUE, "IfcPropertySingleValue", "IFCPROPERTYSINGLEVALUE", false, {IFCSIMPLEPROPERTY, IFCSIMPLEPROPERTY, IFCSIMPLEPROPERTY}},
+{IFCPROJECTIONELEMENT, "IfcProjectionElement", "IFCPROJECTIONELEMENT", true, {IFCFEATUREELEMENTADDITION, IFCFEATUREELEMENTADDITION, IFCFEATUREELEMENTADDITION}},
+{IFCVEHICLETYPE, "IfcVehicleType", "IFCVEHICLETYPE", false, {0, 0, IFCTRANSPORTATIONDEVICETYPE}},
+{IFCSTRUCTURALSTEELPROFILEPROPERTIES, "IfcStructuralSteelProfileProperties", "IFCSTRUCTURALSTEELPROFILEPROPERTIES", false, {IFCSTRUCTURALPROFILEPROPERTIES, 0, 0}},
+{IFCSTRUCTURALSURFACEACTION, "IfcStructuralSurfaceAction", "IFCSTRUCTURALSURFACEACTION", true, {0, IFCSTRUCTURALACTION, IFCSTRUCTURALACTION}},
+{IFCTENDONCONDUIT, "IfcTendonConduit", "IFCTENDONCONDUIT", true, {0, 0, IFCREINFORCINGELEMENT}},
+{IFCSIMPLEPROPERTYTEMPLATE, "IfcSimplePropertyTemplate", "IFCSIMPLEPROPERTYTEMPLATE", false, {0, IFCPROPERTYTEMPLATE, IFCPROPERTYTEMPLATE}},
+{IFCPRESSUREMEASURE, "IfcPressureMeasure", "IFCPRESSUREMEASURE", false, {0, 0, 0}},
+{IFCTRANSPORTATIONDEVICETYPE, "IfcTransportationDeviceType", "IFCTRANSPORTATIONDEVICETYPE", false, {0, 0, IFCELEMENTTYPE}},
+{IFCRELCONNECTSWITHREALIZINGELEMENTS, "IfcRelConnectsWithRealizingElements", "IFCRELCONNECTSWITHREALIZINGELEMENTS", false, {IFCRELCONNECTSELEMENTS, IFCRELCONNECTSELEMENTS, IFCRELCONNECTSELEMENTS}},
+{IFCRIBPLATEPROFILEPROPERTIES, "IfcRibPlateProfileProperties", "IFCRIBPLATEPROFILEPROPERTIES", false, {IFCPROFILEPROPERTIES, 0, 0}},
+{IFCARCINDEX, "IfcArcIndex", "IFCARCINDEX", false, {0, 0, 0}},
+{IFCIONCONCENTRATIONMEASURE, "IfcIonConcentrationMeasure", "IFCIONCONCENTRATIONMEASURE", false, {0, 0, 0}},
+{IFCSTRUCTURALREACTION, "IfcStructuralReaction", "IFCSTRUCTURALREACTION", true, {IFCSTRUCTURALACTIVITY, IFCSTRUCTURALACTIVITY, IFCSTRUCTURALACTIVITY}},
+{IFCSIMPLEPROPERTY, "IfcSimpleProperty", "IFCSIMPLEPROPERTY", false, {IFCPROPERTY, IFCPROPERTY, IFCPROPERTY}},
+{IFCDISTRIBUTIONBOARD, "IfcDistributionBoard", "IFCDISTRIBUTIONBOARD", true, {0, 0, IFCFLOWCONTROLLER}},
+{IFCOUTLET, "IfcOutlet", "IFCOUTLET", true, {0, IFCFLOWTERMINAL, IFCFLOWTERMINAL}},
+{IFCTYPERESOURCE, "IfcTypeResource", "IFCTYPERESOURCE", false, {0, IFCTYPEOBJECT, IFCTYPEOBJECT}},
+{IFCABSORBEDDOSEMEASURE, "IfcAbsorbedDoseMeasure", "IFCABSORBEDDOSEMEASURE", false, {0, 0, 0}},
+{IFCELECTRICDISTRIBUTIONPOINT, "IfcElectricDistributionPoint", "IFCELECTRICDISTRIBUTIONPOINT", true, {IFCFLOWCONTROLLER, 0, 0}},
+{IFCDAYINWEEKNUMBER, "IfcDayInWeekNumber", "IFCDAYINWEEKNUMBER", false, {0, 0, 0}},
+{IFCOBJECTPLACEMENT, "IfcObjectPlacement", "IFCOBJECTPLACEMENT", false, {0, 0, 0}},
+{IFCMATERIALCONSTITUENT, "IfcMaterialConstituent", "IFCMATERIALCONSTITUENT", false, {0, IFCMATERIALDEFINITION, IFCMATERIALDEFINITION}},
+{IFCPROPERTYENUMERATION, "IfcPropertyEnumeration", "IFCPROPERTYENUMERATION", false, {0, IFCPROPERTYABSTRACTION, IFCPROPERTYABSTRACTION}},
+{IFCPOLYLINE, "IfcPolyline", "IFCPOLYLINE", false, {IFCBOUNDEDCURVE, IFCBOUNDEDCURVE, IFCBOUNDEDCURVE}},
+{IFCPREDEFINEDITEM, "IfcPreDefinedItem", "IFCPREDEFINEDITEM", false, {0, IFCPRESENTATIONITEM, IFCPRESENTATIONITEM}},
+{IFCDOCUMENTREFERENCE, "IfcDocumentReference", "IFCDOCUMENTREFERENCE", false, {IFCEXTERNALREFERENCE, IFCEXTERNALREFERENCE, IFCEXTERNALREFERENCE}},
+{IFCCOMPOSITECURVE, "IfcCompositeCurve", "IFCCOMPOSITECURVE", false, {IFCBOUNDEDCURVE, IFCBOUNDEDCURVE, IFCBOUNDEDCURVE}},
+{IFCTYPEPROCESS, "IfcTypeProcess", "IFCTYPEPROCESS", false, {0, IFCTYPEOBJECT, IFCTYPEOBJECT}},
+{IFCFACETEDBREPWITHVOIDS, "IfcFacetedBrepWithVoids", "IFCFACETEDBREPWITHVOIDS", false, {IFCMANIFOLDSOLIDBREP, IFCFACETEDBREP, IFCFACETEDBREP}},
+{IFCPORT, "IfcPort", "IFCPORT", true, {IFCPRODUCT, IFCPRODUCT, IFCPRODUCT}},
+{IFCIRREGULARTIMESERIES, "IfcIrregularTimeSeries", "IFCIRREGULARTIMESERIES", false, {IFCTIMESERIES, IFCTIMESERIES, IFCTIMESERIES}},
+{IFCEVAPORATIVECOOLER, "IfcEvaporativeCooler", "IFCEVAPORATIVECOOLER", true, {0, IFCENERGYCONVERSIONDEVICE, IFCENERGYCONVERSIONDEVICE}},
+{IFCCARTESIANTRANSFORMATIONOPERATOR2D, "IfcCartesianTransformationOperator2D", "IFCCARTESIANTRANSFORMATIONOPERATOR2D", false, {IFCCARTESIANTRANSFORMATIONOPERATOR, IFCCARTESIANTRANSFORMATIONOPERATOR, IFCCARTESIANTRANSFORMATIONOPERATOR}},
+{IFCALIGNMENTCANTSEGMENT, "IfcAlignmentCantSegment", "IFCALIGNMENTCANTSEGMENT", false, {0, 0, IFCALIGNMENTPARAMETERSEGMENT}},
+{IFCCABLECARRIERSEGMENT, "IfcCableCarrierSegment", "IFCCABLECARRIERSEGMENT", true, {0, IFCFLOWSEGMENT, IFCFLOWSEGMENT}},
+{IFCDUCTSEGMENTTYPE, "IfcDuctSegmentType", "IFCDUCTSEGMENTTYPE", false, {IFCFLOWSEGMENTTYPE, IFCFLOWSEGMENTTYPE, IFCFLOWSEGMENTTYPE}},
+{IFCREINFORCEMENTDEFINITIONPROPERTIES, "IfcReinforcementDefinitionProperties", "IFCREINFORCEMENTDEFINITIONPROPERTIES", false, {IFCPROPERTYSETDEFINITION, IFCPREDEFINEDPROPERTYSET, IFCPREDEFINEDPROPERTYSET}},
+{IFCPREDEFINEDPROPERTIES, "IfcPreDefinedProperties", "IFCPREDEFINEDPROPERTIES", false, {0, IFCPROPERTYABSTRACTION, IFCPROPERTYABSTRACTION}},
+{IFCELECTRICCURRENTMEASURE, "IfcElectricCurrentMeasure", "IFCELECTRICCURRENTMEASURE", false, {0, 0, 0}},
+{IFCDRAUGHTINGCALLOUTRELATIONSHIP, "IfcDraughtingCalloutRelationship", "IFCDRAUGHTINGCALLOUTRELATIONSHIP", false, {0, 0, 0}},
+{IFCARBITRARYCLOSEDPROFILEDEF, "IfcArbitraryClosedProfileDef", "IFCARBITRARYCLOSEDPROFILEDEF", false, {IFCPROFILEDEF, IFCPROFILEDEF, IFCPROFILEDEF}},
+{IFCREINFORCEDSOIL, "IfcReinforcedSoil", "IFCREINFORCEDSOIL", true, {0, 0, IFCEARTHWORKSELEMENT}},
+{IFCCURVESTYLE, "IfcCurveStyle", "IFCCURVESTYLE", false, {IFCPRESENTATIONSTYLE, IFCPRESENTATIONSTYLE, IFCPRESENTATIONSTYLE}},
+{IFCINTEGERCOUNTRATEMEASURE, "IfcIntegerCountRateMeasure", "IFCINTEGERCOUNTRATEMEASURE", false, {0, 0, 0}},
+{IFCSPACETYPE, "IfcSpaceType", "IFCSPACETYPE", false, {IFCSPATIALSTRUCTUREELEMENTTYPE, IFCSPATIALSTRUCTUREELEMENTTYPE, IFCSPATIALSTRUCTUREELEMENTTYPE}},
+{IFCCOMPOUNDPLANEANGLEMEASURE, "IfcCompoundPlaneAngleMeasure", "IFCCOMPOUNDPLANEANGLEMEASURE", false, {0, 0, 0}},
+{IFCFLOWMETERTYPE, "IfcFlowMeterType", "IFCFLOWMETERTYPE", false, {IFCFLOWCONTROLLERTYPE, IFCFLOWCONTROLLERTYPE, IFCFLOWCONTROLLERTYPE}},
+{IFCRELADHERESTOELEMENT, "IfcRelAdheresToElement", "IFCRELADHERESTOELEMENT", false, {0, 0, IFCRELDECOMPOSES}},
+{IFCELECTRICCHARGEMEASURE, "IfcElectricChargeMeasure", "IFCELECTRICCHARGEMEASURE", false, {0, 0, 0}},
+{IFCACTIONREQUEST, "IfcActionRequest", "IFCACTIONREQUEST", false, {IFCCONTROL, IFCCONTROL, IFCCONTROL}},
+{IFCTENDON, "IfcTendon", "IFCTENDON", true, {IFCREINFORCINGELEMENT, IFCREINFORCINGELEMENT, IFCREINFORCINGELEMENT}},
+{IFCTRANSFORMER, "IfcTransformer", "IFCTRANSFORMER", true, {0, IFCENERGYCONVERSIONDEVICE, IFCENERGYCONVERSIONDEVICE}},
+{IFCLABORRESOURCE, "IfcLaborResource", "IFCLABORRESOURCE", false, {IFCCONSTRUCTIONRESOURCE, IFCCONSTRUCTIONRESOURCE, IFCCONSTRUCTIONRESOURCE}},
+{IFCRELASSOCIATESLIBRARY, "IfcRelAssociatesLibrary", "IFCRELASSOCIATESLIBRARY", false, {IFCRELASSOCIATES, IFCRELASSOCIATES, IFCRELASSOCIATES}},
+{IFCSTRUCTURALPROFILEPROPERTIES, "IfcStructuralProfileProperties", "IFCSTRUCTURALPROFILEPROPERTIES", false, {IFCGENERALPROFILEPROPERTIES, 0, 0}},
+{IFCPROJECTEDCRS, "IfcProjectedCRS", "IFCPROJECTEDCRS", false, {0, IFCCOORDINATEREFERENCESYSTEM, IFCCOORDINATEREFERENCESYSTEM}},
+{IFCDISTRIBUTIONFLOWELEMENTTYPE, "IfcDistributionFlowElementType", "IFCDISTRIBUTIONFLOWELEMENTTYPE", false, {IFCDISTRIBUTIONELEMENTTYPE, IFCDISTRIBUTIONELEMENTTYPE, IFCDISTRIBUTIONELEMENTTYPE}},
+{IFCCOMPRESSORTYPE, "IfcCompressorType", "IFCCOMPRESSORTYPE", false, {IFCFLOWMOVINGDEVICETYPE, IFCFLOWMOVINGDEVICETYPE, IFCFLOWMOVINGDEVICETYPE}},
+{IFCSPACE, "IfcSpace", "IFCSPACE", true, {IFCSPATIALSTRUCTUREELEMENT, IFCSPATIALSTRUCTUREELEMENT, IFCSPATIALSTRUCTUREELEMENT}},
+{IFCFUELPROPERTIES, "IfcFuelProperties", "IFCFUELPROPERTIES", false, {IFCMATERIALPROPERTIES, 0, 0}},
+{IFCBUILTSYSTEM, "IfcBuiltSystem", "IFCBUILTSYSTEM", false, {0, 0, IFCSYSTEM}},
+{IFCAPPROVALRELATIONSHIP, "IfcApprovalRelationship", "IFCAPPROVALRELATIONSHIP", false, {0, IFCRESOURCELEVELRELATIONSHIP, IFCRESOURCELEVELRELATIONSHIP}},
+{IFCCOMPLEXPROPERTYTEMPLATE, "IfcComplexPropertyTemplate", "IFCCOMPLEXPROPERTYTEMPLATE", false, {0, IFCPROPERTYTEMPLATE, IFCPROPERTYTEMPLATE}},
+{IFCOBJECT, "IfcObject", "IFCOBJECT", false, {IFCOBJECTDEFINITION, IFCOBJECTDEFINITION, IFCOBJECTDEFINITION}},
+{IFCSPATIALSTRUCTUREELEMENTTYPE, "IfcSpatialStructureElementType", "IFCSPATIALSTRUCTUREELEMENTTYPE", false, {IFCELEMENTTYPE, IFCSPATIALELEMENTTYPE, IFCSPATIALELEMENTTYPE}},
+{IFCCIVILELEMENTTYPE, "IfcCivilElementType", "IFCCIVILELEMENTTYPE", false, {0, IFCELEMENTTYPE, IFCELEMENTTYPE}},
+{IFCCOSTITEM, "IfcCostItem", "IFCCOSTITEM", false, {IFCCONTROL, IFCCONTROL, IFCCONTROL}},
+{IFCPROPERTYCONSTRAINTRELATIONSHIP, "IfcPropertyConstraintRelationship", "IFCPROPERTYCONSTRAINTRELATIONSHIP", false, {0, 0, 0}},
+{IFCCONSTRUCTIONEQUIPMENTRESOURCE, "IfcConstructionEquipmentResource", "IFCCONSTRUCTIONEQUIPMENTRESOURCE", false, {IFCCONSTRUCTIONRESOURCE, IFCCONSTRUCTIONRESOURCE, IFCCONSTRUCTIONRESOURCE}},
+{IFCEDGE, "IfcEdge", "IFCEDGE", false, {IFCTOPOLOGICALREPRESENTATIONITEM, IFCTOPOLOGICALREPRESENTATIONITEM, IFCTOPOLOGICALREPRESENTATIONITEM}},
+{IFCCHILLER, "IfcChiller", "IFCCHILLER", true, {0, IFCENERGYCONVERSIONDEVICE, IFCENERGYCONVERSIONDEVICE}},
+{IFCIMAGETEXTURE, "IfcImageTexture", "IFCIMAGETEXTURE", false, {IFCSURFACETEXTURE, IFCSURFACETEXTURE, IFCSURFACETEXTURE}},
+{IFCFLOWCONTROLLERTYPE, "IfcFlowControllerType", "IFCFLOWCONTROLLERTYPE", false, {IFCDISTRIBUTIONFLOWELEMENTTYPE, IFCDISTRIBUTIONFLOWELEMENTTYPE, IFCDISTRIBUTIONFLOWELEMENTTYPE}},
+{IFCRELCONNECTSSTRUCTURALELEMENT, "IfcRelConnectsStructuralElement", "IFCRELCONNECTSSTRUCTURALELEMENT", false, {IFCRELCONNECTS, 0, 0}},
+{IFCRECURRENCEPATTERN, "IfcRecurrencePattern", "IFCRECURRENCEPATTERN", false, {0, 0, 0}},
+{IFCRELASSIGNS, "IfcRelAssigns", "IFCRELASSIGNS", false, {IFCRELATIONSHIP, IFCRELATIONSHIP, IFCRELATIONSHIP}},
+{IFCRELFILLSELEMENT, "IfcRelFillsElement", "IFCRELFILLSELEMENT", false, {IFCRELCONNECTS, IFCRELCONNECTS, IFCRELCONNECTS}},
+{IFCRELCONNECTSPATHELEMENTS, "IfcRelConnectsPathElements", "IFCRELCONNECTSPATHELEMENTS", false, {IFCRELCONNECTSELEMENTS, IFCRELCONNECTSELEMENTS, IFCRELCONNECTSELEMENTS}},
+{IFCINTERCEPTORTYPE, "IfcInterceptorType", "IFCINTERCEPTORTYPE", false, {0, IFCFLOWTREATMENTDEVICETYPE, IFCFLOWTREATMENTDEVICETYPE}},
+{IFCIMPACTPROTECTIONDEVICETYPE, "IfcImpactProtectionDeviceType", "IFCIMPACTPROTECTIONDEVICETYPE", false, {0, 0, IFCELEMENTCOMPONENTTYPE}},
+{IFCVIBRATIONDAMPERTYPE, "IfcVibrationDamperType", "IFCVIBRATIONDAMPERTYPE", false, {0, 0, IFCELEMENTCOMPONENTTYPE}},
+{IFCSTYLEDITEM, "IfcStyledItem", "IFCSTYLEDITEM", false, {IFCREPRESENTATIONITEM, IFCREPRESENTATIONITEM, IFCREPRESENTATIONITEM}},
+{IFCPROFILEDEF, "IfcProfileDef", "IFCPROFILEDEF", false, {0, 0, 0}},
+{IFCDAMPERTYPE, "IfcDamperType", "IFCDAMPERTYPE", false, {IFCFLOWCONTROLLERTYPE, IFCFLOWCONTROLLERTYPE, IFCFLOWCONTROLLERTYPE}},
+{IFCPREDEFINEDPROPERTYSET, "IfcPreDefinedPropertySet", "IFCPREDEFINEDPROPERTYSET", false, {0, IFCPROPERTYSETDEFINITION, IFCPROPERTYSETDEFINITION}},
+{IFCRADIOACTIVITYMEASURE, "IfcRadioActivityMeasure", "IFCRADIOACTIVITYMEASURE", false, {0, 0, 0}},
+{IFCSTRUCTURALSURFACEMEMBER, "IfcStructuralSurfaceMember", "IFCSTRUCTURALSURFACEMEMBER", true, {IFCSTRUCTURALMEMBER, IFCSTRUCTURALMEMBER, IFCSTRUCTURALMEMBER}},
+{IFCSHAPEMODEL, "IfcShapeModel", "IFCSHAPEMODEL", false, {IFCREPRESENTATION, IFCREPRESENTATION, IFCREPRESENTATION}},
+{IFCSTRUCTURALPLANARACTIONVARYING, "IfcStructuralPlanarActionVarying", "IFCSTRUCTURALPLANARACTIONVARYING", true, {IFCSTRUCTURALPLANARACTION, 0, 0}},
+{IFCRAILWAY, "IfcRailway", "IFCRAILWAY", true, {0, 0, IFCFACILITY}},
+{IFCCAISSONFOUNDATION, "IfcCaissonFoundation", "IFCCAISSONFOUNDATION", true, {0, 0, IFCDEEPFOUNDATION}},
+{IFCDRAUGHTINGPREDEFINEDCURVEFONT, "IfcDraughtingPreDefinedCurveFont", "IFCDRAUGHTINGPREDEFINEDCURVEFONT", false, {IFCPREDEFINEDCURVEFONT, IFCPREDEFINEDCURVEFONT, IFCPREDEFINEDCURVEFONT}},
+{IFCWINDOWTYPE, "IfcWindowType", "IFCWINDOWTYPE", false, {0, IFCBUILDINGELEMENTTYPE, IFCBUILTELEMENTTYPE}},
+{IFCSPHERICALSURFACE, "IfcSphericalSurface", "IFCSPHERICALSURFACE", false, {0, IFCELEMENTARYSURFACE, IFCELEMENTARYSURFACE}},
+{IFCPLATETYPE, "IfcPlateType", "IFCPLATETYPE", false, {IFCBUILDINGELEMENTTYPE, IFCBUILDINGELEMENTTYPE, IFCBUILTELEMENTTYPE}},
+{IFCMASSFLOWRATEMEASURE, "IfcMassFlowRateMeasure", "IFCMASSFLOWRATEMEASURE", false, {0, 0, 0}},
+{IFCREFERENT, "IfcReferent", "IFCREFERENT", true, {0, 0, IFCPOSITIONINGELEMENT}},
+{IFCPOINTONCURVE, "IfcPointOnCurve", "IFCPOINTONCURVE", false, {IFCPOINT, IFCPOINT, IFCPOINT}},
+{IFCEVENTTYPE, "IfcEventType", "IFCEVENTTYPE", false, {0, IFCTYPEPROCESS, IFCTYPEPROCESS}},
+{IFCBUILDING, "IfcBuilding", "IFCBUILDING", true, {IFCSPATIALSTRUCTUREELEMENT, IFCSPATIALSTRUCTUREELEMENT, IFCFACILITY}},
+{IFCBOUNDARYCONDITION, "IfcBoundaryCondition", "IFCBOUNDARYCONDITION", false, {0, 0, 0}},
+{IFCFLOWINSTRUMENTTYPE, "IfcFlowInstrumentType", "IFCFLOWINSTRUMENTTYPE", false, {IFCDISTRIBUTIONCONTROLELEMENTTYPE, IFCDISTRIBUTIONCONTROLELEMENTTYPE, IFCDISTRIBUTIONCONTROLELEMENTTYPE}},
+{IFCPLANEANGLEMEASURE, "IfcPlaneAngleMeasure", "IFCPLANEANGLEMEASURE", false, {0, 0, 0}},
+{IFCDIMENSIONCURVETERMINATOR, "IfcDimensionCurveTerminator", "IFCDIMENSIONCURVETERMINATOR", false, {IFCTERMINATORSYMBOL, 0, 0}},
+{IFCYEARNUMBER, "IfcYearNumber", "IFCYEARNUMBER", false, {0, 0, 0}},
+{IFCSTRUCTUREDDIMENSIONCALLOUT, "IfcStructuredDimensionCallout", "IFCSTRUCTUREDDIMENSIONCALLOUT", false, {IFCDRAUGHTINGCALLOUT, 0, 0}},
+{IFCDAMPER, "IfcDamper", "IFCDAMPER", true, {0, IFCFLOWCONTROLLER, IFCFLOWCONTROLLER}},
+{IFCSHADINGDEVICETYPE, "IfcShadingDeviceType", "IFCSHADINGDEVICETYPE", false, {0, IFCBUILDINGELEMENTTYPE, IFCBUILTELEMENTTYPE}},
+{IFCTIME, "IfcTime", "IFCTIME", false, {0, 0, 0}},
+{IFCSENSOR, "IfcSensor", "IFCSENSOR", true, {0, IFCDISTRIBUTIONCONTROLELEMENT, IFCDISTRIBUTIONCONTROLELEMENT}},
+{IFCWORKCALENDAR, "IfcWorkCalendar", "IFCWORKCALENDAR", false, {0, IFCCONTROL, IFCCONTROL}},
+{IFCGEOGRAPHICELEMENTTYPE, "IfcGeographicElementType", "IFCGEOGRAPHICELEMENTTYPE", false, {0, IFCELEMENTTYPE, IFCELEMENTTYPE}},
+{IFCRELASSOCIATESAPPROVAL, "IfcRelAssociatesApproval", "IFCRELASSOCIATESAPPROVAL", false, {IFCRELASSOCIATES, IFCRELASSOCIATES, IFCRELASSOCIATES}},
+{IFCSUBCONTRACTRESOURCETYPE, "IfcSubContractResourceType", "IFCSUBCONTRACTRESOURCETYPE", false, {0, IFCCONSTRUCTIONRESOURCETYPE, IFCCONSTRUCTIONRESOURCETYPE}},
+{IFCSITE, "IfcSite", "IFCSITE", true, {IFCSPATIALSTRUCTUREELEMENT, IFCSPATIALSTRUCTUREELEMENT, IFCSPATIALSTRUCTUREELEMENT}},
+{IFCSERVICELIFE, "IfcServiceLife", "IFCSERVICELIFE", false, {IFCCONTROL, 0, 0}},
+{IFCCONSTRUCTIONMATERIALRESOURCETYPE, "IfcConstructionMaterialResourceType", "IFCCONSTRUCTIONMATERIALRESOURCETYPE", false, {0, IFCCONSTRUCTIONRESOURCETYPE, IFCCONSTRUCTIONRESOURCETYPE}},
+{IFCRELSEQUENCE, "IfcRelSequence", "IFCRELSEQUENCE", false, {IFCRELCONNECTS, IFCRELCONNECTS, IFCRELCONNECTS}},
+{IFCELEMENTASSEMBLY, "IfcElementAssembly", "IFCELEMENTASSEMBLY", true, {IFCELEMENT, IFCELEMENT, IFCELEMENT}},
+{IFCSHELLBASEDSURFACEMODEL, "IfcShellBasedSurfaceModel", "IFCSHELLBASEDSURFACEMODEL", false, {IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM}},
+{IFCSURFACEOFREVOLUTION, "IfcSurfaceOfRevolution", "IFCSURFACEOFREVOLUTION", false, {IFCSWEPTSURFACE, IFCSWEPTSURFACE, IFCSWEPTSURFACE}},
+{IFCCRANERAILASHAPEPROFILEDEF, "IfcCraneRailAShapeProfileDef", "IFCCRANERAILASHAPEPROFILEDEF", false, {IFCPARAMETERIZEDPROFILEDEF, 0, 0}},
+{IFCDIMENSIONCOUNT, "IfcDimensionCount", "IFCDIMENSIONCOUNT", false, {0, 0, 0}},
+{IFCCOOLEDBEAM, "IfcCooledBeam", "IFCCOOLEDBEAM", true, {0, IFCENERGYCONVERSIONDEVICE, IFCENERGYCONVERSIONDEVICE}},
+{IFCGEOMETRICREPRESENTATIONSUBCONTEXT, "IfcGeometricRepresentationSubContext", "IFCGEOMETRICREPRESENTATIONSUBCONTEXT", false, {IFCGEOMETRICREPRESENTATIONCONTEXT, IFCGEOMETRICREPRESENTATIONCONTEXT, IFCGEOMETRICREPRESENTATIONCONTEXT}},
+{IFCOCCUPANT, "IfcOccupant", "IFCOCCUPANT", false, {IFCACTOR, IFCACTOR, IFCACTOR}},
+{IFCDIAMETERDIMENSION, "IfcDiameterDimension", "IFCDIAMETERDIMENSION", false, {IFCDIMENSIONCURVEDIRECTEDCALLOUT, 0, 0}},
+{IFCEVENT, "IfcEvent", "IFCEVENT", false, {0, IFCPROCESS, IFCPROCESS}},
+{IFCWALLELEMENTEDCASE, "IfcWallElementedCase", "IFCWALLELEMENTEDCASE", true, {0, IFCWALL, 0}},
+{IFCSOUNDPOWERLEVELMEASURE, "IfcSoundPowerLevelMeasure", "IFCSOUNDPOWERLEVELMEASURE", false, {0, 0, 0}},
+{IFCRIGHTCIRCULARCONE, "IfcRightCircularCone", "IFCRIGHTCIRCULARCONE", false, {IFCCSGPRIMITIVE3D, IFCCSGPRIMITIVE3D, IFCCSGPRIMITIVE3D}},
+{IFCLIGHTDISTRIBUTIONDATA, "IfcLightDistributionData", "IFCLIGHTDISTRIBUTIONDATA", false, {0, 0, 0}},
+{IFCSECTIONREINFORCEMENTPROPERTIES, "IfcSectionReinforcementProperties", "IFCSECTIONREINFORCEMENTPROPERTIES", false, {0, IFCPREDEFINEDPROPERTIES, IFCPREDEFINEDPROPERTIES}},
+{IFCPROPERTYENUMERATEDVALUE, "IfcPropertyEnumeratedValue", "IFCPROPERTYENUMERATEDVALUE", false, {IFCSIMPLEPROPERTY, IFCSIMPLEPROPERTY, IFCSIMPLEPROPERTY}},
+{IFCDRAUGHTINGPREDEFINEDTEXTFONT, "IfcDraughtingPreDefinedTextFont", "IFCDRAUGHTINGPREDEFINEDTEXTFONT", false, {IFCPREDEFINEDTEXTFONT, 0, 0}},
+{IFCINTERCEPTOR, "IfcInterceptor", "IFCINTERCEPTOR", true, {0, IFCFLOWTREATMENTDEVICE, IFCFLOWTREATMENTDEVICE}},
+{IFCACCELERATIONMEASURE, "IfcAccelerationMeasure", "IFCACCELERATIONMEASURE", false, {0, 0, 0}},
+{IFCBOUNDEDSURFACE, "IfcBoundedSurface", "IFCBOUNDEDSURFACE", false, {IFCSURFACE, IFCSURFACE, IFCSURFACE}},
+{IFCRELDEFINESBYPROPERTIES, "IfcRelDefinesByProperties", "IFCRELDEFINESBYPROPERTIES", false, {IFCRELDEFINES, IFCRELDEFINES, IFCRELDEFINES}},
+{IFCCOURSETYPE, "IfcCourseType", "IFCCOURSETYPE", false, {0, 0, IFCBUILTELEMENTTYPE}},
+{IFCRELINTERACTIONREQUIREMENTS, "IfcRelInteractionRequirements", "IFCRELINTERACTIONREQUIREMENTS", false, {IFCRELCONNECTS, 0, 0}},
+{IFCPROJECTIONCURVE, "IfcProjectionCurve", "IFCPROJECTIONCURVE", false, {IFCANNOTATIONCURVEOCCURRENCE, 0, 0}},
+{IFCBEARING, "IfcBearing", "IFCBEARING", true, {0, 0, IFCBUILTELEMENT}},
+{IFCRELCONNECTSPORTTOELEMENT, "IfcRelConnectsPortToElement", "IFCRELCONNECTSPORTTOELEMENT", false, {IFCRELCONNECTS, IFCRELCONNECTS, IFCRELCONNECTS}},
+{IFCFILLAREASTYLETILESYMBOLWITHSTYLE, "IfcFillAreaStyleTileSymbolWithStyle", "IFCFILLAREASTYLETILESYMBOLWITHSTYLE", false, {IFCGEOMETRICREPRESENTATIONITEM, 0, 0}},
+{IFCVALVE, "IfcValve", "IFCVALVE", true, {0, IFCFLOWCONTROLLER, IFCFLOWCONTROLLER}},
+{IFCPRODUCT, "IfcProduct", "IFCPRODUCT", true, {IFCOBJECT, IFCOBJECT, IFCOBJECT}},
+{IFCCURVESEGMENT, "IfcCurveSegment", "IFCCURVESEGMENT", false, {0, 0, IFCSEGMENT}},
+{IFCCABLESEGMENT, "IfcCableSegment", "IFCCABLESEGMENT", true, {0, IFCFLOWSEGMENT, IFCFLOWSEGMENT}},
+{IFCWORKPLAN, "IfcWorkPlan", "IFCWORKPLAN", false, {IFCWORKCONTROL, IFCWORKCONTROL, IFCWORKCONTROL}},
+{IFCFAILURECONNECTIONCONDITION, "IfcFailureConnectionCondition", "IFCFAILURECONNECTIONCONDITION", false, {IFCSTRUCTURALCONNECTIONCONDITION, IFCSTRUCTURALCONNECTIONCONDITION, IFCSTRUCTURALCONNECTIONCONDITION}},
+{IFCFIRESUPPRESSIONTERMINALTYPE, "IfcFireSuppressionTerminalType", "IFCFIRESUPPRESSIONTERMINALTYPE", false, {IFCFLOWTERMINALTYPE, IFCFLOWTERMINALTYPE, IFCFLOWTERMINALTYPE}},
+{IFCFACILITYPARTCOMMON, "IfcFacilityPartCommon", "IFCFACILITYPARTCOMMON", true, {0, 0, IFCFACILITYPART}},
+{IFCGEOTECHNICALELEMENT, "IfcGeotechnicalElement", "IFCGEOTECHNICALELEMENT", true, {0, 0, IFCELEMENT}},
+{IFCPIPESEGMENTTYPE, "IfcPipeSegmentType", "IFCPIPESEGMENTTYPE", false, {IFCFLOWSEGMENTTYPE, IFCFLOWSEGMENTTYPE, IFCFLOWSEGMENTTYPE}},
+{IFCDIRECTRIXDERIVEDREFERENCESWEPTAREASOLID, "IfcDirectrixDerivedReferenceSweptAreaSolid", "IFCDIRECTRIXDERIVEDREFERENCESWEPTAREASOLID", false, {0, 0, IFCFIXEDREFERENCESWEPTAREASOLID}},
+{IFCWASTETERMINAL, "IfcWasteTerminal", "IFCWASTETERMINAL", true, {0, IFCFLOWTERMINAL, IFCFLOWTERMINAL}},
+{IFCFURNISHINGELEMENTTYPE, "IfcFurnishingElementType", "IFCFURNISHINGELEMENTTYPE", false, {IFCELEMENTTYPE, IFCELEMENTTYPE, IFCELEMENTTYPE}},
+{IFCSHAPEREPRESENTATION, "IfcShapeRepresentation", "IFCSHAPEREPRESENTATION", false, {IFCSHAPEMODEL, IFCSHAPEMODEL, IFCSHAPEMODEL}},
+{IFCSTRUCTURALCURVECONNECTION, "IfcStructuralCurveConnection", "IFCSTRUCTURALCURVECONNECTION", true, {IFCSTRUCTURALCONNECTION, IFCSTRUCTURALCONNECTION, IFCSTRUCTURALCONNECTION}},
+{IFCORGANIZATION, "IfcOrganization", "IFCORGANIZATION", false, {0, 0, 0}},
+{IFCSTAIRFLIGHT, "IfcStairFlight", "IFCSTAIRFLIGHT", true, {IFCBUILDINGELEMENT, IFCBUILDINGELEMENT, IFCBUILTELEMENT}},
+{IFCMECHANICALMATERIALPROPERTIES, "IfcMechanicalMaterialProperties", "IFCMECHANICALMATERIALPROPERTIES", false, {IFCMATERIALPROPERTIES, 0, 0}},
+{IFCCONNECTIONPORTGEOMETRY, "IfcConnectionPortGeometry", "IFCCONNECTIONPORTGEOMETRY", false, {IFCCONNECTIONGEOMETRY, 0, 0}},
+{IFCAXIS1PLACEMENT, "IfcAxis1Placement", "IFCAXIS1PLACEMENT", false, {IFCPLACEMENT, IFCPLACEMENT, IFCPLACEMENT}},
+{IFCALIGNMENTCANT, "IfcAlignmentCant", "IFCALIGNMENTCANT", true, {0, 0, IFCLINEARELEMENT}},
+{IFCLIGHTSOURCEGONIOMETRIC, "IfcLightSourceGoniometric", "IFCLIGHTSOURCEGONIOMETRIC", false, {IFCLIGHTSOURCE, IFCLIGHTSOURCE, IFCLIGHTSOURCE}},
+{IFCRELASSIGNSTOPROCESS, "IfcRelAssignsToProcess", "IFCRELASSIGNSTOPROCESS", false, {IFCRELASSIGNS, IFCRELASSIGNS, IFCRELASSIGNS}},
+{IFCFLOWFITTING, "IfcFlowFitting", "IFCFLOWFITTING", true, {IFCDISTRIBUTIONFLOWELEMENT, IFCDISTRIBUTIONFLOWELEMENT, IFCDISTRIBUTIONFLOWELEMENT}},
+{IFCTEXTLITERAL, "IfcTextLiteral", "IFCTEXTLITERAL", false, {IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM, IFCGEOMETRICREPRESENTATIONITEM}},
+{IFCACTUATOR, "IfcActuator", "IFCACTUATOR", true, {0, IFCDISTRIBUTIONCONTROLELEMENT, IFCDISTRIBUTIONCONTROLELEMENT}},
+{IFCJUNCTIONBOXTYPE, "IfcJunctionBoxType", "IFCJUNCTIONBOXTYPE", false, {IFCFLOWFITTINGTYPE, IFCFLOWFITTINGTYPE, IFCFLOWFITTINGTYPE}},
+{IFCUNITARYEQUIPMENT, "IfcUnitaryEquipment", "IFCUNITARYEQUIPMENT", true, {0, IFCENERGYCONVERSIONDEVICE, IFCENERGYCONVERSIONDEVICE}},
+{IFCEXTERNALINFORMATION, "IfcExternalInformation", "IFCEXTERNALINFORMATION", false, {0, 0, 0}},
+}};
+constexpr std::array<uint32_t, 235> IFC_ELEMENTS = {{
+IFCFACILITY,
+IFCELECTRICFLOWTREATMENTDEVICE,
+IFCCONTROLLER,
+IFCBOILER,
+IFCSIGN,
+IFCBUILDINGELEMENTCOMPONENT,
+IFCLAMP,
+IFCPUMP,
+IFCROAD,
+IFCAIRTERMINALBOX,
+IFCFLOWINSTRUMENT,
+IFCSTRUCTURALCURVEMEMBER,
+IFCMOORINGDEVICE,
+IFCFURNISHINGELEMENT,
+IFCELECTRICGENERATOR,
+IFCAUDIOVISUALAPPLIANCE,
+IFCPIPEFITTING,
+IFCALIGNMENTSEGMENT,
+IFCALIGNMENT,
+IFCSTAIR,
+IFCDUCTFITTING,
+IFCMECHANICALFASTENER,
+IFCDOOR,
+IFCELECTRICMOTOR,
+IFCSYSTEMFURNITUREELEMENT,
+IFCSPATIALZONE,
+IFCEVAPORATOR,
+IFCWINDOWSTANDARDCASE,
+IFCMARINEFACILITY,
+IFCSTRUCTURALMEMBER,
+IFCROADPART,
+IFCSTRUCTURALSURFACEREACTION,
+IFCLIGHTFIXTURE,
+IFCUNITARYCONTROLELEMENT,
+IFCCABLECARRIERFITTING,
+IFCCOIL,
+IFCBRIDGE,
+IFCFASTENER,
+IFCSTRUCTURALACTION,
+IFCFLOWSTORAGEDEVICE,
+IFCSTRUCTURALPOINTCONNECTION,
+IFCPROTECTIVEDEVICE,
+IFCBEAM,
+IFCTANK,
+IFCFILTER,
+IFCVEHICLE,
+IFCCOLUMN,
+IFCEDGEFEATURE,
+IFCELECTRICALELEMENT,
+IFCELECTRICDISTRIBUTIONBOARD,
+IFCFOOTING,
+IFCCOLUMNSTANDARDCASE,
+IFCVOIDINGFEATURE,
+IFCBRIDGEPART,
+IFCMARINEPART,
+IFCREINFORCINGBAR,
+IFCFLOWSEGMENT,
+IFCSIGNAL,
+IFCELECTRICTIMECONTROL,
+IFCSTRUCTURALCURVEACTION,
+IFCCABLEFITTING,
+IFCDISTRIBUTIONCHAMBERELEMENT,
+IFCDISTRIBUTIONCONTROLELEMENT,
+IFCMEMBER,
+IFCEARTHWORKSELEMENT,
+IFCBUILDINGELEMENTPROXY,
+IFCLINEARPOSITIONINGELEMENT,
+IFCPLATESTANDARDCASE,
+IFCSWITCHINGDEVICE,
+IFCSTRUCTURALCONNECTION,
+IFCEXTERNALSPATIALELEMENT,
+IFCSTRUCTURALPOINTREACTION,
+IFCFEATUREELEMENTSUBTRACTION,
+IFCFACILITYPART,
+IFCSHADINGDEVICE,
+IFCDISCRETEACCESSORY,
+IFCDUCTSILENCER,
+IFCROUNDEDEDGEFEATURE,
+IFCPAVEMENT,
+IFCSTACKTERMINAL,
+IFCSPATIALELEMENT,
+IFCFIRESUPPRESSIONTERMINAL,
+IFCMEDICALDEVICE,
+IFCCOURSE,
+IFCFURNITURE,
+IFCSLAB,
+IFCVIBRATIONDAMPER,
+IFCALIGNMENTHORIZONTAL,
+IFCGEOTECHNICALSTRATUM,
+IFCTRANSPORTELEMENT,
+IFCSTRUCTURALPLANARACTION,
+IFCELEMENTCOMPONENT,
+IFCAIRTERMINAL,
+IFCLIQUIDTERMINAL,
+IFCENERGYCONVERSIONDEVICE,
+IFCALIGNMENTVERTICAL,
+IFCANNOTATION,
+IFCCIVILELEMENT,
+IFCPILE,
+IFCSTRUCTURALLINEARACTIONVARYING,
+IFCELEMENT,
+IFCSTRUCTURALLINEARACTION,
+IFCBUILTELEMENT,
+IFCRAILWAYPART,
+IFCELECTRICAPPLIANCE,
+IFCMEMBERSTANDARDCASE,
+IFCDISTRIBUTIONELEMENT,
+IFCPOSITIONINGELEMENT,
+IFCTRANSPORTATIONDEVICE,
+IFCEQUIPMENTELEMENT,
+IFCGEOSLICE,
+IFCCOVERING,
+IFCSTRUCTURALSURFACECONNECTION,
+IFCSPACEHEATER,
+IFCROOF,
+IFCAIRTOAIRHEATRECOVERY,
+IFCFLOWCONTROLLER,
+IFCHUMIDIFIER,
+IFCMOBILETELECOMMUNICATIONSAPPLIANCE,
+IFCSTRUCTURALPOINTACTION,
+IFCFEATUREELEMENTADDITION,
+IFCJUNCTIONBOX,
+IFCLINEARELEMENT,
+IFCNAVIGATIONELEMENT,
+IFCFLOWMETER,
+IFCSTRUCTURALSURFACEMEMBERVARYING,
+IFCFLOWTERMINAL,
+IFCRAILING,
+IFCCONDENSER,
+IFCPROTECTIVEDEVICETRIPPINGUNIT,
+IFCREINFORCINGMESH,
+IFCTENDONANCHOR,
+IFCVIBRATIONISOLATOR,
+IFCWALL,
+IFCSTRUCTURALCURVEMEMBERVARYING,
+IFCCHAMFEREDGEFEATURE,
+IFCMOTORCONNECTION,
+IFCIMPACTPROTECTIONDEVICE,
+IFCGEOMODEL,
+IFCKERB,
+IFCSPATIALSTRUCTUREELEMENT,
+IFCGEOTECHNICALASSEMBLY,
+IFCSTRUCTURALCURVEREACTION,
+IFCVIRTUALELEMENT,
+IFCENGINE,
+IFCFEATUREELEMENT,
+IFCEXTERNALSPATIALSTRUCTUREELEMENT,
+IFCBEAMSTANDARDCASE,
+IFCBURNER,
+IFCBUILDINGELEMENTPART,
+IFCGRID,
+IFCRAMP,
+IFCTUBEBUNDLE,
+IFCREINFORCINGELEMENT,
+IFCSLABSTANDARDCASE,
+IFCDISTRIBUTIONFLOWELEMENT,
+IFCDISTRIBUTIONPORT,
+IFCSANITARYTERMINAL,
+IFCEARTHWORKSCUT,
+IFCOPENINGSTANDARDCASE,
+IFCALARM,
+IFCSURFACEFEATURE,
+IFCBUILDINGSTOREY,
+IFCSLABELEMENTEDCASE,
+IFCFLOWMOVINGDEVICE,
+IFCSTRUCTURALITEM,
+IFCPLATE,
+IFCPROXY,
+IFCCOMMUNICATIONSAPPLIANCE,
+IFCDOORSTANDARDCASE,
+IFCRAMPFLIGHT,
+IFCRAIL,
+IFCCHIMNEY,
+IFCBUILDINGELEMENT,
+IFCWINDOW,
+IFCELECTRICFLOWSTORAGEDEVICE,
+IFCBOREHOLE,
+IFCHEATEXCHANGER,
+IFCEARTHWORKSFILL,
+IFCFAN,
+IFCSOLARDEVICE,
+IFCTRACKELEMENT,
+IFCDEEPFOUNDATION,
+IFCCONVEYORSEGMENT,
+IFCGEOGRAPHICELEMENT,
+IFCCURTAINWALL,
+IFCFLOWTREATMENTDEVICE,
+IFCWALLSTANDARDCASE,
+IFCDUCTSEGMENT,
+IFCSTRUCTURALACTIVITY,
+IFCCOMPRESSOR,
+IFCOPENINGELEMENT,
+IFCPIPESEGMENT,
+IFCCOOLINGTOWER,
+IFCPROJECTIONELEMENT,
+IFCSTRUCTURALSURFACEACTION,
+IFCTENDONCONDUIT,
+IFCSTRUCTURALREACTION,
+IFCDISTRIBUTIONBOARD,
+IFCOUTLET,
+IFCELECTRICDISTRIBUTIONPOINT,
+IFCPORT,
+IFCEVAPORATIVECOOLER,
+IFCCABLECARRIERSEGMENT,
+IFCREINFORCEDSOIL,
+IFCTENDON,
+IFCTRANSFORMER,
+IFCSPACE,
+IFCCHILLER,
+IFCSTRUCTURALSURFACEMEMBER,
+IFCSTRUCTURALPLANARACTIONVARYING,
+IFCRAILWAY,
+IFCCAISSONFOUNDATION,
+IFCREFERENT,
+IFCBUILDING,
+IFCDAMPER,
+IFCSENSOR,
+IFCSITE,
+IFCELEMENTASSEMBLY,
+IFCCOOLEDBEAM,
+IFCWALLELEMENTEDCASE,
+IFCINTERCEPTOR,
+IFCBEARING,
+IFCVALVE,
+IFCPRODUCT,
+IFCCABLESEGMENT,
+IFCFACILITYPARTCOMMON,
+IFCGEOTECHNICALELEMENT,
+IFCWASTETERMINAL,
+IFCSTRUCTURALCURVECONNECTION,
+IFCSTAIRFLIGHT,
+IFCALIGNMENTCANT,
+IFCFLOWFITTING,
+IFCACTUATOR,
+IFCUNITARYEQUIPMENT,
+}};
+constexpr std::array<IFC_SCHEMA, 3> SCHEMAS = {{IFC2X3, IFC4, IFC4X3}};
+constexpr std::array<std::string_view, 3> SCHEMA_NAMES = {{"IFC2X3", "IFC4", "IFC4X3"}};
+// open addressed by the low bits of the type code (already a crc32), slots hold ordinal + 1
+constexpr uint32_t SLOT_BITS = 11;
+constexpr uint32_t SLOT_MASK = (1 << SLOT_BITS) - 1;
+static_assert(SCHEMA_TYPE_COUNT * 3 < (1 << SLOT_BITS) * 2, "type slots are too full, raise SLOT_BITS");
+constexpr std::array<uint16_t, 1 << SLOT_BITS> makeTypeSlots() {
+std::array<uint16_t, 1 << SLOT_BITS> slots = {};
+for (uint32_t i = 0; i < SCHEMA_TYPE_COUNT; i++) {
+uint32_t slot = SCHEMA_TYPES[i].typeCode & SLOT_MASK;
+while (slots[slot] != 0) slot = (slot + 1) & SLOT_MASK;
+slots[slot] = i + 1;
 }
-std::string IfcSchemaManager::IfcTypeCodeToType(uint32_t typeCode) const {
-switch(typeCode) {
-case schema::FILE_SCHEMA: return "FILE_SCHEMA";
-case schema::FILE_NAME: return "FILE_NAME";
-case schema::FILE_DESCRIPTION: return "FILE_DESCRIPTION";
-case schema::IFCACTORROLE: return "IfcActorRole";
-case schema::IFCADDRESS: return "IfcAddress";
-case schema::IFCAPPLICATION: return "IfcApplication";
-case schema::IFCAPPLIEDVALUE: return "IfcAppliedValue";
-case schema::IFCAPPLIEDVALUERELATIONSHIP: return "IfcAppliedValueRelationship";
-case schema::IFCAPPROVAL: return "IfcApproval";
-case schema::IFCAPPROVALACTORRELATIONSHIP: return "IfcApprovalActorRelationship";
-case schema::IFCAPPROVALPROPERTYRELATIONSHIP: return "IfcApprovalPropertyRelationship";
-case schema::IFCAPPROVALRELATIONSHIP: return "IfcApprovalRelationship";
-case schema::IFCBOUNDARYCONDITION: return "IfcBoundaryCondition";
-case schema::IFCBOUNDARYEDGECONDITION: return "IfcBoundaryEdgeCondition";
-case schema::IFCBOUNDARYFACECONDITION: return "IfcBoundaryFaceCondition";
-case schema::IFCBOUNDARYNODECONDITION: return "IfcBoundaryNodeCondition";
-case schema::IFCBOUNDARYNODECONDITIONWARPING: return "IfcBoundaryNodeConditionWarping";
-case schema::IFCCALENDARDATE: return "IfcCalendarDate";
-case schema::IFCCLASSIFICATION: return "IfcClassification";
-case schema::IFCCLASSIFICATIONITEM: return "IfcClassificationItem";
-case schema::IFCCLASSIFICATIONITEMRELATIONSHIP: return "IfcClassificationItemRelationship";
-case schema::IFCCLASSIFICATIONNOTATION: return "IfcClassificationNotation";
-case schema::IFCCLASSIFICATIONNOTATIONFACET: return "IfcClassificationNotationFacet";
-case schema::IFCCOLOURSPECIFICATION: return "IfcColourSpecification";
-case schema::IFCCONNECTIONGEOMETRY: return "IfcConnectionGeometry";
-case schema::IFCCONNECTIONPOINTGEOMETRY: return "IfcConnectionPointGeometry";
-case schema::IFCCONNECTIONPORTGEOMETRY: return "IfcConnectionPortGeometry";
-case schema::IFCCONNECTIONSURFACEGEOMETRY: return "IfcConnectionSurfaceGeometry";
-case schema::IFCCONSTRAINT: return "IfcConstraint";
-case schema::IFCCONSTRAINTAGGREGATIONRELATIONSHIP: return "IfcConstraintAggregationRelationship";
-case schema::IFCCONSTRAINTCLASSIFICATIONRELATIONSHIP: return "IfcConstraintClassificationRelationship";
-case schema::IFCCONSTRAINTRELATIONSHIP: return "IfcConstraintRelationship";
-case schema::IFCCOORDINATEDUNIVERSALTIMEOFFSET: return "IfcCoordinatedUniversalTimeOffset";
-case schema::IFCCOSTVALUE: return "IfcCostValue";
-case schema::IFCCURRENCYRELATIONSHIP: return "IfcCurrencyRelationship";
-case schema::IFCCURVESTYLEFONT: return "IfcCurveStyleFont";
-case schema::IFCCURVESTYLEFONTANDSCALING: return "IfcCurveStyleFontAndScaling";
-case schema::IFCCURVESTYLEFONTPATTERN: return "IfcCurveStyleFontPattern";
-case schema::IFCDATEANDTIME: return "IfcDateAndTime";
-case schema::IFCDERIVEDUNIT: return "IfcDerivedUnit";
-case schema::IFCDERIVEDUNITELEMENT: return "IfcDerivedUnitElement";
-case schema::IFCDIMENSIONALEXPONENTS: return "IfcDimensionalExponents";
-case schema::IFCDOCUMENTELECTRONICFORMAT: return "IfcDocumentElectronicFormat";
-case schema::IFCDOCUMENTINFORMATION: return "IfcDocumentInformation";
-case schema::IFCDOCUMENTINFORMATIONRELATIONSHIP: return "IfcDocumentInformationRelationship";
-case schema::IFCDRAUGHTINGCALLOUTRELATIONSHIP: return "IfcDraughtingCalloutRelationship";
-case schema::IFCENVIRONMENTALIMPACTVALUE: return "IfcEnvironmentalImpactValue";
-case schema::IFCEXTERNALREFERENCE: return "IfcExternalReference";
-case schema::IFCEXTERNALLYDEFINEDHATCHSTYLE: return "IfcExternallyDefinedHatchStyle";
-case schema::IFCEXTERNALLYDEFINEDSURFACESTYLE: return "IfcExternallyDefinedSurfaceStyle";
-case schema::IFCEXTERNALLYDEFINEDSYMBOL: return "IfcExternallyDefinedSymbol";
-case schema::IFCEXTERNALLYDEFINEDTEXTFONT: return "IfcExternallyDefinedTextFont";
-case schema::IFCGRIDAXIS: return "IfcGridAxis";
-case schema::IFCIRREGULARTIMESERIESVALUE: return "IfcIrregularTimeSeriesValue";
-case schema::IFCLIBRARYINFORMATION: return "IfcLibraryInformation";
-case schema::IFCLIBRARYREFERENCE: return "IfcLibraryReference";
-case schema::IFCLIGHTDISTRIBUTIONDATA: return "IfcLightDistributionData";
-case schema::IFCLIGHTINTENSITYDISTRIBUTION: return "IfcLightIntensityDistribution";
-case schema::IFCLOCALTIME: return "IfcLocalTime";
-case schema::IFCMATERIAL: return "IfcMaterial";
-case schema::IFCMATERIALCLASSIFICATIONRELATIONSHIP: return "IfcMaterialClassificationRelationship";
-case schema::IFCMATERIALLAYER: return "IfcMaterialLayer";
-case schema::IFCMATERIALLAYERSET: return "IfcMaterialLayerSet";
-case schema::IFCMATERIALLAYERSETUSAGE: return "IfcMaterialLayerSetUsage";
-case schema::IFCMATERIALLIST: return "IfcMaterialList";
-case schema::IFCMATERIALPROPERTIES: return "IfcMaterialProperties";
-case schema::IFCMEASUREWITHUNIT: return "IfcMeasureWithUnit";
-case schema::IFCMECHANICALMATERIALPROPERTIES: return "IfcMechanicalMaterialProperties";
-case schema::IFCMECHANICALSTEELMATERIALPROPERTIES: return "IfcMechanicalSteelMaterialProperties";
-case schema::IFCMETRIC: return "IfcMetric";
-case schema::IFCMONETARYUNIT: return "IfcMonetaryUnit";
-case schema::IFCNAMEDUNIT: return "IfcNamedUnit";
-case schema::IFCOBJECTPLACEMENT: return "IfcObjectPlacement";
-case schema::IFCOBJECTIVE: return "IfcObjective";
-case schema::IFCOPTICALMATERIALPROPERTIES: return "IfcOpticalMaterialProperties";
-case schema::IFCORGANIZATION: return "IfcOrganization";
-case schema::IFCORGANIZATIONRELATIONSHIP: return "IfcOrganizationRelationship";
-case schema::IFCOWNERHISTORY: return "IfcOwnerHistory";
-case schema::IFCPERSON: return "IfcPerson";
-case schema::IFCPERSONANDORGANIZATION: return "IfcPersonAndOrganization";
-case schema::IFCPHYSICALQUANTITY: return "IfcPhysicalQuantity";
-case schema::IFCPHYSICALSIMPLEQUANTITY: return "IfcPhysicalSimpleQuantity";
-case schema::IFCPOSTALADDRESS: return "IfcPostalAddress";
-case schema::IFCPREDEFINEDITEM: return "IfcPreDefinedItem";
-case schema::IFCPREDEFINEDSYMBOL: return "IfcPreDefinedSymbol";
-case schema::IFCPREDEFINEDTERMINATORSYMBOL: return "IfcPreDefinedTerminatorSymbol";
-case schema::IFCPREDEFINEDTEXTFONT: return "IfcPreDefinedTextFont";
-case schema::IFCPRESENTATIONLAYERASSIGNMENT: return "IfcPresentationLayerAssignment";
-case schema::IFCPRESENTATIONLAYERWITHSTYLE: return "IfcPresentationLayerWithStyle";
-case schema::IFCPRESENTATIONSTYLE: return "IfcPresentationStyle";
-case schema::IFCPRESENTATIONSTYLEASSIGNMENT: return "IfcPresentationStyleAssignment";
-case schema::IFCPRODUCTREPRESENTATION: return "IfcProductRepresentation";
-case schema::IFCPRODUCTSOFCOMBUSTIONPROPERTIES: return "IfcProductsOfCombustionProperties";
-case schema::IFCPROFILEDEF: return "IfcProfileDef";
-case schema::IFCPROFILEPROPERTIES: return "IfcProfileProperties";
-case schema::IFCPROPERTY: return "IfcProperty";
-case schema::IFCPROPERTYCONSTRAINTRELATIONSHIP: return "IfcPropertyConstraintRelationship";
-case schema::IFCPROPERTYDEPENDENCYRELATIONSHIP: return "IfcPropertyDependencyRelationship";
-case schema::IFCPROPERTYENUMERATION: return "IfcPropertyEnumeration";
-case schema::IFCQUANTITYAREA: return "IfcQuantityArea";
-case schema::IFCQUANTITYCOUNT: return "IfcQuantityCount";
-case schema::IFCQUANTITYLENGTH: return "IfcQuantityLength";
-case schema::IFCQUANTITYTIME: return "IfcQuantityTime";
-case schema::IFCQUANTITYVOLUME: return "IfcQuantityVolume";
-case schema::IFCQUANTITYWEIGHT: return "IfcQuantityWeight";
-case schema::IFCREFERENCESVALUEDOCUMENT: return "IfcReferencesValueDocument";
-case schema::IFCREINFORCEMENTBARPROPERTIES: return "IfcReinforcementBarProperties";
-case schema::IFCRELAXATION: return "IfcRelaxation";
-case schema::IFCREPRESENTATION: return "IfcRepresentation";
-case schema::IFCREPRESENTATIONCONTEXT: return "IfcRepresentationContext";
-case schema::IFCREPRESENTATIONITEM: return "IfcRepresentationItem";
-case schema::IFCREPRESENTATIONMAP: return "IfcRepresentationMap";
-case schema::IFCRIBPLATEPROFILEPROPERTIES: return "IfcRibPlateProfileProperties";
-case schema::IFCROOT: return "IfcRoot";
-case schema::IFCSIUNIT: return "IfcSIUnit";
-case schema::IFCSECTIONPROPERTIES: return "IfcSectionProperties";
-case schema::IFCSECTIONREINFORCEMENTPROPERTIES: return "IfcSectionReinforcementProperties";
-case schema::IFCSHAPEASPECT: return "IfcShapeAspect";
-case schema::IFCSHAPEMODEL: return "IfcShapeModel";
-case schema::IFCSHAPEREPRESENTATION: return "IfcShapeRepresentation";
-case schema::IFCSIMPLEPROPERTY: return "IfcSimpleProperty";
-case schema::IFCSTRUCTURALCONNECTIONCONDITION: return "IfcStructuralConnectionCondition";
-case schema::IFCSTRUCTURALLOAD: return "IfcStructuralLoad";
-case schema::IFCSTRUCTURALLOADSTATIC: return "IfcStructuralLoadStatic";
-case schema::IFCSTRUCTURALLOADTEMPERATURE: return "IfcStructuralLoadTemperature";
-case schema::IFCSTYLEMODEL: return "IfcStyleModel";
-case schema::IFCSTYLEDITEM: return "IfcStyledItem";
-case schema::IFCSTYLEDREPRESENTATION: return "IfcStyledRepresentation";
-case schema::IFCSURFACESTYLE: return "IfcSurfaceStyle";
-case schema::IFCSURFACESTYLELIGHTING: return "IfcSurfaceStyleLighting";
-case schema::IFCSURFACESTYLEREFRACTION: return "IfcSurfaceStyleRefraction";
-case schema::IFCSURFACESTYLESHADING: return "IfcSurfaceStyleShading";
-case schema::IFCSURFACESTYLEWITHTEXTURES: return "IfcSurfaceStyleWithTextures";
-case schema::IFCSURFACETEXTURE: return "IfcSurfaceTexture";
-case schema::IFCSYMBOLSTYLE: return "IfcSymbolStyle";
-case schema::IFCTABLE: return "IfcTable";
-case schema::IFCTABLEROW: return "IfcTableRow";
-case schema::IFCTELECOMADDRESS: return "IfcTelecomAddress";
-case schema::IFCTEXTSTYLE: return "IfcTextStyle";
-case schema::IFCTEXTSTYLEFONTMODEL: return "IfcTextStyleFontModel";
-case schema::IFCTEXTSTYLEFORDEFINEDFONT: return "IfcTextStyleForDefinedFont";
-case schema::IFCTEXTSTYLETEXTMODEL: return "IfcTextStyleTextModel";
-case schema::IFCTEXTSTYLEWITHBOXCHARACTERISTICS: return "IfcTextStyleWithBoxCharacteristics";
-case schema::IFCTEXTURECOORDINATE: return "IfcTextureCoordinate";
-case schema::IFCTEXTURECOORDINATEGENERATOR: return "IfcTextureCoordinateGenerator";
-case schema::IFCTEXTUREMAP: return "IfcTextureMap";
-case schema::IFCTEXTUREVERTEX: return "IfcTextureVertex";
-case schema::IFCTHERMALMATERIALPROPERTIES: return "IfcThermalMaterialProperties";
-case schema::IFCTIMESERIES: return "IfcTimeSeries";
-case schema::IFCTIMESERIESREFERENCERELATIONSHIP: return "IfcTimeSeriesReferenceRelationship";
-case schema::IFCTIMESERIESVALUE: return "IfcTimeSeriesValue";
-case schema::IFCTOPOLOGICALREPRESENTATIONITEM: return "IfcTopologicalRepresentationItem";
-case schema::IFCTOPOLOGYREPRESENTATION: return "IfcTopologyRepresentation";
-case schema::IFCUNITASSIGNMENT: return "IfcUnitAssignment";
-case schema::IFCVERTEX: return "IfcVertex";
-case schema::IFCVERTEXBASEDTEXTUREMAP: return "IfcVertexBasedTextureMap";
-case schema::IFCVERTEXPOINT: return "IfcVertexPoint";
-case schema::IFCVIRTUALGRIDINTERSECTION: return "IfcVirtualGridIntersection";
-case schema::IFCWATERPROPERTIES: return "IfcWaterProperties";
-case schema::IFCANNOTATIONOCCURRENCE: return "IfcAnnotationOccurrence";
-case schema::IFCANNOTATIONSURFACEOCCURRENCE: return "IfcAnnotationSurfaceOccurrence";
-case schema::IFCANNOTATIONSYMBOLOCCURRENCE: return "IfcAnnotationSymbolOccurrence";
-case schema::IFCANNOTATIONTEXTOCCURRENCE: return "IfcAnnotationTextOccurrence";
-case schema::IFCARBITRARYCLOSEDPROFILEDEF: return "IfcArbitraryClosedProfileDef";
-case schema::IFCARBITRARYOPENPROFILEDEF: return "IfcArbitraryOpenProfileDef";
-case schema::IFCARBITRARYPROFILEDEFWITHVOIDS: return "IfcArbitraryProfileDefWithVoids";
-case schema::IFCBLOBTEXTURE: return "IfcBlobTexture";
-case schema::IFCCENTERLINEPROFILEDEF: return "IfcCenterLineProfileDef";
-case schema::IFCCLASSIFICATIONREFERENCE: return "IfcClassificationReference";
-case schema::IFCCOLOURRGB: return "IfcColourRgb";
-case schema::IFCCOMPLEXPROPERTY: return "IfcComplexProperty";
-case schema::IFCCOMPOSITEPROFILEDEF: return "IfcCompositeProfileDef";
-case schema::IFCCONNECTEDFACESET: return "IfcConnectedFaceSet";
-case schema::IFCCONNECTIONCURVEGEOMETRY: return "IfcConnectionCurveGeometry";
-case schema::IFCCONNECTIONPOINTECCENTRICITY: return "IfcConnectionPointEccentricity";
-case schema::IFCCONTEXTDEPENDENTUNIT: return "IfcContextDependentUnit";
-case schema::IFCCONVERSIONBASEDUNIT: return "IfcConversionBasedUnit";
-case schema::IFCCURVESTYLE: return "IfcCurveStyle";
-case schema::IFCDERIVEDPROFILEDEF: return "IfcDerivedProfileDef";
-case schema::IFCDIMENSIONCALLOUTRELATIONSHIP: return "IfcDimensionCalloutRelationship";
-case schema::IFCDIMENSIONPAIR: return "IfcDimensionPair";
-case schema::IFCDOCUMENTREFERENCE: return "IfcDocumentReference";
-case schema::IFCDRAUGHTINGPREDEFINEDTEXTFONT: return "IfcDraughtingPreDefinedTextFont";
-case schema::IFCEDGE: return "IfcEdge";
-case schema::IFCEDGECURVE: return "IfcEdgeCurve";
-case schema::IFCEXTENDEDMATERIALPROPERTIES: return "IfcExtendedMaterialProperties";
-case schema::IFCFACE: return "IfcFace";
-case schema::IFCFACEBOUND: return "IfcFaceBound";
-case schema::IFCFACEOUTERBOUND: return "IfcFaceOuterBound";
-case schema::IFCFACESURFACE: return "IfcFaceSurface";
-case schema::IFCFAILURECONNECTIONCONDITION: return "IfcFailureConnectionCondition";
-case schema::IFCFILLAREASTYLE: return "IfcFillAreaStyle";
-case schema::IFCFUELPROPERTIES: return "IfcFuelProperties";
-case schema::IFCGENERALMATERIALPROPERTIES: return "IfcGeneralMaterialProperties";
-case schema::IFCGENERALPROFILEPROPERTIES: return "IfcGeneralProfileProperties";
-case schema::IFCGEOMETRICREPRESENTATIONCONTEXT: return "IfcGeometricRepresentationContext";
-case schema::IFCGEOMETRICREPRESENTATIONITEM: return "IfcGeometricRepresentationItem";
-case schema::IFCGEOMETRICREPRESENTATIONSUBCONTEXT: return "IfcGeometricRepresentationSubContext";
-case schema::IFCGEOMETRICSET: return "IfcGeometricSet";
-case schema::IFCGRIDPLACEMENT: return "IfcGridPlacement";
-case schema::IFCHALFSPACESOLID: return "IfcHalfSpaceSolid";
-case schema::IFCHYGROSCOPICMATERIALPROPERTIES: return "IfcHygroscopicMaterialProperties";
-case schema::IFCIMAGETEXTURE: return "IfcImageTexture";
-case schema::IFCIRREGULARTIMESERIES: return "IfcIrregularTimeSeries";
-case schema::IFCLIGHTSOURCE: return "IfcLightSource";
-case schema::IFCLIGHTSOURCEAMBIENT: return "IfcLightSourceAmbient";
-case schema::IFCLIGHTSOURCEDIRECTIONAL: return "IfcLightSourceDirectional";
-case schema::IFCLIGHTSOURCEGONIOMETRIC: return "IfcLightSourceGoniometric";
-case schema::IFCLIGHTSOURCEPOSITIONAL: return "IfcLightSourcePositional";
-case schema::IFCLIGHTSOURCESPOT: return "IfcLightSourceSpot";
-case schema::IFCLOCALPLACEMENT: return "IfcLocalPlacement";
-case schema::IFCLOOP: return "IfcLoop";
-case schema::IFCMAPPEDITEM: return "IfcMappedItem";
-case schema::IFCMATERIALDEFINITIONREPRESENTATION: return "IfcMaterialDefinitionRepresentation";
-case schema::IFCMECHANICALCONCRETEMATERIALPROPERTIES: return "IfcMechanicalConcreteMaterialProperties";
-case schema::IFCOBJECTDEFINITION: return "IfcObjectDefinition";
-case schema::IFCONEDIRECTIONREPEATFACTOR: return "IfcOneDirectionRepeatFactor";
-case schema::IFCOPENSHELL: return "IfcOpenShell";
-case schema::IFCORIENTEDEDGE: return "IfcOrientedEdge";
-case schema::IFCPARAMETERIZEDPROFILEDEF: return "IfcParameterizedProfileDef";
-case schema::IFCPATH: return "IfcPath";
-case schema::IFCPHYSICALCOMPLEXQUANTITY: return "IfcPhysicalComplexQuantity";
-case schema::IFCPIXELTEXTURE: return "IfcPixelTexture";
-case schema::IFCPLACEMENT: return "IfcPlacement";
-case schema::IFCPLANAREXTENT: return "IfcPlanarExtent";
-case schema::IFCPOINT: return "IfcPoint";
-case schema::IFCPOINTONCURVE: return "IfcPointOnCurve";
-case schema::IFCPOINTONSURFACE: return "IfcPointOnSurface";
-case schema::IFCPOLYLOOP: return "IfcPolyLoop";
-case schema::IFCPOLYGONALBOUNDEDHALFSPACE: return "IfcPolygonalBoundedHalfSpace";
-case schema::IFCPREDEFINEDCOLOUR: return "IfcPreDefinedColour";
-case schema::IFCPREDEFINEDCURVEFONT: return "IfcPreDefinedCurveFont";
-case schema::IFCPREDEFINEDDIMENSIONSYMBOL: return "IfcPreDefinedDimensionSymbol";
-case schema::IFCPREDEFINEDPOINTMARKERSYMBOL: return "IfcPreDefinedPointMarkerSymbol";
-case schema::IFCPRODUCTDEFINITIONSHAPE: return "IfcProductDefinitionShape";
-case schema::IFCPROPERTYBOUNDEDVALUE: return "IfcPropertyBoundedValue";
-case schema::IFCPROPERTYDEFINITION: return "IfcPropertyDefinition";
-case schema::IFCPROPERTYENUMERATEDVALUE: return "IfcPropertyEnumeratedValue";
-case schema::IFCPROPERTYLISTVALUE: return "IfcPropertyListValue";
-case schema::IFCPROPERTYREFERENCEVALUE: return "IfcPropertyReferenceValue";
-case schema::IFCPROPERTYSETDEFINITION: return "IfcPropertySetDefinition";
-case schema::IFCPROPERTYSINGLEVALUE: return "IfcPropertySingleValue";
-case schema::IFCPROPERTYTABLEVALUE: return "IfcPropertyTableValue";
-case schema::IFCRECTANGLEPROFILEDEF: return "IfcRectangleProfileDef";
-case schema::IFCREGULARTIMESERIES: return "IfcRegularTimeSeries";
-case schema::IFCREINFORCEMENTDEFINITIONPROPERTIES: return "IfcReinforcementDefinitionProperties";
-case schema::IFCRELATIONSHIP: return "IfcRelationship";
-case schema::IFCROUNDEDRECTANGLEPROFILEDEF: return "IfcRoundedRectangleProfileDef";
-case schema::IFCSECTIONEDSPINE: return "IfcSectionedSpine";
-case schema::IFCSERVICELIFEFACTOR: return "IfcServiceLifeFactor";
-case schema::IFCSHELLBASEDSURFACEMODEL: return "IfcShellBasedSurfaceModel";
-case schema::IFCSLIPPAGECONNECTIONCONDITION: return "IfcSlippageConnectionCondition";
-case schema::IFCSOLIDMODEL: return "IfcSolidModel";
-case schema::IFCSOUNDPROPERTIES: return "IfcSoundProperties";
-case schema::IFCSOUNDVALUE: return "IfcSoundValue";
-case schema::IFCSPACETHERMALLOADPROPERTIES: return "IfcSpaceThermalLoadProperties";
-case schema::IFCSTRUCTURALLOADLINEARFORCE: return "IfcStructuralLoadLinearForce";
-case schema::IFCSTRUCTURALLOADPLANARFORCE: return "IfcStructuralLoadPlanarForce";
-case schema::IFCSTRUCTURALLOADSINGLEDISPLACEMENT: return "IfcStructuralLoadSingleDisplacement";
-case schema::IFCSTRUCTURALLOADSINGLEDISPLACEMENTDISTORTION: return "IfcStructuralLoadSingleDisplacementDistortion";
-case schema::IFCSTRUCTURALLOADSINGLEFORCE: return "IfcStructuralLoadSingleForce";
-case schema::IFCSTRUCTURALLOADSINGLEFORCEWARPING: return "IfcStructuralLoadSingleForceWarping";
-case schema::IFCSTRUCTURALPROFILEPROPERTIES: return "IfcStructuralProfileProperties";
-case schema::IFCSTRUCTURALSTEELPROFILEPROPERTIES: return "IfcStructuralSteelProfileProperties";
-case schema::IFCSUBEDGE: return "IfcSubedge";
-case schema::IFCSURFACE: return "IfcSurface";
-case schema::IFCSURFACESTYLERENDERING: return "IfcSurfaceStyleRendering";
-case schema::IFCSWEPTAREASOLID: return "IfcSweptAreaSolid";
-case schema::IFCSWEPTDISKSOLID: return "IfcSweptDiskSolid";
-case schema::IFCSWEPTSURFACE: return "IfcSweptSurface";
-case schema::IFCTSHAPEPROFILEDEF: return "IfcTShapeProfileDef";
-case schema::IFCTERMINATORSYMBOL: return "IfcTerminatorSymbol";
-case schema::IFCTEXTLITERAL: return "IfcTextLiteral";
-case schema::IFCTEXTLITERALWITHEXTENT: return "IfcTextLiteralWithExtent";
-case schema::IFCTRAPEZIUMPROFILEDEF: return "IfcTrapeziumProfileDef";
-case schema::IFCTWODIRECTIONREPEATFACTOR: return "IfcTwoDirectionRepeatFactor";
-case schema::IFCTYPEOBJECT: return "IfcTypeObject";
-case schema::IFCTYPEPRODUCT: return "IfcTypeProduct";
-case schema::IFCUSHAPEPROFILEDEF: return "IfcUShapeProfileDef";
-case schema::IFCVECTOR: return "IfcVector";
-case schema::IFCVERTEXLOOP: return "IfcVertexLoop";
-case schema::IFCWINDOWLININGPROPERTIES: return "IfcWindowLiningProperties";
-case schema::IFCWINDOWPANELPROPERTIES: return "IfcWindowPanelProperties";
-case schema::IFCWINDOWSTYLE: return "IfcWindowStyle";
-case schema::IFCZSHAPEPROFILEDEF: return "IfcZShapeProfileDef";
-case schema::IFCANNOTATIONCURVEOCCURRENCE: return "IfcAnnotationCurveOccurrence";
-case schema::IFCANNOTATIONFILLAREA: return "IfcAnnotationFillArea";
-case schema::IFCANNOTATIONFILLAREAOCCURRENCE: return "IfcAnnotationFillAreaOccurrence";
-case schema::IFCANNOTATIONSURFACE: return "IfcAnnotationSurface";
-case schema::IFCAXIS1PLACEMENT: return "IfcAxis1Placement";
-case schema::IFCAXIS2PLACEMENT2D: return "IfcAxis2Placement2D";
-case schema::IFCAXIS2PLACEMENT3D: return "IfcAxis2Placement3D";
-case schema::IFCBOOLEANRESULT: return "IfcBooleanResult";
-case schema::IFCBOUNDEDSURFACE: return "IfcBoundedSurface";
-case schema::IFCBOUNDINGBOX: return "IfcBoundingBox";
-case schema::IFCBOXEDHALFSPACE: return "IfcBoxedHalfSpace";
-case schema::IFCCSHAPEPROFILEDEF: return "IfcCShapeProfileDef";
-case schema::IFCCARTESIANPOINT: return "IfcCartesianPoint";
-case schema::IFCCARTESIANTRANSFORMATIONOPERATOR: return "IfcCartesianTransformationOperator";
-case schema::IFCCARTESIANTRANSFORMATIONOPERATOR2D: return "IfcCartesianTransformationOperator2D";
-case schema::IFCCARTESIANTRANSFORMATIONOPERATOR2DNONUNIFORM: return "IfcCartesianTransformationOperator2DnonUniform";
-case schema::IFCCARTESIANTRANSFORMATIONOPERATOR3D: return "IfcCartesianTransformationOperator3D";
-case schema::IFCCARTESIANTRANSFORMATIONOPERATOR3DNONUNIFORM: return "IfcCartesianTransformationOperator3DnonUniform";
-case schema::IFCCIRCLEPROFILEDEF: return "IfcCircleProfileDef";
-case schema::IFCCLOSEDSHELL: return "IfcClosedShell";
-case schema::IFCCOMPOSITECURVESEGMENT: return "IfcCompositeCurveSegment";
-case schema::IFCCRANERAILASHAPEPROFILEDEF: return "IfcCraneRailAShapeProfileDef";
-case schema::IFCCRANERAILFSHAPEPROFILEDEF: return "IfcCraneRailFShapeProfileDef";
-case schema::IFCCSGPRIMITIVE3D: return "IfcCsgPrimitive3D";
-case schema::IFCCSGSOLID: return "IfcCsgSolid";
-case schema::IFCCURVE: return "IfcCurve";
-case schema::IFCCURVEBOUNDEDPLANE: return "IfcCurveBoundedPlane";
-case schema::IFCDEFINEDSYMBOL: return "IfcDefinedSymbol";
-case schema::IFCDIMENSIONCURVE: return "IfcDimensionCurve";
-case schema::IFCDIMENSIONCURVETERMINATOR: return "IfcDimensionCurveTerminator";
-case schema::IFCDIRECTION: return "IfcDirection";
-case schema::IFCDOORLININGPROPERTIES: return "IfcDoorLiningProperties";
-case schema::IFCDOORPANELPROPERTIES: return "IfcDoorPanelProperties";
-case schema::IFCDOORSTYLE: return "IfcDoorStyle";
-case schema::IFCDRAUGHTINGCALLOUT: return "IfcDraughtingCallout";
-case schema::IFCDRAUGHTINGPREDEFINEDCOLOUR: return "IfcDraughtingPreDefinedColour";
-case schema::IFCDRAUGHTINGPREDEFINEDCURVEFONT: return "IfcDraughtingPreDefinedCurveFont";
-case schema::IFCEDGELOOP: return "IfcEdgeLoop";
-case schema::IFCELEMENTQUANTITY: return "IfcElementQuantity";
-case schema::IFCELEMENTTYPE: return "IfcElementType";
-case schema::IFCELEMENTARYSURFACE: return "IfcElementarySurface";
-case schema::IFCELLIPSEPROFILEDEF: return "IfcEllipseProfileDef";
-case schema::IFCENERGYPROPERTIES: return "IfcEnergyProperties";
-case schema::IFCEXTRUDEDAREASOLID: return "IfcExtrudedAreaSolid";
-case schema::IFCFACEBASEDSURFACEMODEL: return "IfcFaceBasedSurfaceModel";
-case schema::IFCFILLAREASTYLEHATCHING: return "IfcFillAreaStyleHatching";
-case schema::IFCFILLAREASTYLETILESYMBOLWITHSTYLE: return "IfcFillAreaStyleTileSymbolWithStyle";
-case schema::IFCFILLAREASTYLETILES: return "IfcFillAreaStyleTiles";
-case schema::IFCFLUIDFLOWPROPERTIES: return "IfcFluidFlowProperties";
-case schema::IFCFURNISHINGELEMENTTYPE: return "IfcFurnishingElementType";
-case schema::IFCFURNITURETYPE: return "IfcFurnitureType";
-case schema::IFCGEOMETRICCURVESET: return "IfcGeometricCurveSet";
-case schema::IFCISHAPEPROFILEDEF: return "IfcIShapeProfileDef";
-case schema::IFCLSHAPEPROFILEDEF: return "IfcLShapeProfileDef";
-case schema::IFCLINE: return "IfcLine";
-case schema::IFCMANIFOLDSOLIDBREP: return "IfcManifoldSolidBrep";
-case schema::IFCOBJECT: return "IfcObject";
-case schema::IFCOFFSETCURVE2D: return "IfcOffsetCurve2D";
-case schema::IFCOFFSETCURVE3D: return "IfcOffsetCurve3D";
-case schema::IFCPERMEABLECOVERINGPROPERTIES: return "IfcPermeableCoveringProperties";
-case schema::IFCPLANARBOX: return "IfcPlanarBox";
-case schema::IFCPLANE: return "IfcPlane";
-case schema::IFCPROCESS: return "IfcProcess";
-case schema::IFCPRODUCT: return "IfcProduct";
-case schema::IFCPROJECT: return "IfcProject";
-case schema::IFCPROJECTIONCURVE: return "IfcProjectionCurve";
-case schema::IFCPROPERTYSET: return "IfcPropertySet";
-case schema::IFCPROXY: return "IfcProxy";
-case schema::IFCRECTANGLEHOLLOWPROFILEDEF: return "IfcRectangleHollowProfileDef";
-case schema::IFCRECTANGULARPYRAMID: return "IfcRectangularPyramid";
-case schema::IFCRECTANGULARTRIMMEDSURFACE: return "IfcRectangularTrimmedSurface";
-case schema::IFCRELASSIGNS: return "IfcRelAssigns";
-case schema::IFCRELASSIGNSTOACTOR: return "IfcRelAssignsToActor";
-case schema::IFCRELASSIGNSTOCONTROL: return "IfcRelAssignsToControl";
-case schema::IFCRELASSIGNSTOGROUP: return "IfcRelAssignsToGroup";
-case schema::IFCRELASSIGNSTOPROCESS: return "IfcRelAssignsToProcess";
-case schema::IFCRELASSIGNSTOPRODUCT: return "IfcRelAssignsToProduct";
-case schema::IFCRELASSIGNSTOPROJECTORDER: return "IfcRelAssignsToProjectOrder";
-case schema::IFCRELASSIGNSTORESOURCE: return "IfcRelAssignsToResource";
-case schema::IFCRELASSOCIATES: return "IfcRelAssociates";
-case schema::IFCRELASSOCIATESAPPLIEDVALUE: return "IfcRelAssociatesAppliedValue";
-case schema::IFCRELASSOCIATESAPPROVAL: return "IfcRelAssociatesApproval";
-case schema::IFCRELASSOCIATESCLASSIFICATION: return "IfcRelAssociatesClassification";
-case schema::IFCRELASSOCIATESCONSTRAINT: return "IfcRelAssociatesConstraint";
-case schema::IFCRELASSOCIATESDOCUMENT: return "IfcRelAssociatesDocument";
-case schema::IFCRELASSOCIATESLIBRARY: return "IfcRelAssociatesLibrary";
-case schema::IFCRELASSOCIATESMATERIAL: return "IfcRelAssociatesMaterial";
-case schema::IFCRELASSOCIATESPROFILEPROPERTIES: return "IfcRelAssociatesProfileProperties";
-case schema::IFCRELCONNECTS: return "IfcRelConnects";
-case schema::IFCRELCONNECTSELEMENTS: return "IfcRelConnectsElements";
-case schema::IFCRELCONNECTSPATHELEMENTS: return "IfcRelConnectsPathElements";
-case schema::IFCRELCONNECTSPORTTOELEMENT: return "IfcRelConnectsPortToElement";
-case schema::IFCRELCONNECTSPORTS: return "IfcRelConnectsPorts";
-case schema::IFCRELCONNECTSSTRUCTURALACTIVITY: return "IfcRelConnectsStructuralActivity";
-case schema::IFCRELCONNECTSSTRUCTURALELEMENT: return "IfcRelConnectsStructuralElement";
-case schema::IFCRELCONNECTSSTRUCTURALMEMBER: return "IfcRelConnectsStructuralMember";
-case schema::IFCRELCONNECTSWITHECCENTRICITY: return "IfcRelConnectsWithEccentricity";
-case schema::IFCRELCONNECTSWITHREALIZINGELEMENTS: return "IfcRelConnectsWithRealizingElements";
-case schema::IFCRELCONTAINEDINSPATIALSTRUCTURE: return "IfcRelContainedInSpatialStructure";
-case schema::IFCRELCOVERSBLDGELEMENTS: return "IfcRelCoversBldgElements";
-case schema::IFCRELCOVERSSPACES: return "IfcRelCoversSpaces";
-case schema::IFCRELDECOMPOSES: return "IfcRelDecomposes";
-case schema::IFCRELDEFINES: return "IfcRelDefines";
-case schema::IFCRELDEFINESBYPROPERTIES: return "IfcRelDefinesByProperties";
-case schema::IFCRELDEFINESBYTYPE: return "IfcRelDefinesByType";
-case schema::IFCRELFILLSELEMENT: return "IfcRelFillsElement";
-case schema::IFCRELFLOWCONTROLELEMENTS: return "IfcRelFlowControlElements";
-case schema::IFCRELINTERACTIONREQUIREMENTS: return "IfcRelInteractionRequirements";
-case schema::IFCRELNESTS: return "IfcRelNests";
-case schema::IFCRELOCCUPIESSPACES: return "IfcRelOccupiesSpaces";
-case schema::IFCRELOVERRIDESPROPERTIES: return "IfcRelOverridesProperties";
-case schema::IFCRELPROJECTSELEMENT: return "IfcRelProjectsElement";
-case schema::IFCRELREFERENCEDINSPATIALSTRUCTURE: return "IfcRelReferencedInSpatialStructure";
-case schema::IFCRELSCHEDULESCOSTITEMS: return "IfcRelSchedulesCostItems";
-case schema::IFCRELSEQUENCE: return "IfcRelSequence";
-case schema::IFCRELSERVICESBUILDINGS: return "IfcRelServicesBuildings";
-case schema::IFCRELSPACEBOUNDARY: return "IfcRelSpaceBoundary";
-case schema::IFCRELVOIDSELEMENT: return "IfcRelVoidsElement";
-case schema::IFCRESOURCE: return "IfcResource";
-case schema::IFCREVOLVEDAREASOLID: return "IfcRevolvedAreaSolid";
-case schema::IFCRIGHTCIRCULARCONE: return "IfcRightCircularCone";
-case schema::IFCRIGHTCIRCULARCYLINDER: return "IfcRightCircularCylinder";
-case schema::IFCSPATIALSTRUCTUREELEMENT: return "IfcSpatialStructureElement";
-case schema::IFCSPATIALSTRUCTUREELEMENTTYPE: return "IfcSpatialStructureElementType";
-case schema::IFCSPHERE: return "IfcSphere";
-case schema::IFCSTRUCTURALACTIVITY: return "IfcStructuralActivity";
-case schema::IFCSTRUCTURALITEM: return "IfcStructuralItem";
-case schema::IFCSTRUCTURALMEMBER: return "IfcStructuralMember";
-case schema::IFCSTRUCTURALREACTION: return "IfcStructuralReaction";
-case schema::IFCSTRUCTURALSURFACEMEMBER: return "IfcStructuralSurfaceMember";
-case schema::IFCSTRUCTURALSURFACEMEMBERVARYING: return "IfcStructuralSurfaceMemberVarying";
-case schema::IFCSTRUCTUREDDIMENSIONCALLOUT: return "IfcStructuredDimensionCallout";
-case schema::IFCSURFACECURVESWEPTAREASOLID: return "IfcSurfaceCurveSweptAreaSolid";
-case schema::IFCSURFACEOFLINEAREXTRUSION: return "IfcSurfaceOfLinearExtrusion";
-case schema::IFCSURFACEOFREVOLUTION: return "IfcSurfaceOfRevolution";
-case schema::IFCSYSTEMFURNITUREELEMENTTYPE: return "IfcSystemFurnitureElementType";
-case schema::IFCTASK: return "IfcTask";
-case schema::IFCTRANSPORTELEMENTTYPE: return "IfcTransportElementType";
-case schema::IFCACTOR: return "IfcActor";
-case schema::IFCANNOTATION: return "IfcAnnotation";
-case schema::IFCASYMMETRICISHAPEPROFILEDEF: return "IfcAsymmetricIShapeProfileDef";
-case schema::IFCBLOCK: return "IfcBlock";
-case schema::IFCBOOLEANCLIPPINGRESULT: return "IfcBooleanClippingResult";
-case schema::IFCBOUNDEDCURVE: return "IfcBoundedCurve";
-case schema::IFCBUILDING: return "IfcBuilding";
-case schema::IFCBUILDINGELEMENTTYPE: return "IfcBuildingElementType";
-case schema::IFCBUILDINGSTOREY: return "IfcBuildingStorey";
-case schema::IFCCIRCLEHOLLOWPROFILEDEF: return "IfcCircleHollowProfileDef";
-case schema::IFCCOLUMNTYPE: return "IfcColumnType";
-case schema::IFCCOMPOSITECURVE: return "IfcCompositeCurve";
-case schema::IFCCONIC: return "IfcConic";
-case schema::IFCCONSTRUCTIONRESOURCE: return "IfcConstructionResource";
-case schema::IFCCONTROL: return "IfcControl";
-case schema::IFCCOSTITEM: return "IfcCostItem";
-case schema::IFCCOSTSCHEDULE: return "IfcCostSchedule";
-case schema::IFCCOVERINGTYPE: return "IfcCoveringType";
-case schema::IFCCREWRESOURCE: return "IfcCrewResource";
-case schema::IFCCURTAINWALLTYPE: return "IfcCurtainWallType";
-case schema::IFCDIMENSIONCURVEDIRECTEDCALLOUT: return "IfcDimensionCurveDirectedCallout";
-case schema::IFCDISTRIBUTIONELEMENTTYPE: return "IfcDistributionElementType";
-case schema::IFCDISTRIBUTIONFLOWELEMENTTYPE: return "IfcDistributionFlowElementType";
-case schema::IFCELECTRICALBASEPROPERTIES: return "IfcElectricalBaseProperties";
-case schema::IFCELEMENT: return "IfcElement";
-case schema::IFCELEMENTASSEMBLY: return "IfcElementAssembly";
-case schema::IFCELEMENTCOMPONENT: return "IfcElementComponent";
-case schema::IFCELEMENTCOMPONENTTYPE: return "IfcElementComponentType";
-case schema::IFCELLIPSE: return "IfcEllipse";
-case schema::IFCENERGYCONVERSIONDEVICETYPE: return "IfcEnergyConversionDeviceType";
-case schema::IFCEQUIPMENTELEMENT: return "IfcEquipmentElement";
-case schema::IFCEQUIPMENTSTANDARD: return "IfcEquipmentStandard";
-case schema::IFCEVAPORATIVECOOLERTYPE: return "IfcEvaporativeCoolerType";
-case schema::IFCEVAPORATORTYPE: return "IfcEvaporatorType";
-case schema::IFCFACETEDBREP: return "IfcFacetedBrep";
-case schema::IFCFACETEDBREPWITHVOIDS: return "IfcFacetedBrepWithVoids";
-case schema::IFCFASTENER: return "IfcFastener";
-case schema::IFCFASTENERTYPE: return "IfcFastenerType";
-case schema::IFCFEATUREELEMENT: return "IfcFeatureElement";
-case schema::IFCFEATUREELEMENTADDITION: return "IfcFeatureElementAddition";
-case schema::IFCFEATUREELEMENTSUBTRACTION: return "IfcFeatureElementSubtraction";
-case schema::IFCFLOWCONTROLLERTYPE: return "IfcFlowControllerType";
-case schema::IFCFLOWFITTINGTYPE: return "IfcFlowFittingType";
-case schema::IFCFLOWMETERTYPE: return "IfcFlowMeterType";
-case schema::IFCFLOWMOVINGDEVICETYPE: return "IfcFlowMovingDeviceType";
-case schema::IFCFLOWSEGMENTTYPE: return "IfcFlowSegmentType";
-case schema::IFCFLOWSTORAGEDEVICETYPE: return "IfcFlowStorageDeviceType";
-case schema::IFCFLOWTERMINALTYPE: return "IfcFlowTerminalType";
-case schema::IFCFLOWTREATMENTDEVICETYPE: return "IfcFlowTreatmentDeviceType";
-case schema::IFCFURNISHINGELEMENT: return "IfcFurnishingElement";
-case schema::IFCFURNITURESTANDARD: return "IfcFurnitureStandard";
-case schema::IFCGASTERMINALTYPE: return "IfcGasTerminalType";
-case schema::IFCGRID: return "IfcGrid";
-case schema::IFCGROUP: return "IfcGroup";
-case schema::IFCHEATEXCHANGERTYPE: return "IfcHeatExchangerType";
-case schema::IFCHUMIDIFIERTYPE: return "IfcHumidifierType";
-case schema::IFCINVENTORY: return "IfcInventory";
-case schema::IFCJUNCTIONBOXTYPE: return "IfcJunctionBoxType";
-case schema::IFCLABORRESOURCE: return "IfcLaborResource";
-case schema::IFCLAMPTYPE: return "IfcLampType";
-case schema::IFCLIGHTFIXTURETYPE: return "IfcLightFixtureType";
-case schema::IFCLINEARDIMENSION: return "IfcLinearDimension";
-case schema::IFCMECHANICALFASTENER: return "IfcMechanicalFastener";
-case schema::IFCMECHANICALFASTENERTYPE: return "IfcMechanicalFastenerType";
-case schema::IFCMEMBERTYPE: return "IfcMemberType";
-case schema::IFCMOTORCONNECTIONTYPE: return "IfcMotorConnectionType";
-case schema::IFCMOVE: return "IfcMove";
-case schema::IFCOCCUPANT: return "IfcOccupant";
-case schema::IFCOPENINGELEMENT: return "IfcOpeningElement";
-case schema::IFCORDERACTION: return "IfcOrderAction";
-case schema::IFCOUTLETTYPE: return "IfcOutletType";
-case schema::IFCPERFORMANCEHISTORY: return "IfcPerformanceHistory";
-case schema::IFCPERMIT: return "IfcPermit";
-case schema::IFCPIPEFITTINGTYPE: return "IfcPipeFittingType";
-case schema::IFCPIPESEGMENTTYPE: return "IfcPipeSegmentType";
-case schema::IFCPLATETYPE: return "IfcPlateType";
-case schema::IFCPOLYLINE: return "IfcPolyline";
-case schema::IFCPORT: return "IfcPort";
-case schema::IFCPROCEDURE: return "IfcProcedure";
-case schema::IFCPROJECTORDER: return "IfcProjectOrder";
-case schema::IFCPROJECTORDERRECORD: return "IfcProjectOrderRecord";
-case schema::IFCPROJECTIONELEMENT: return "IfcProjectionElement";
-case schema::IFCPROTECTIVEDEVICETYPE: return "IfcProtectiveDeviceType";
-case schema::IFCPUMPTYPE: return "IfcPumpType";
-case schema::IFCRADIUSDIMENSION: return "IfcRadiusDimension";
-case schema::IFCRAILINGTYPE: return "IfcRailingType";
-case schema::IFCRAMPFLIGHTTYPE: return "IfcRampFlightType";
-case schema::IFCRELAGGREGATES: return "IfcRelAggregates";
-case schema::IFCRELASSIGNSTASKS: return "IfcRelAssignsTasks";
-case schema::IFCSANITARYTERMINALTYPE: return "IfcSanitaryTerminalType";
-case schema::IFCSCHEDULETIMECONTROL: return "IfcScheduleTimeControl";
-case schema::IFCSERVICELIFE: return "IfcServiceLife";
-case schema::IFCSITE: return "IfcSite";
-case schema::IFCSLABTYPE: return "IfcSlabType";
-case schema::IFCSPACE: return "IfcSpace";
-case schema::IFCSPACEHEATERTYPE: return "IfcSpaceHeaterType";
-case schema::IFCSPACEPROGRAM: return "IfcSpaceProgram";
-case schema::IFCSPACETYPE: return "IfcSpaceType";
-case schema::IFCSTACKTERMINALTYPE: return "IfcStackTerminalType";
-case schema::IFCSTAIRFLIGHTTYPE: return "IfcStairFlightType";
-case schema::IFCSTRUCTURALACTION: return "IfcStructuralAction";
-case schema::IFCSTRUCTURALCONNECTION: return "IfcStructuralConnection";
-case schema::IFCSTRUCTURALCURVECONNECTION: return "IfcStructuralCurveConnection";
-case schema::IFCSTRUCTURALCURVEMEMBER: return "IfcStructuralCurveMember";
-case schema::IFCSTRUCTURALCURVEMEMBERVARYING: return "IfcStructuralCurveMemberVarying";
-case schema::IFCSTRUCTURALLINEARACTION: return "IfcStructuralLinearAction";
-case schema::IFCSTRUCTURALLINEARACTIONVARYING: return "IfcStructuralLinearActionVarying";
-case schema::IFCSTRUCTURALLOADGROUP: return "IfcStructuralLoadGroup";
-case schema::IFCSTRUCTURALPLANARACTION: return "IfcStructuralPlanarAction";
-case schema::IFCSTRUCTURALPLANARACTIONVARYING: return "IfcStructuralPlanarActionVarying";
-case schema::IFCSTRUCTURALPOINTACTION: return "IfcStructuralPointAction";
-case schema::IFCSTRUCTURALPOINTCONNECTION: return "IfcStructuralPointConnection";
-case schema::IFCSTRUCTURALPOINTREACTION: return "IfcStructuralPointReaction";
-case schema::IFCSTRUCTURALRESULTGROUP: return "IfcStructuralResultGroup";
-case schema::IFCSTRUCTURALSURFACECONNECTION: return "IfcStructuralSurfaceConnection";
-case schema::IFCSUBCONTRACTRESOURCE: return "IfcSubContractResource";
-case schema::IFCSWITCHINGDEVICETYPE: return "IfcSwitchingDeviceType";
-case schema::IFCSYSTEM: return "IfcSystem";
-case schema::IFCTANKTYPE: return "IfcTankType";
-case schema::IFCTIMESERIESSCHEDULE: return "IfcTimeSeriesSchedule";
-case schema::IFCTRANSFORMERTYPE: return "IfcTransformerType";
-case schema::IFCTRANSPORTELEMENT: return "IfcTransportElement";
-case schema::IFCTRIMMEDCURVE: return "IfcTrimmedCurve";
-case schema::IFCTUBEBUNDLETYPE: return "IfcTubeBundleType";
-case schema::IFCUNITARYEQUIPMENTTYPE: return "IfcUnitaryEquipmentType";
-case schema::IFCVALVETYPE: return "IfcValveType";
-case schema::IFCVIRTUALELEMENT: return "IfcVirtualElement";
-case schema::IFCWALLTYPE: return "IfcWallType";
-case schema::IFCWASTETERMINALTYPE: return "IfcWasteTerminalType";
-case schema::IFCWORKCONTROL: return "IfcWorkControl";
-case schema::IFCWORKPLAN: return "IfcWorkPlan";
-case schema::IFCWORKSCHEDULE: return "IfcWorkSchedule";
-case schema::IFCZONE: return "IfcZone";
-case schema::IFC2DCOMPOSITECURVE: return "Ifc2DCompositeCurve";
-case schema::IFCACTIONREQUEST: return "IfcActionRequest";
-case schema::IFCAIRTERMINALBOXTYPE: return "IfcAirTerminalBoxType";
-case schema::IFCAIRTERMINALTYPE: return "IfcAirTerminalType";
-case schema::IFCAIRTOAIRHEATRECOVERYTYPE: return "IfcAirToAirHeatRecoveryType";
-case schema::IFCANGULARDIMENSION: return "IfcAngularDimension";
-case schema::IFCASSET: return "IfcAsset";
-case schema::IFCBSPLINECURVE: return "IfcBSplineCurve";
-case schema::IFCBEAMTYPE: return "IfcBeamType";
-case schema::IFCBEZIERCURVE: return "IfcBezierCurve";
-case schema::IFCBOILERTYPE: return "IfcBoilerType";
-case schema::IFCBUILDINGELEMENT: return "IfcBuildingElement";
-case schema::IFCBUILDINGELEMENTCOMPONENT: return "IfcBuildingElementComponent";
-case schema::IFCBUILDINGELEMENTPART: return "IfcBuildingElementPart";
-case schema::IFCBUILDINGELEMENTPROXY: return "IfcBuildingElementProxy";
-case schema::IFCBUILDINGELEMENTPROXYTYPE: return "IfcBuildingElementProxyType";
-case schema::IFCCABLECARRIERFITTINGTYPE: return "IfcCableCarrierFittingType";
-case schema::IFCCABLECARRIERSEGMENTTYPE: return "IfcCableCarrierSegmentType";
-case schema::IFCCABLESEGMENTTYPE: return "IfcCableSegmentType";
-case schema::IFCCHILLERTYPE: return "IfcChillerType";
-case schema::IFCCIRCLE: return "IfcCircle";
-case schema::IFCCOILTYPE: return "IfcCoilType";
-case schema::IFCCOLUMN: return "IfcColumn";
-case schema::IFCCOMPRESSORTYPE: return "IfcCompressorType";
-case schema::IFCCONDENSERTYPE: return "IfcCondenserType";
-case schema::IFCCONDITION: return "IfcCondition";
-case schema::IFCCONDITIONCRITERION: return "IfcConditionCriterion";
-case schema::IFCCONSTRUCTIONEQUIPMENTRESOURCE: return "IfcConstructionEquipmentResource";
-case schema::IFCCONSTRUCTIONMATERIALRESOURCE: return "IfcConstructionMaterialResource";
-case schema::IFCCONSTRUCTIONPRODUCTRESOURCE: return "IfcConstructionProductResource";
-case schema::IFCCOOLEDBEAMTYPE: return "IfcCooledBeamType";
-case schema::IFCCOOLINGTOWERTYPE: return "IfcCoolingTowerType";
-case schema::IFCCOVERING: return "IfcCovering";
-case schema::IFCCURTAINWALL: return "IfcCurtainWall";
-case schema::IFCDAMPERTYPE: return "IfcDamperType";
-case schema::IFCDIAMETERDIMENSION: return "IfcDiameterDimension";
-case schema::IFCDISCRETEACCESSORY: return "IfcDiscreteAccessory";
-case schema::IFCDISCRETEACCESSORYTYPE: return "IfcDiscreteAccessoryType";
-case schema::IFCDISTRIBUTIONCHAMBERELEMENTTYPE: return "IfcDistributionChamberElementType";
-case schema::IFCDISTRIBUTIONCONTROLELEMENTTYPE: return "IfcDistributionControlElementType";
-case schema::IFCDISTRIBUTIONELEMENT: return "IfcDistributionElement";
-case schema::IFCDISTRIBUTIONFLOWELEMENT: return "IfcDistributionFlowElement";
-case schema::IFCDISTRIBUTIONPORT: return "IfcDistributionPort";
-case schema::IFCDOOR: return "IfcDoor";
-case schema::IFCDUCTFITTINGTYPE: return "IfcDuctFittingType";
-case schema::IFCDUCTSEGMENTTYPE: return "IfcDuctSegmentType";
-case schema::IFCDUCTSILENCERTYPE: return "IfcDuctSilencerType";
-case schema::IFCEDGEFEATURE: return "IfcEdgeFeature";
-case schema::IFCELECTRICAPPLIANCETYPE: return "IfcElectricApplianceType";
-case schema::IFCELECTRICFLOWSTORAGEDEVICETYPE: return "IfcElectricFlowStorageDeviceType";
-case schema::IFCELECTRICGENERATORTYPE: return "IfcElectricGeneratorType";
-case schema::IFCELECTRICHEATERTYPE: return "IfcElectricHeaterType";
-case schema::IFCELECTRICMOTORTYPE: return "IfcElectricMotorType";
-case schema::IFCELECTRICTIMECONTROLTYPE: return "IfcElectricTimeControlType";
-case schema::IFCELECTRICALCIRCUIT: return "IfcElectricalCircuit";
-case schema::IFCELECTRICALELEMENT: return "IfcElectricalElement";
-case schema::IFCENERGYCONVERSIONDEVICE: return "IfcEnergyConversionDevice";
-case schema::IFCFANTYPE: return "IfcFanType";
-case schema::IFCFILTERTYPE: return "IfcFilterType";
-case schema::IFCFIRESUPPRESSIONTERMINALTYPE: return "IfcFireSuppressionTerminalType";
-case schema::IFCFLOWCONTROLLER: return "IfcFlowController";
-case schema::IFCFLOWFITTING: return "IfcFlowFitting";
-case schema::IFCFLOWINSTRUMENTTYPE: return "IfcFlowInstrumentType";
-case schema::IFCFLOWMOVINGDEVICE: return "IfcFlowMovingDevice";
-case schema::IFCFLOWSEGMENT: return "IfcFlowSegment";
-case schema::IFCFLOWSTORAGEDEVICE: return "IfcFlowStorageDevice";
-case schema::IFCFLOWTERMINAL: return "IfcFlowTerminal";
-case schema::IFCFLOWTREATMENTDEVICE: return "IfcFlowTreatmentDevice";
-case schema::IFCFOOTING: return "IfcFooting";
-case schema::IFCMEMBER: return "IfcMember";
-case schema::IFCPILE: return "IfcPile";
-case schema::IFCPLATE: return "IfcPlate";
-case schema::IFCRAILING: return "IfcRailing";
-case schema::IFCRAMP: return "IfcRamp";
-case schema::IFCRAMPFLIGHT: return "IfcRampFlight";
-case schema::IFCRATIONALBEZIERCURVE: return "IfcRationalBezierCurve";
-case schema::IFCREINFORCINGELEMENT: return "IfcReinforcingElement";
-case schema::IFCREINFORCINGMESH: return "IfcReinforcingMesh";
-case schema::IFCROOF: return "IfcRoof";
-case schema::IFCROUNDEDEDGEFEATURE: return "IfcRoundedEdgeFeature";
-case schema::IFCSENSORTYPE: return "IfcSensorType";
-case schema::IFCSLAB: return "IfcSlab";
-case schema::IFCSTAIR: return "IfcStair";
-case schema::IFCSTAIRFLIGHT: return "IfcStairFlight";
-case schema::IFCSTRUCTURALANALYSISMODEL: return "IfcStructuralAnalysisModel";
-case schema::IFCTENDON: return "IfcTendon";
-case schema::IFCTENDONANCHOR: return "IfcTendonAnchor";
-case schema::IFCVIBRATIONISOLATORTYPE: return "IfcVibrationIsolatorType";
-case schema::IFCWALL: return "IfcWall";
-case schema::IFCWALLSTANDARDCASE: return "IfcWallStandardCase";
-case schema::IFCWINDOW: return "IfcWindow";
-case schema::IFCACTUATORTYPE: return "IfcActuatorType";
-case schema::IFCALARMTYPE: return "IfcAlarmType";
-case schema::IFCBEAM: return "IfcBeam";
-case schema::IFCCHAMFEREDGEFEATURE: return "IfcChamferEdgeFeature";
-case schema::IFCCONTROLLERTYPE: return "IfcControllerType";
-case schema::IFCDISTRIBUTIONCHAMBERELEMENT: return "IfcDistributionChamberElement";
-case schema::IFCDISTRIBUTIONCONTROLELEMENT: return "IfcDistributionControlElement";
-case schema::IFCELECTRICDISTRIBUTIONPOINT: return "IfcElectricDistributionPoint";
-case schema::IFCREINFORCINGBAR: return "IfcReinforcingBar";
-case schema::IFCCONNECTIONVOLUMEGEOMETRY: return "IfcConnectionVolumeGeometry";
-case schema::IFCCOORDINATEOPERATION: return "IfcCoordinateOperation";
-case schema::IFCCOORDINATEREFERENCESYSTEM: return "IfcCoordinateReferenceSystem";
-case schema::IFCEXTERNALINFORMATION: return "IfcExternalInformation";
-case schema::IFCMAPCONVERSION: return "IfcMapConversion";
-case schema::IFCMATERIALDEFINITION: return "IfcMaterialDefinition";
-case schema::IFCMATERIALLAYERWITHOFFSETS: return "IfcMaterialLayerWithOffsets";
-case schema::IFCMATERIALPROFILE: return "IfcMaterialProfile";
-case schema::IFCMATERIALPROFILESET: return "IfcMaterialProfileSet";
-case schema::IFCMATERIALPROFILEWITHOFFSETS: return "IfcMaterialProfileWithOffsets";
-case schema::IFCMATERIALUSAGEDEFINITION: return "IfcMaterialUsageDefinition";
-case schema::IFCPRESENTATIONITEM: return "IfcPresentationItem";
-case schema::IFCPROJECTEDCRS: return "IfcProjectedCRS";
-case schema::IFCPROPERTYABSTRACTION: return "IfcPropertyAbstraction";
-case schema::IFCRECURRENCEPATTERN: return "IfcRecurrencePattern";
-case schema::IFCREFERENCE: return "IfcReference";
-case schema::IFCRESOURCELEVELRELATIONSHIP: return "IfcResourceLevelRelationship";
-case schema::IFCSCHEDULINGTIME: return "IfcSchedulingTime";
-case schema::IFCSTRUCTURALLOADCONFIGURATION: return "IfcStructuralLoadConfiguration";
-case schema::IFCSTRUCTURALLOADORRESULT: return "IfcStructuralLoadOrResult";
-case schema::IFCSURFACEREINFORCEMENTAREA: return "IfcSurfaceReinforcementArea";
-case schema::IFCTABLECOLUMN: return "IfcTableColumn";
-case schema::IFCTASKTIME: return "IfcTaskTime";
-case schema::IFCTASKTIMERECURRING: return "IfcTaskTimeRecurring";
-case schema::IFCTEXTUREVERTEXLIST: return "IfcTextureVertexList";
-case schema::IFCTIMEPERIOD: return "IfcTimePeriod";
-case schema::IFCWORKTIME: return "IfcWorkTime";
-case schema::IFCCOLOURRGBLIST: return "IfcColourRgbList";
-case schema::IFCCONVERSIONBASEDUNITWITHOFFSET: return "IfcConversionBasedUnitWithOffset";
-case schema::IFCEVENTTIME: return "IfcEventTime";
-case schema::IFCEXTENDEDPROPERTIES: return "IfcExtendedProperties";
-case schema::IFCEXTERNALREFERENCERELATIONSHIP: return "IfcExternalReferenceRelationship";
-case schema::IFCINDEXEDCOLOURMAP: return "IfcIndexedColourMap";
-case schema::IFCINDEXEDTEXTUREMAP: return "IfcIndexedTextureMap";
-case schema::IFCINDEXEDTRIANGLETEXTUREMAP: return "IfcIndexedTriangleTextureMap";
-case schema::IFCLAGTIME: return "IfcLagTime";
-case schema::IFCMATERIALCONSTITUENT: return "IfcMaterialConstituent";
-case schema::IFCMATERIALCONSTITUENTSET: return "IfcMaterialConstituentSet";
-case schema::IFCMATERIALPROFILESETUSAGE: return "IfcMaterialProfileSetUsage";
-case schema::IFCMATERIALPROFILESETUSAGETAPERING: return "IfcMaterialProfileSetUsageTapering";
-case schema::IFCMATERIALRELATIONSHIP: return "IfcMaterialRelationship";
-case schema::IFCMIRROREDPROFILEDEF: return "IfcMirroredProfileDef";
-case schema::IFCPREDEFINEDPROPERTIES: return "IfcPreDefinedProperties";
-case schema::IFCPROPERTYTEMPLATEDEFINITION: return "IfcPropertyTemplateDefinition";
-case schema::IFCQUANTITYSET: return "IfcQuantitySet";
-case schema::IFCRESOURCEAPPROVALRELATIONSHIP: return "IfcResourceApprovalRelationship";
-case schema::IFCRESOURCECONSTRAINTRELATIONSHIP: return "IfcResourceConstraintRelationship";
-case schema::IFCRESOURCETIME: return "IfcResourceTime";
-case schema::IFCSWEPTDISKSOLIDPOLYGONAL: return "IfcSweptDiskSolidPolygonal";
-case schema::IFCTESSELLATEDITEM: return "IfcTessellatedItem";
-case schema::IFCTYPEPROCESS: return "IfcTypeProcess";
-case schema::IFCTYPERESOURCE: return "IfcTypeResource";
-case schema::IFCADVANCEDFACE: return "IfcAdvancedFace";
-case schema::IFCCARTESIANPOINTLIST: return "IfcCartesianPointList";
-case schema::IFCCARTESIANPOINTLIST2D: return "IfcCartesianPointList2D";
-case schema::IFCCARTESIANPOINTLIST3D: return "IfcCartesianPointList3D";
-case schema::IFCCONSTRUCTIONRESOURCETYPE: return "IfcConstructionResourceType";
-case schema::IFCCONTEXT: return "IfcContext";
-case schema::IFCCREWRESOURCETYPE: return "IfcCrewResourceType";
-case schema::IFCCURVEBOUNDEDSURFACE: return "IfcCurveBoundedSurface";
-case schema::IFCEVENTTYPE: return "IfcEventType";
-case schema::IFCEXTRUDEDAREASOLIDTAPERED: return "IfcExtrudedAreaSolidTapered";
-case schema::IFCFIXEDREFERENCESWEPTAREASOLID: return "IfcFixedReferenceSweptAreaSolid";
-case schema::IFCGEOGRAPHICELEMENTTYPE: return "IfcGeographicElementType";
-case schema::IFCINDEXEDPOLYGONALFACE: return "IfcIndexedPolygonalFace";
-case schema::IFCINDEXEDPOLYGONALFACEWITHVOIDS: return "IfcIndexedPolygonalFaceWithVoids";
-case schema::IFCLABORRESOURCETYPE: return "IfcLaborResourceType";
-case schema::IFCPCURVE: return "IfcPcurve";
-case schema::IFCPREDEFINEDPROPERTYSET: return "IfcPreDefinedPropertySet";
-case schema::IFCPROCEDURETYPE: return "IfcProcedureType";
-case schema::IFCPROJECTLIBRARY: return "IfcProjectLibrary";
-case schema::IFCPROPERTYSETTEMPLATE: return "IfcPropertySetTemplate";
-case schema::IFCPROPERTYTEMPLATE: return "IfcPropertyTemplate";
-case schema::IFCRELASSIGNSTOGROUPBYFACTOR: return "IfcRelAssignsToGroupByFactor";
-case schema::IFCRELDECLARES: return "IfcRelDeclares";
-case schema::IFCRELDEFINESBYOBJECT: return "IfcRelDefinesByObject";
-case schema::IFCRELDEFINESBYTEMPLATE: return "IfcRelDefinesByTemplate";
-case schema::IFCRELINTERFERESELEMENTS: return "IfcRelInterferesElements";
-case schema::IFCRELSPACEBOUNDARY1STLEVEL: return "IfcRelSpaceBoundary1stLevel";
-case schema::IFCRELSPACEBOUNDARY2NDLEVEL: return "IfcRelSpaceBoundary2ndLevel";
-case schema::IFCREPARAMETRISEDCOMPOSITECURVESEGMENT: return "IfcReparametrisedCompositeCurveSegment";
-case schema::IFCREVOLVEDAREASOLIDTAPERED: return "IfcRevolvedAreaSolidTapered";
-case schema::IFCSIMPLEPROPERTYTEMPLATE: return "IfcSimplePropertyTemplate";
-case schema::IFCSPATIALELEMENT: return "IfcSpatialElement";
-case schema::IFCSPATIALELEMENTTYPE: return "IfcSpatialElementType";
-case schema::IFCSPATIALZONE: return "IfcSpatialZone";
-case schema::IFCSPATIALZONETYPE: return "IfcSpatialZoneType";
-case schema::IFCSPHERICALSURFACE: return "IfcSphericalSurface";
-case schema::IFCSTRUCTURALSURFACEREACTION: return "IfcStructuralSurfaceReaction";
-case schema::IFCSUBCONTRACTRESOURCETYPE: return "IfcSubContractResourceType";
-case schema::IFCSURFACECURVE: return "IfcSurfaceCurve";
-case schema::IFCTASKTYPE: return "IfcTaskType";
-case schema::IFCTESSELLATEDFACESET: return "IfcTessellatedFaceSet";
-case schema::IFCTOROIDALSURFACE: return "IfcToroidalSurface";
-case schema::IFCTRIANGULATEDFACESET: return "IfcTriangulatedFaceSet";
-case schema::IFCADVANCEDBREP: return "IfcAdvancedBrep";
-case schema::IFCADVANCEDBREPWITHVOIDS: return "IfcAdvancedBrepWithVoids";
-case schema::IFCBSPLINESURFACE: return "IfcBSplineSurface";
-case schema::IFCBSPLINESURFACEWITHKNOTS: return "IfcBSplineSurfaceWithKnots";
-case schema::IFCCHIMNEYTYPE: return "IfcChimneyType";
-case schema::IFCCIVILELEMENTTYPE: return "IfcCivilElementType";
-case schema::IFCCOMPLEXPROPERTYTEMPLATE: return "IfcComplexPropertyTemplate";
-case schema::IFCCOMPOSITECURVEONSURFACE: return "IfcCompositeCurveOnSurface";
-case schema::IFCCONSTRUCTIONEQUIPMENTRESOURCETYPE: return "IfcConstructionEquipmentResourceType";
-case schema::IFCCONSTRUCTIONMATERIALRESOURCETYPE: return "IfcConstructionMaterialResourceType";
-case schema::IFCCONSTRUCTIONPRODUCTRESOURCETYPE: return "IfcConstructionProductResourceType";
-case schema::IFCCYLINDRICALSURFACE: return "IfcCylindricalSurface";
-case schema::IFCDOORTYPE: return "IfcDoorType";
-case schema::IFCELEMENTASSEMBLYTYPE: return "IfcElementAssemblyType";
-case schema::IFCENGINETYPE: return "IfcEngineType";
-case schema::IFCEVENT: return "IfcEvent";
-case schema::IFCEXTERNALSPATIALSTRUCTUREELEMENT: return "IfcExternalSpatialStructureElement";
-case schema::IFCFOOTINGTYPE: return "IfcFootingType";
-case schema::IFCFURNITURE: return "IfcFurniture";
-case schema::IFCGEOGRAPHICELEMENT: return "IfcGeographicElement";
-case schema::IFCINDEXEDPOLYCURVE: return "IfcIndexedPolyCurve";
-case schema::IFCINTERCEPTORTYPE: return "IfcInterceptorType";
-case schema::IFCINTERSECTIONCURVE: return "IfcIntersectionCurve";
-case schema::IFCMEDICALDEVICETYPE: return "IfcMedicalDeviceType";
-case schema::IFCOPENINGSTANDARDCASE: return "IfcOpeningStandardCase";
-case schema::IFCPILETYPE: return "IfcPileType";
-case schema::IFCPOLYGONALFACESET: return "IfcPolygonalFaceSet";
-case schema::IFCRAMPTYPE: return "IfcRampType";
-case schema::IFCRATIONALBSPLINESURFACEWITHKNOTS: return "IfcRationalBSplineSurfaceWithKnots";
-case schema::IFCREINFORCINGELEMENTTYPE: return "IfcReinforcingElementType";
-case schema::IFCREINFORCINGMESHTYPE: return "IfcReinforcingMeshType";
-case schema::IFCROOFTYPE: return "IfcRoofType";
-case schema::IFCSEAMCURVE: return "IfcSeamCurve";
-case schema::IFCSHADINGDEVICETYPE: return "IfcShadingDeviceType";
-case schema::IFCSOLARDEVICETYPE: return "IfcSolarDeviceType";
-case schema::IFCSTAIRTYPE: return "IfcStairType";
-case schema::IFCSTRUCTURALCURVEACTION: return "IfcStructuralCurveAction";
-case schema::IFCSTRUCTURALCURVEREACTION: return "IfcStructuralCurveReaction";
-case schema::IFCSTRUCTURALSURFACEACTION: return "IfcStructuralSurfaceAction";
-case schema::IFCSURFACEFEATURE: return "IfcSurfaceFeature";
-case schema::IFCSYSTEMFURNITUREELEMENT: return "IfcSystemFurnitureElement";
-case schema::IFCTENDONANCHORTYPE: return "IfcTendonAnchorType";
-case schema::IFCTENDONTYPE: return "IfcTendonType";
-case schema::IFCVIBRATIONISOLATOR: return "IfcVibrationIsolator";
-case schema::IFCVOIDINGFEATURE: return "IfcVoidingFeature";
-case schema::IFCWINDOWTYPE: return "IfcWindowType";
-case schema::IFCWORKCALENDAR: return "IfcWorkCalendar";
-case schema::IFCAUDIOVISUALAPPLIANCETYPE: return "IfcAudioVisualApplianceType";
-case schema::IFCBSPLINECURVEWITHKNOTS: return "IfcBSplineCurveWithKnots";
-case schema::IFCBOUNDARYCURVE: return "IfcBoundaryCurve";
-case schema::IFCBUILDINGELEMENTPARTTYPE: return "IfcBuildingElementPartType";
-case schema::IFCBUILDINGSYSTEM: return "IfcBuildingSystem";
-case schema::IFCBURNERTYPE: return "IfcBurnerType";
-case schema::IFCCABLEFITTINGTYPE: return "IfcCableFittingType";
-case schema::IFCCHIMNEY: return "IfcChimney";
-case schema::IFCCIVILELEMENT: return "IfcCivilElement";
-case schema::IFCCOLUMNSTANDARDCASE: return "IfcColumnStandardCase";
-case schema::IFCCOMMUNICATIONSAPPLIANCETYPE: return "IfcCommunicationsApplianceType";
-case schema::IFCDISTRIBUTIONSYSTEM: return "IfcDistributionSystem";
-case schema::IFCDOORSTANDARDCASE: return "IfcDoorStandardCase";
-case schema::IFCELECTRICDISTRIBUTIONBOARDTYPE: return "IfcElectricDistributionBoardType";
-case schema::IFCENGINE: return "IfcEngine";
-case schema::IFCEVAPORATIVECOOLER: return "IfcEvaporativeCooler";
-case schema::IFCEVAPORATOR: return "IfcEvaporator";
-case schema::IFCEXTERNALSPATIALELEMENT: return "IfcExternalSpatialElement";
-case schema::IFCFLOWMETER: return "IfcFlowMeter";
-case schema::IFCHEATEXCHANGER: return "IfcHeatExchanger";
-case schema::IFCHUMIDIFIER: return "IfcHumidifier";
-case schema::IFCINTERCEPTOR: return "IfcInterceptor";
-case schema::IFCJUNCTIONBOX: return "IfcJunctionBox";
-case schema::IFCLAMP: return "IfcLamp";
-case schema::IFCLIGHTFIXTURE: return "IfcLightFixture";
-case schema::IFCMEDICALDEVICE: return "IfcMedicalDevice";
-case schema::IFCMEMBERSTANDARDCASE: return "IfcMemberStandardCase";
-case schema::IFCMOTORCONNECTION: return "IfcMotorConnection";
-case schema::IFCOUTERBOUNDARYCURVE: return "IfcOuterBoundaryCurve";
-case schema::IFCOUTLET: return "IfcOutlet";
-case schema::IFCPIPEFITTING: return "IfcPipeFitting";
-case schema::IFCPIPESEGMENT: return "IfcPipeSegment";
-case schema::IFCPLATESTANDARDCASE: return "IfcPlateStandardCase";
-case schema::IFCPROTECTIVEDEVICE: return "IfcProtectiveDevice";
-case schema::IFCPROTECTIVEDEVICETRIPPINGUNITTYPE: return "IfcProtectiveDeviceTrippingUnitType";
-case schema::IFCPUMP: return "IfcPump";
-case schema::IFCRATIONALBSPLINECURVEWITHKNOTS: return "IfcRationalBSplineCurveWithKnots";
-case schema::IFCREINFORCINGBARTYPE: return "IfcReinforcingBarType";
-case schema::IFCSANITARYTERMINAL: return "IfcSanitaryTerminal";
-case schema::IFCSHADINGDEVICE: return "IfcShadingDevice";
-case schema::IFCSLABELEMENTEDCASE: return "IfcSlabElementedCase";
-case schema::IFCSLABSTANDARDCASE: return "IfcSlabStandardCase";
-case schema::IFCSOLARDEVICE: return "IfcSolarDevice";
-case schema::IFCSPACEHEATER: return "IfcSpaceHeater";
-case schema::IFCSTACKTERMINAL: return "IfcStackTerminal";
-case schema::IFCSTRUCTURALLOADCASE: return "IfcStructuralLoadCase";
-case schema::IFCSWITCHINGDEVICE: return "IfcSwitchingDevice";
-case schema::IFCTANK: return "IfcTank";
-case schema::IFCTRANSFORMER: return "IfcTransformer";
-case schema::IFCTUBEBUNDLE: return "IfcTubeBundle";
-case schema::IFCUNITARYCONTROLELEMENTTYPE: return "IfcUnitaryControlElementType";
-case schema::IFCUNITARYEQUIPMENT: return "IfcUnitaryEquipment";
-case schema::IFCVALVE: return "IfcValve";
-case schema::IFCWALLELEMENTEDCASE: return "IfcWallElementedCase";
-case schema::IFCWASTETERMINAL: return "IfcWasteTerminal";
-case schema::IFCWINDOWSTANDARDCASE: return "IfcWindowStandardCase";
-case schema::IFCAIRTERMINAL: return "IfcAirTerminal";
-case schema::IFCAIRTERMINALBOX: return "IfcAirTerminalBox";
-case schema::IFCAIRTOAIRHEATRECOVERY: return "IfcAirToAirHeatRecovery";
-case schema::IFCAUDIOVISUALAPPLIANCE: return "IfcAudioVisualAppliance";
-case schema::IFCBEAMSTANDARDCASE: return "IfcBeamStandardCase";
-case schema::IFCBOILER: return "IfcBoiler";
-case schema::IFCBURNER: return "IfcBurner";
-case schema::IFCCABLECARRIERFITTING: return "IfcCableCarrierFitting";
-case schema::IFCCABLECARRIERSEGMENT: return "IfcCableCarrierSegment";
-case schema::IFCCABLEFITTING: return "IfcCableFitting";
-case schema::IFCCABLESEGMENT: return "IfcCableSegment";
-case schema::IFCCHILLER: return "IfcChiller";
-case schema::IFCCOIL: return "IfcCoil";
-case schema::IFCCOMMUNICATIONSAPPLIANCE: return "IfcCommunicationsAppliance";
-case schema::IFCCOMPRESSOR: return "IfcCompressor";
-case schema::IFCCONDENSER: return "IfcCondenser";
-case schema::IFCCOOLEDBEAM: return "IfcCooledBeam";
-case schema::IFCCOOLINGTOWER: return "IfcCoolingTower";
-case schema::IFCDAMPER: return "IfcDamper";
-case schema::IFCDISTRIBUTIONCIRCUIT: return "IfcDistributionCircuit";
-case schema::IFCDUCTFITTING: return "IfcDuctFitting";
-case schema::IFCDUCTSEGMENT: return "IfcDuctSegment";
-case schema::IFCDUCTSILENCER: return "IfcDuctSilencer";
-case schema::IFCELECTRICAPPLIANCE: return "IfcElectricAppliance";
-case schema::IFCELECTRICDISTRIBUTIONBOARD: return "IfcElectricDistributionBoard";
-case schema::IFCELECTRICFLOWSTORAGEDEVICE: return "IfcElectricFlowStorageDevice";
-case schema::IFCELECTRICGENERATOR: return "IfcElectricGenerator";
-case schema::IFCELECTRICMOTOR: return "IfcElectricMotor";
-case schema::IFCELECTRICTIMECONTROL: return "IfcElectricTimeControl";
-case schema::IFCFAN: return "IfcFan";
-case schema::IFCFILTER: return "IfcFilter";
-case schema::IFCFIRESUPPRESSIONTERMINAL: return "IfcFireSuppressionTerminal";
-case schema::IFCFLOWINSTRUMENT: return "IfcFlowInstrument";
-case schema::IFCPROTECTIVEDEVICETRIPPINGUNIT: return "IfcProtectiveDeviceTrippingUnit";
-case schema::IFCSENSOR: return "IfcSensor";
-case schema::IFCUNITARYCONTROLELEMENT: return "IfcUnitaryControlElement";
-case schema::IFCACTUATOR: return "IfcActuator";
-case schema::IFCALARM: return "IfcAlarm";
-case schema::IFCCONTROLLER: return "IfcController";
-case schema::IFCALIGNMENTPARAMETERSEGMENT: return "IfcAlignmentParameterSegment";
-case schema::IFCALIGNMENTVERTICALSEGMENT: return "IfcAlignmentVerticalSegment";
-case schema::IFCQUANTITYNUMBER: return "IfcQuantityNumber";
-case schema::IFCTEXTURECOORDINATEINDICES: return "IfcTextureCoordinateIndices";
-case schema::IFCTEXTURECOORDINATEINDICESWITHVOIDS: return "IfcTextureCoordinateIndicesWithVoids";
-case schema::IFCALIGNMENTCANTSEGMENT: return "IfcAlignmentCantSegment";
-case schema::IFCALIGNMENTHORIZONTALSEGMENT: return "IfcAlignmentHorizontalSegment";
-case schema::IFCLINEARPLACEMENT: return "IfcLinearPlacement";
-case schema::IFCOPENCROSSPROFILEDEF: return "IfcOpenCrossProfileDef";
-case schema::IFCPOINTBYDISTANCEEXPRESSION: return "IfcPointByDistanceExpression";
-case schema::IFCSEGMENT: return "IfcSegment";
-case schema::IFCAXIS2PLACEMENTLINEAR: return "IfcAxis2PlacementLinear";
-case schema::IFCCURVESEGMENT: return "IfcCurveSegment";
-case schema::IFCDIRECTRIXCURVESWEPTAREASOLID: return "IfcDirectrixCurveSweptAreaSolid";
-case schema::IFCINDEXEDPOLYGONALTEXTUREMAP: return "IfcIndexedPolygonalTextureMap";
-case schema::IFCOFFSETCURVE: return "IfcOffsetCurve";
-case schema::IFCOFFSETCURVEBYDISTANCES: return "IfcOffsetCurveByDistances";
-case schema::IFCPOLYNOMIALCURVE: return "IfcPolynomialCurve";
-case schema::IFCRELASSOCIATESPROFILEDEF: return "IfcRelAssociatesProfileDef";
-case schema::IFCRELPOSITIONS: return "IfcRelPositions";
-case schema::IFCSECTIONEDSOLID: return "IfcSectionedSolid";
-case schema::IFCSECTIONEDSOLIDHORIZONTAL: return "IfcSectionedSolidHorizontal";
-case schema::IFCSECTIONEDSURFACE: return "IfcSectionedSurface";
-case schema::IFCSPIRAL: return "IfcSpiral";
-case schema::IFCTHIRDORDERPOLYNOMIALSPIRAL: return "IfcThirdOrderPolynomialSpiral";
-case schema::IFCTRANSPORTATIONDEVICETYPE: return "IfcTransportationDeviceType";
-case schema::IFCTRIANGULATEDIRREGULARNETWORK: return "IfcTriangulatedIrregularNetwork";
-case schema::IFCVEHICLETYPE: return "IfcVehicleType";
-case schema::IFCBUILTELEMENTTYPE: return "IfcBuiltElementType";
-case schema::IFCCLOTHOID: return "IfcClothoid";
-case schema::IFCCOSINESPIRAL: return "IfcCosineSpiral";
-case schema::IFCCOURSETYPE: return "IfcCourseType";
-case schema::IFCDEEPFOUNDATIONTYPE: return "IfcDeepFoundationType";
-case schema::IFCDIRECTRIXDERIVEDREFERENCESWEPTAREASOLID: return "IfcDirectrixDerivedReferenceSweptAreaSolid";
-case schema::IFCFACILITY: return "IfcFacility";
-case schema::IFCFACILITYPART: return "IfcFacilityPart";
-case schema::IFCFACILITYPARTCOMMON: return "IfcFacilityPartCommon";
-case schema::IFCGEOTECHNICALELEMENT: return "IfcGeotechnicalElement";
-case schema::IFCGEOTECHNICALSTRATUM: return "IfcGeotechnicalStratum";
-case schema::IFCGRADIENTCURVE: return "IfcGradientCurve";
-case schema::IFCIMPACTPROTECTIONDEVICE: return "IfcImpactProtectionDevice";
-case schema::IFCIMPACTPROTECTIONDEVICETYPE: return "IfcImpactProtectionDeviceType";
-case schema::IFCKERBTYPE: return "IfcKerbType";
-case schema::IFCLINEARELEMENT: return "IfcLinearElement";
-case schema::IFCLIQUIDTERMINALTYPE: return "IfcLiquidTerminalType";
-case schema::IFCMARINEFACILITY: return "IfcMarineFacility";
-case schema::IFCMARINEPART: return "IfcMarinePart";
-case schema::IFCMOBILETELECOMMUNICATIONSAPPLIANCETYPE: return "IfcMobileTelecommunicationsApplianceType";
-case schema::IFCMOORINGDEVICETYPE: return "IfcMooringDeviceType";
-case schema::IFCNAVIGATIONELEMENTTYPE: return "IfcNavigationElementType";
-case schema::IFCPAVEMENTTYPE: return "IfcPavementType";
-case schema::IFCPOSITIONINGELEMENT: return "IfcPositioningElement";
-case schema::IFCRAILTYPE: return "IfcRailType";
-case schema::IFCRAILWAY: return "IfcRailway";
-case schema::IFCRAILWAYPART: return "IfcRailwayPart";
-case schema::IFCREFERENT: return "IfcReferent";
-case schema::IFCRELADHERESTOELEMENT: return "IfcRelAdheresToElement";
-case schema::IFCROAD: return "IfcRoad";
-case schema::IFCROADPART: return "IfcRoadPart";
-case schema::IFCSECONDORDERPOLYNOMIALSPIRAL: return "IfcSecondOrderPolynomialSpiral";
-case schema::IFCSEGMENTEDREFERENCECURVE: return "IfcSegmentedReferenceCurve";
-case schema::IFCSEVENTHORDERPOLYNOMIALSPIRAL: return "IfcSeventhOrderPolynomialSpiral";
-case schema::IFCSIGN: return "IfcSign";
-case schema::IFCSIGNTYPE: return "IfcSignType";
-case schema::IFCSIGNALTYPE: return "IfcSignalType";
-case schema::IFCSINESPIRAL: return "IfcSineSpiral";
-case schema::IFCTENDONCONDUIT: return "IfcTendonConduit";
-case schema::IFCTENDONCONDUITTYPE: return "IfcTendonConduitType";
-case schema::IFCTRACKELEMENTTYPE: return "IfcTrackElementType";
-case schema::IFCTRANSPORTATIONDEVICE: return "IfcTransportationDevice";
-case schema::IFCVEHICLE: return "IfcVehicle";
-case schema::IFCVIBRATIONDAMPER: return "IfcVibrationDamper";
-case schema::IFCVIBRATIONDAMPERTYPE: return "IfcVibrationDamperType";
-case schema::IFCALIGNMENTCANT: return "IfcAlignmentCant";
-case schema::IFCALIGNMENTHORIZONTAL: return "IfcAlignmentHorizontal";
-case schema::IFCALIGNMENTSEGMENT: return "IfcAlignmentSegment";
-case schema::IFCALIGNMENTVERTICAL: return "IfcAlignmentVertical";
-case schema::IFCBEARINGTYPE: return "IfcBearingType";
-case schema::IFCBRIDGE: return "IfcBridge";
-case schema::IFCBRIDGEPART: return "IfcBridgePart";
-case schema::IFCBUILTELEMENT: return "IfcBuiltElement";
-case schema::IFCBUILTSYSTEM: return "IfcBuiltSystem";
-case schema::IFCCAISSONFOUNDATIONTYPE: return "IfcCaissonFoundationType";
-case schema::IFCCONVEYORSEGMENTTYPE: return "IfcConveyorSegmentType";
-case schema::IFCCOURSE: return "IfcCourse";
-case schema::IFCDEEPFOUNDATION: return "IfcDeepFoundation";
-case schema::IFCDISTRIBUTIONBOARDTYPE: return "IfcDistributionBoardType";
-case schema::IFCEARTHWORKSCUT: return "IfcEarthworksCut";
-case schema::IFCEARTHWORKSELEMENT: return "IfcEarthworksElement";
-case schema::IFCEARTHWORKSFILL: return "IfcEarthworksFill";
-case schema::IFCELECTRICFLOWTREATMENTDEVICETYPE: return "IfcElectricFlowTreatmentDeviceType";
-case schema::IFCGEOTECHNICALASSEMBLY: return "IfcGeotechnicalAssembly";
-case schema::IFCKERB: return "IfcKerb";
-case schema::IFCLINEARPOSITIONINGELEMENT: return "IfcLinearPositioningElement";
-case schema::IFCLIQUIDTERMINAL: return "IfcLiquidTerminal";
-case schema::IFCMOBILETELECOMMUNICATIONSAPPLIANCE: return "IfcMobileTelecommunicationsAppliance";
-case schema::IFCMOORINGDEVICE: return "IfcMooringDevice";
-case schema::IFCNAVIGATIONELEMENT: return "IfcNavigationElement";
-case schema::IFCPAVEMENT: return "IfcPavement";
-case schema::IFCRAIL: return "IfcRail";
-case schema::IFCREINFORCEDSOIL: return "IfcReinforcedSoil";
-case schema::IFCSIGNAL: return "IfcSignal";
-case schema::IFCTRACKELEMENT: return "IfcTrackElement";
-case schema::IFCALIGNMENT: return "IfcAlignment";
-case schema::IFCBEARING: return "IfcBearing";
-case schema::IFCBOREHOLE: return "IfcBorehole";
-case schema::IFCCAISSONFOUNDATION: return "IfcCaissonFoundation";
-case schema::IFCCONVEYORSEGMENT: return "IfcConveyorSegment";
-case schema::IFCDISTRIBUTIONBOARD: return "IfcDistributionBoard";
-case schema::IFCELECTRICFLOWTREATMENTDEVICE: return "IfcElectricFlowTreatmentDevice";
-case schema::IFCGEOMODEL: return "IfcGeomodel";
-case schema::IFCGEOSLICE: return "IfcGeoslice";
-case schema::IFCABSORBEDDOSEMEASURE: return "IfcAbsorbedDoseMeasure";
-case schema::IFCACCELERATIONMEASURE: return "IfcAccelerationMeasure";
-case schema::IFCAMOUNTOFSUBSTANCEMEASURE: return "IfcAmountOfSubstanceMeasure";
-case schema::IFCANGULARVELOCITYMEASURE: return "IfcAngularVelocityMeasure";
-case schema::IFCAREAMEASURE: return "IfcAreaMeasure";
-case schema::IFCBOOLEAN: return "IfcBoolean";
-case schema::IFCBOXALIGNMENT: return "IfcBoxAlignment";
-case schema::IFCCOMPLEXNUMBER: return "IfcComplexNumber";
-case schema::IFCCOMPOUNDPLANEANGLEMEASURE: return "IfcCompoundPlaneAngleMeasure";
-case schema::IFCCONTEXTDEPENDENTMEASURE: return "IfcContextDependentMeasure";
-case schema::IFCCOUNTMEASURE: return "IfcCountMeasure";
-case schema::IFCCURVATUREMEASURE: return "IfcCurvatureMeasure";
-case schema::IFCDAYINMONTHNUMBER: return "IfcDayInMonthNumber";
-case schema::IFCDAYLIGHTSAVINGHOUR: return "IfcDaylightSavingHour";
-case schema::IFCDESCRIPTIVEMEASURE: return "IfcDescriptiveMeasure";
-case schema::IFCDIMENSIONCOUNT: return "IfcDimensionCount";
-case schema::IFCDOSEEQUIVALENTMEASURE: return "IfcDoseEquivalentMeasure";
-case schema::IFCDYNAMICVISCOSITYMEASURE: return "IfcDynamicViscosityMeasure";
-case schema::IFCELECTRICCAPACITANCEMEASURE: return "IfcElectricCapacitanceMeasure";
-case schema::IFCELECTRICCHARGEMEASURE: return "IfcElectricChargeMeasure";
-case schema::IFCELECTRICCONDUCTANCEMEASURE: return "IfcElectricConductanceMeasure";
-case schema::IFCELECTRICCURRENTMEASURE: return "IfcElectricCurrentMeasure";
-case schema::IFCELECTRICRESISTANCEMEASURE: return "IfcElectricResistanceMeasure";
-case schema::IFCELECTRICVOLTAGEMEASURE: return "IfcElectricVoltageMeasure";
-case schema::IFCENERGYMEASURE: return "IfcEnergyMeasure";
-case schema::IFCFONTSTYLE: return "IfcFontStyle";
-case schema::IFCFONTVARIANT: return "IfcFontVariant";
-case schema::IFCFONTWEIGHT: return "IfcFontWeight";
-case schema::IFCFORCEMEASURE: return "IfcForceMeasure";
-case schema::IFCFREQUENCYMEASURE: return "IfcFrequencyMeasure";
-case schema::IFCGLOBALLYUNIQUEID: return "IfcGloballyUniqueId";
-case schema::IFCHEATFLUXDENSITYMEASURE: return "IfcHeatFluxDensityMeasure";
-case schema::IFCHEATINGVALUEMEASURE: return "IfcHeatingValueMeasure";
-case schema::IFCHOURINDAY: return "IfcHourInDay";
-case schema::IFCIDENTIFIER: return "IfcIdentifier";
-case schema::IFCILLUMINANCEMEASURE: return "IfcIlluminanceMeasure";
-case schema::IFCINDUCTANCEMEASURE: return "IfcInductanceMeasure";
-case schema::IFCINTEGER: return "IfcInteger";
-case schema::IFCINTEGERCOUNTRATEMEASURE: return "IfcIntegerCountRateMeasure";
-case schema::IFCIONCONCENTRATIONMEASURE: return "IfcIonConcentrationMeasure";
-case schema::IFCISOTHERMALMOISTURECAPACITYMEASURE: return "IfcIsothermalMoistureCapacityMeasure";
-case schema::IFCKINEMATICVISCOSITYMEASURE: return "IfcKinematicViscosityMeasure";
-case schema::IFCLABEL: return "IfcLabel";
-case schema::IFCLENGTHMEASURE: return "IfcLengthMeasure";
-case schema::IFCLINEARFORCEMEASURE: return "IfcLinearForceMeasure";
-case schema::IFCLINEARMOMENTMEASURE: return "IfcLinearMomentMeasure";
-case schema::IFCLINEARSTIFFNESSMEASURE: return "IfcLinearStiffnessMeasure";
-case schema::IFCLINEARVELOCITYMEASURE: return "IfcLinearVelocityMeasure";
-case schema::IFCLOGICAL: return "IfcLogical";
-case schema::IFCLUMINOUSFLUXMEASURE: return "IfcLuminousFluxMeasure";
-case schema::IFCLUMINOUSINTENSITYDISTRIBUTIONMEASURE: return "IfcLuminousIntensityDistributionMeasure";
-case schema::IFCLUMINOUSINTENSITYMEASURE: return "IfcLuminousIntensityMeasure";
-case schema::IFCMAGNETICFLUXDENSITYMEASURE: return "IfcMagneticFluxDensityMeasure";
-case schema::IFCMAGNETICFLUXMEASURE: return "IfcMagneticFluxMeasure";
-case schema::IFCMASSDENSITYMEASURE: return "IfcMassDensityMeasure";
-case schema::IFCMASSFLOWRATEMEASURE: return "IfcMassFlowRateMeasure";
-case schema::IFCMASSMEASURE: return "IfcMassMeasure";
-case schema::IFCMASSPERLENGTHMEASURE: return "IfcMassPerLengthMeasure";
-case schema::IFCMINUTEINHOUR: return "IfcMinuteInHour";
-case schema::IFCMODULUSOFELASTICITYMEASURE: return "IfcModulusOfElasticityMeasure";
-case schema::IFCMODULUSOFLINEARSUBGRADEREACTIONMEASURE: return "IfcModulusOfLinearSubgradeReactionMeasure";
-case schema::IFCMODULUSOFROTATIONALSUBGRADEREACTIONMEASURE: return "IfcModulusOfRotationalSubgradeReactionMeasure";
-case schema::IFCMODULUSOFSUBGRADEREACTIONMEASURE: return "IfcModulusOfSubgradeReactionMeasure";
-case schema::IFCMOISTUREDIFFUSIVITYMEASURE: return "IfcMoistureDiffusivityMeasure";
-case schema::IFCMOLECULARWEIGHTMEASURE: return "IfcMolecularWeightMeasure";
-case schema::IFCMOMENTOFINERTIAMEASURE: return "IfcMomentOfInertiaMeasure";
-case schema::IFCMONETARYMEASURE: return "IfcMonetaryMeasure";
-case schema::IFCMONTHINYEARNUMBER: return "IfcMonthInYearNumber";
-case schema::IFCNORMALISEDRATIOMEASURE: return "IfcNormalisedRatioMeasure";
-case schema::IFCNUMERICMEASURE: return "IfcNumericMeasure";
-case schema::IFCPHMEASURE: return "IfcPHMeasure";
-case schema::IFCPARAMETERVALUE: return "IfcParameterValue";
-case schema::IFCPLANARFORCEMEASURE: return "IfcPlanarForceMeasure";
-case schema::IFCPLANEANGLEMEASURE: return "IfcPlaneAngleMeasure";
-case schema::IFCPOSITIVELENGTHMEASURE: return "IfcPositiveLengthMeasure";
-case schema::IFCPOSITIVEPLANEANGLEMEASURE: return "IfcPositivePlaneAngleMeasure";
-case schema::IFCPOSITIVERATIOMEASURE: return "IfcPositiveRatioMeasure";
-case schema::IFCPOWERMEASURE: return "IfcPowerMeasure";
-case schema::IFCPRESENTABLETEXT: return "IfcPresentableText";
-case schema::IFCPRESSUREMEASURE: return "IfcPressureMeasure";
-case schema::IFCRADIOACTIVITYMEASURE: return "IfcRadioActivityMeasure";
-case schema::IFCRATIOMEASURE: return "IfcRatioMeasure";
-case schema::IFCREAL: return "IfcReal";
-case schema::IFCROTATIONALFREQUENCYMEASURE: return "IfcRotationalFrequencyMeasure";
-case schema::IFCROTATIONALMASSMEASURE: return "IfcRotationalMassMeasure";
-case schema::IFCROTATIONALSTIFFNESSMEASURE: return "IfcRotationalStiffnessMeasure";
-case schema::IFCSECONDINMINUTE: return "IfcSecondInMinute";
-case schema::IFCSECTIONMODULUSMEASURE: return "IfcSectionModulusMeasure";
-case schema::IFCSECTIONALAREAINTEGRALMEASURE: return "IfcSectionalAreaIntegralMeasure";
-case schema::IFCSHEARMODULUSMEASURE: return "IfcShearModulusMeasure";
-case schema::IFCSOLIDANGLEMEASURE: return "IfcSolidAngleMeasure";
-case schema::IFCSOUNDPOWERMEASURE: return "IfcSoundPowerMeasure";
-case schema::IFCSOUNDPRESSUREMEASURE: return "IfcSoundPressureMeasure";
-case schema::IFCSPECIFICHEATCAPACITYMEASURE: return "IfcSpecificHeatCapacityMeasure";
-case schema::IFCSPECULAREXPONENT: return "IfcSpecularExponent";
-case schema::IFCSPECULARROUGHNESS: return "IfcSpecularRoughness";
-case schema::IFCTEMPERATUREGRADIENTMEASURE: return "IfcTemperatureGradientMeasure";
-case schema::IFCTEXT: return "IfcText";
-case schema::IFCTEXTALIGNMENT: return "IfcTextAlignment";
-case schema::IFCTEXTDECORATION: return "IfcTextDecoration";
-case schema::IFCTEXTFONTNAME: return "IfcTextFontName";
-case schema::IFCTEXTTRANSFORMATION: return "IfcTextTransformation";
-case schema::IFCTHERMALADMITTANCEMEASURE: return "IfcThermalAdmittanceMeasure";
-case schema::IFCTHERMALCONDUCTIVITYMEASURE: return "IfcThermalConductivityMeasure";
-case schema::IFCTHERMALEXPANSIONCOEFFICIENTMEASURE: return "IfcThermalExpansionCoefficientMeasure";
-case schema::IFCTHERMALRESISTANCEMEASURE: return "IfcThermalResistanceMeasure";
-case schema::IFCTHERMALTRANSMITTANCEMEASURE: return "IfcThermalTransmittanceMeasure";
-case schema::IFCTHERMODYNAMICTEMPERATUREMEASURE: return "IfcThermodynamicTemperatureMeasure";
-case schema::IFCTIMEMEASURE: return "IfcTimeMeasure";
-case schema::IFCTIMESTAMP: return "IfcTimeStamp";
-case schema::IFCTORQUEMEASURE: return "IfcTorqueMeasure";
-case schema::IFCVAPORPERMEABILITYMEASURE: return "IfcVaporPermeabilityMeasure";
-case schema::IFCVOLUMEMEASURE: return "IfcVolumeMeasure";
-case schema::IFCVOLUMETRICFLOWRATEMEASURE: return "IfcVolumetricFlowRateMeasure";
-case schema::IFCWARPINGCONSTANTMEASURE: return "IfcWarpingConstantMeasure";
-case schema::IFCWARPINGMOMENTMEASURE: return "IfcWarpingMomentMeasure";
-case schema::IFCYEARNUMBER: return "IfcYearNumber";
-case schema::IFCARCINDEX: return "IfcArcIndex";
-case schema::IFCAREADENSITYMEASURE: return "IfcAreaDensityMeasure";
-case schema::IFCBINARY: return "IfcBinary";
-case schema::IFCCARDINALPOINTREFERENCE: return "IfcCardinalPointReference";
-case schema::IFCDATE: return "IfcDate";
-case schema::IFCDATETIME: return "IfcDateTime";
-case schema::IFCDAYINWEEKNUMBER: return "IfcDayInWeekNumber";
-case schema::IFCDURATION: return "IfcDuration";
-case schema::IFCLANGUAGEID: return "IfcLanguageId";
-case schema::IFCLINEINDEX: return "IfcLineIndex";
-case schema::IFCNONNEGATIVELENGTHMEASURE: return "IfcNonNegativeLengthMeasure";
-case schema::IFCPOSITIVEINTEGER: return "IfcPositiveInteger";
-case schema::IFCPROPERTYSETDEFINITIONSET: return "IfcPropertySetDefinitionSet";
-case schema::IFCSOUNDPOWERLEVELMEASURE: return "IfcSoundPowerLevelMeasure";
-case schema::IFCSOUNDPRESSURELEVELMEASURE: return "IfcSoundPressureLevelMeasure";
-case schema::IFCTEMPERATURERATEOFCHANGEMEASURE: return "IfcTemperatureRateOfChangeMeasure";
-case schema::IFCTIME: return "IfcTime";
-case schema::IFCURIREFERENCE: return "IfcURIReference";
-default: return "<web-ifc-type-unknown>";
+return slots;
 }
+constexpr std::array<uint16_t, 1 << SLOT_BITS> TYPE_SLOTS = makeTypeSlots();
+constexpr uint32_t ordinalOf(const uint32_t typeCode) {
+for (uint32_t slot = typeCode & SLOT_MASK; TYPE_SLOTS[slot] != 0; slot = (slot + 1) & SLOT_MASK) {
+if (SCHEMA_TYPES[TYPE_SLOTS[slot] - 1].typeCode == typeCode) return TYPE_SLOTS[slot] - 1;
+}
+return SCHEMA_TYPE_COUNT;
+}
+// all direct and indirect subtypes of every type of a schema, those of ordinal i are codes[offsets[i], offsets[i + 1]), sorted by type code
+template <size_t SIZE>
+struct Subtypes { std::array<uint32_t, SCHEMA_TYPE_COUNT + 1> offsets; std::array<uint32_t, SIZE> codes; };
+constexpr size_t countSubtypes(const IFC_SCHEMA schema) {
+size_t count = 0;
+for (uint32_t i = 0; i < SCHEMA_TYPE_COUNT; i++) {
+for (uint32_t type = SCHEMA_TYPES[i].supertypes[schema]; type != 0; type = SCHEMA_TYPES[ordinalOf(type)].supertypes[schema]) count++;
+}
+return count;
+}
+template <size_t SIZE>
+constexpr Subtypes<SIZE> makeSubtypes(const IFC_SCHEMA schema) {
+Subtypes<SIZE> subtypes = {};
+for (uint32_t i = 0; i < SCHEMA_TYPE_COUNT; i++) {
+for (uint32_t type = SCHEMA_TYPES[i].supertypes[schema]; type != 0; type = SCHEMA_TYPES[ordinalOf(type)].supertypes[schema]) subtypes.offsets[ordinalOf(type) + 1]++;
+}
+for (uint32_t i = 0; i < SCHEMA_TYPE_COUNT; i++) subtypes.offsets[i + 1] += subtypes.offsets[i];
+std::array<uint32_t, SCHEMA_TYPE_COUNT> filled = {};
+for (uint32_t i = 0; i < SCHEMA_TYPE_COUNT; i++) {
+for (uint32_t type = SCHEMA_TYPES[i].supertypes[schema]; type != 0; type = SCHEMA_TYPES[ordinalOf(type)].supertypes[schema]) {
+const uint32_t ordinal = ordinalOf(type);
+subtypes.codes[subtypes.offsets[ordinal] + filled[ordinal]++] = SCHEMA_TYPES[i].typeCode;
+}
+}
+return subtypes;
+}
+constexpr auto SUBTYPES_IFC2X3 = makeSubtypes<countSubtypes(IFC2X3)>(IFC2X3);
+constexpr auto SUBTYPES_IFC4 = makeSubtypes<countSubtypes(IFC4)>(IFC4);
+constexpr auto SUBTYPES_IFC4X3 = makeSubtypes<countSubtypes(IFC4X3)>(IFC4X3);
+constexpr std::array<std::span<const uint32_t>, 3> SUBTYPE_OFFSETS = {{SUBTYPES_IFC2X3.offsets, SUBTYPES_IFC4.offsets, SUBTYPES_IFC4X3.offsets}};
+constexpr std::array<std::span<const uint32_t>, 3> SUBTYPE_CODES = {{SUBTYPES_IFC2X3.codes, SUBTYPES_IFC4.codes, SUBTYPES_IFC4X3.codes}};
+}
+uint32_t IfcSchemaManager::IfcTypeCodeToOrdinal(const uint32_t typeCode) {
+return ordinalOf(typeCode);
+}
+uint32_t IfcSchemaManager::IfcTypeOrdinalToTypeCode(const uint32_t ordinal) {
+return ordinal < SCHEMA_TYPE_COUNT ? SCHEMA_TYPES[ordinal].typeCode : 0;
+}
+std::string IfcSchemaManager::IfcTypeCodeToType(const uint32_t typeCode) const {
+const uint32_t ordinal = IfcTypeCodeToOrdinal(typeCode);
+return ordinal < SCHEMA_TYPE_COUNT ? std::string(SCHEMA_TYPES[ordinal].name) : "<web-ifc-type-unknown>";
+}
+std::string_view IfcSchemaManager::IfcTypeCodeToLabel(const uint32_t typeCode) {
+const uint32_t ordinal = IfcTypeCodeToOrdinal(typeCode);
+return ordinal < SCHEMA_TYPE_COUNT ? SCHEMA_TYPES[ordinal].label : "";
+}
+bool IfcSchemaManager::IsIfcElement(const uint32_t typeCode) {
+const uint32_t ordinal = IfcTypeCodeToOrdinal(typeCode);
+return ordinal < SCHEMA_TYPE_COUNT && SCHEMA_TYPES[ordinal].element;
+}
+std::span<const uint32_t> IfcSchemaManager::GetIfcElementList() {
+return IFC_ELEMENTS;
+}
+std::span<const IFC_SCHEMA> IfcSchemaManager::GetAvailableSchemas() {
+return SCHEMAS;
+}
+std::string_view IfcSchemaManager::GetSchemaName(const IFC_SCHEMA schema) {
+return SCHEMA_NAMES[schema];
+}
+uint32_t IfcSchemaManager::GetSupertype(const IFC_SCHEMA schema, const uint32_t typeCode) {
+const uint32_t ordinal = IfcTypeCodeToOrdinal(typeCode);
+return ordinal < SCHEMA_TYPE_COUNT ? SCHEMA_TYPES[ordinal].supertypes[schema] : 0;
+}
+std::span<const uint32_t> IfcSchemaManager::GetSubtypes(const IFC_SCHEMA schema, const uint32_t typeCode) {
+const uint32_t ordinal = IfcTypeCodeToOrdinal(typeCode);
+if (ordinal == SCHEMA_TYPE_COUNT) return {};
+return SUBTYPE_CODES[schema].subspan(SUBTYPE_OFFSETS[schema][ordinal], SUBTYPE_OFFSETS[schema][ordinal + 1] - SUBTYPE_OFFSETS[schema][ordinal]);
+}
+bool IfcSchemaManager::IsA(const IFC_SCHEMA schema, const uint32_t typeCode, const uint32_t supertypeCode) {
+for (uint32_t type = typeCode; type != 0; type = GetSupertype(schema, type)) {
+if (type == supertypeCode) return true;
+}
+return false;
 }
 }
\ No newline at end of file
@@ -0,0 +1,51 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include "ifc-schema.h"
+#include "IfcSchemaManager.h"
+
+namespace webifc::schema
+{
+
+  // Dispatch of a call site over a fixed list of types: the type ordinal of a line indexes a table holding the
+  // position of its type in the list, so the switch of the call site runs over small consecutive case values and
+  // compiles to a jump table instead of a compare chain over sparse type codes. Types missing from the list map to
+  // the position one past its end, handled by the default case.
+  template <size_t N>
+  class TypeDispatch
+  {
+    public:
+      explicit TypeDispatch(const std::array<uint32_t, N> &types)
+      {
+        static_assert(N < UINT16_MAX, "too many types for one dispatch");
+        _cases.fill(N);
+        for (size_t i = 0; i < N; i++) _cases[IfcSchemaManager::IfcTypeCodeToOrdinal(types[i])] = i;
+        // codes outside the schemas share the last ordinal, they must keep going to the default case
+        _cases[SCHEMA_TYPE_COUNT] = N;
+      }
+      uint16_t operator[](const uint32_t typeOrdinal) const
+      {
+        return _cases[typeOrdinal < SCHEMA_TYPE_COUNT ? typeOrdinal : SCHEMA_TYPE_COUNT];
+      }
+    private:
+      std::array<uint16_t, SCHEMA_TYPE_COUNT + 1> _cases;
+  };
+
+  // the case label of a type in a dispatch list, a type that is not in the list does not compile
+  template <size_t N>
+  consteval uint16_t TypeCase(const std::array<uint32_t, N> &types, const uint32_t type)
+  {
+    for (size_t i = 0; i < N; i++)
+    {
+      if (types[i] == type) return i;
+    }
+    throw "type is not part of this dispatch";
+  }
+
+}
@@ -0,0 +1,180 @@
+#include "TinyCppTest.hpp"
+#include <string>
+#include <sstream>
+#include <vector>
+#include <algorithm>
+#include "loader_models.h"
+
+using namespace std;
+using namespace webifc::parsing;
+
+// the indexes over the arguments and references of the lines
+
+TEST(ArgumentOffsetIndex)
+{
+    // the index is filled as far as arguments are walked, a tiny budget makes it start over on every new line
+    TestLoader unindexed(sampleIfc, {.ARGUMENT_INDEX_BUDGET = 0});
+    for (uint32_t budget : {64u, 16777216u})
+    {
+        TestLoader indexed(sampleIfc, {.ARGUMENT_INDEX_BUDGET = budget});
+        for (uint32_t expressID : {5u, 7u, 5u, 1u, 7u})
+        {
+            for (uint32_t argument : {3u, 1u, 8u, 0u, 5u, 2u, 9u})
+            {
+                indexed.MoveToArgumentOffset(expressID, argument);
+                unindexed.MoveToArgumentOffset(expressID, argument);
+                ASSERT_EQ(indexed.GetCurrentLineExpressID(), unindexed.GetCurrentLineExpressID());
+                const IfcTokenType type = indexed.GetTokenType();
+                ASSERT_EQ(type, unindexed.GetTokenType());
+                // both stand on the same argument, so its value reads the same
+                indexed.StepBack();
+                unindexed.StepBack();
+                switch (type)
+                {
+                    case IfcTokenType::REF:
+                        ASSERT_EQ(indexed.GetRefArgument(), unindexed.GetRefArgument());
+                        break;
+                    case IfcTokenType::STRING:
+                    case IfcTokenType::ENUM:
+                        ASSERT_EQ(indexed.GetStringArgument(), unindexed.GetStringArgument());
+                        break;
+                    case IfcTokenType::SET_BEGIN:
+                        ASSERT_EQ(indexed.GetSetArgument() == unindexed.GetSetArgument(), true);
+                        break;
+                    default:
+                        break;
+                }
+            }
+        }
+        CheckSample(indexed);
+    }
+}
+
+TEST(InverseReferenceIndex)
+{
+    TestLoader sample(sampleIfc, {.INVERSE_INDEX = true});
+    auto inverse = sample.GetInverseReferences(3);
+    ASSERT_EQ(inverse.size(), 2u);
+    ASSERT_EQ(inverse[0].expressID, 5u);
+    ASSERT_EQ(inverse[0].argument, 5u);
+    ASSERT_EQ(inverse[1].expressID, 7u);
+    ASSERT_EQ(inverse[1].argument, 5u);
+    ASSERT_EQ(sample.GetInverseReferences(5)[0].argument, 4u);
+    ASSERT_EQ(sample.GetInverseReferences(7).size(), 0u);
+
+    // every line refers to its predecessor and, from a set, to the two lines before that, across many chunk borders
+    TestModel model;
+    const uint32_t count = 5000;
+    for (uint32_t i = 1; i <= count; i++) model.Line(i, "IFCRELAGGREGATES('g',$,$,$," + Ref(i - 1) + ",(" + Ref(i - 2) + "," + Ref(i - 3) + "))");
+    const string ifc = model.Text();
+    const auto check = [&](IfcLoader &loader, uint32_t expressID)
+    {
+        auto references = loader.GetInverseReferences(expressID);
+        const uint32_t expected = std::min(count, expressID + 3) - expressID;
+        ASSERT_EQ(references.size(), expected);
+        for (uint32_t i = 0; i < expected; i++)
+        {
+            ASSERT_EQ(references[i].expressID, expressID + i + 1);
+            ASSERT_EQ(references[i].argument, i == 0 ? 4u : 5u);
+        }
+    };
+
+    TestLoader parallel(ifc, {.TAPE_SIZE = 256, .INVERSE_INDEX = true, .THREADS = 4});
+    TestLoader sequential(ifc, {.TAPE_SIZE = 256, .MEMORY_LIMIT = 768, .INVERSE_INDEX = true});
+    ostringstream snapshotStream;
+    parallel.SaveSnapshot(snapshotStream);
+    const string snapshot = snapshotStream.str();
+    IfcLoader reopened({.TAPE_SIZE = 256, .INVERSE_INDEX = true}, TestSchemaManager());
+    ASSERT_EQ(reopened.LoadSnapshot(snapshot.data(), snapshot.size()), true);
+    for (uint32_t i = 1; i <= count; i += 7)
+    {
+        check(parallel, i);
+        check(sequential, i);
+        check(reopened, i);
+    }
+
+    parallel.RemoveLine(11);
+    inverse = parallel.GetInverseReferences(10);
+    ASSERT_EQ(inverse.size(), 2u);
+    ASSERT_EQ(inverse[0].expressID, 12u);
+    check(parallel, 20);
+
+    TestLoader unindexed(ifc, {.TAPE_SIZE = 256, .THREADS = 4});
+    ASSERT_EQ(unindexed.GetInverseReferences(10).size(), 0u);
+}
+
+TEST(InversePropertyIndexMatchesScan)
+{
+    // lines of two types, written out of expressID order, holding the targets directly, repeated in a set and in sets of sets
+    TestModel model;
+    const uint32_t count = 400;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const string type = i % 3 == 0 ? "IFCRELCONTAINEDINSPATIALSTRUCTURE" : "IFCRELAGGREGATES";
+        const auto ref = [&](uint32_t k) { return Ref((i * k) % 20 + 1); };
+        model.Line((i * 37) % count + 21, type + "('g',$,'n',$," + ref(7) + ",(" + ref(3) + ",'x'," + ref(11) + "," + ref(3) + "),((" + ref(5) + "),(" + ref(13) + ")))");
+    }
+    for (uint32_t i = 1; i <= 20; i++) model.Line(i, "IFCCARTESIANPOINT((0.,0.,0.))");
+    const string ifc = model.Text();
+
+    TestLoader indexed(ifc, {.TAPE_SIZE = 256, .INVERSE_INDEX = true});
+    TestLoader scanned(ifc, {.TAPE_SIZE = 256});
+    const vector<vector<uint32_t>> typeLists = {
+        {webifc::schema::IFCRELAGGREGATES},
+        {webifc::schema::IFCRELCONTAINEDINSPATIALSTRUCTURE, webifc::schema::IFCRELAGGREGATES},
+        {webifc::schema::IFCRELAGGREGATES, webifc::schema::IFCWALL, webifc::schema::IFCRELCONTAINEDINSPATIALSTRUCTURE}};
+    const auto compare = [&]()
+    {
+        for (uint32_t expressID = 1; expressID <= 20; expressID++)
+        {
+            for (auto &types : typeLists)
+            {
+                for (uint32_t position = 0; position < 7; position++)
+                {
+                    ASSERT_EQ(indexed.GetInversePropertyForItem(expressID, types, position, true) == scanned.GetInversePropertyForItem(expressID, types, position, true), true);
+                    ASSERT_EQ(indexed.GetInversePropertyForItem(expressID, types, position, false) == scanned.GetInversePropertyForItem(expressID, types, position, false), true);
+                }
+            }
+        }
+    };
+    compare();
+
+    // a line holding a target twice in a set is listed twice, the first hit follows the order of the types
+    auto inverse = indexed.GetInversePropertyForItem(1, typeLists[0], 5, true);
+    ASSERT_EQ(inverse.size() > 1 && inverse[0] == inverse[1], true);
+    ASSERT_EQ(indexed.GetLineType(indexed.GetInversePropertyForItem(1, typeLists[1], 4, false)[0]), webifc::schema::IFCRELCONTAINEDINSPATIALSTRUCTURE);
+    ASSERT_EQ(indexed.GetInversePropertyForItem(1, typeLists[0], 6, true).size(), 0u);
+
+    for (uint32_t expressID = 21; expressID <= 21 + count; expressID += 9)
+    {
+        indexed.RemoveLine(expressID);
+        scanned.RemoveLine(expressID);
+    }
+    compare();
+}
+
+TEST(ReferenceClosure)
+{
+    for (bool inverseIndex : {false, true})
+    {
+        TestLoader sample(sampleIfc, {.INVERSE_INDEX = inverseIndex});
+        auto references = sample.GetReferences(7);
+        ASSERT_EQ(references.size(), 4u);
+        ASSERT_EQ(references[0], 1u);
+        ASSERT_EQ(references[3], 5u);
+        ASSERT_EQ(sample.GetReferenceClosure({5}), vector<uint32_t>({1, 2, 3, 5}));
+        ASSERT_EQ(sample.GetReferenceClosure({6, 2, 4}), vector<uint32_t>({2, 6}));
+        sample.RemoveLine(2);
+        ASSERT_EQ(sample.GetReferenceClosure({7}), vector<uint32_t>({1, 3, 5, 7}));
+    }
+
+    // a chain long enough for levels to be split over the workers: line i refers to line i+1 and to a set of i+2 and i+3
+    TestModel model;
+    const uint32_t count = 20000;
+    for (uint32_t i = 1; i <= count; i++) model.Line(i, "IFCRELAGGREGATES('g',$,$,$," + Ref(i + 1) + ",(" + Ref(i + 2) + "," + Ref(i + 3) + "))");
+    TestLoader loader(model.Text(), {.TAPE_SIZE = 4096, .THREADS = 4});
+    ASSERT_EQ(loader.GetReferenceClosure({count - 100}).size(), 101u);
+    vector<uint32_t> roots;
+    for (uint32_t i = 1; i <= count; i += 3) roots.push_back(i);
+    ASSERT_EQ(loader.GetReferenceClosure(roots).size(), count);
+}
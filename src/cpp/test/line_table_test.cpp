@@ -0,0 +1,146 @@
+#include "TinyCppTest.hpp"
+#include <string>
+#include <algorithm>
+#include <array>
+#include "loader_models.h"
+#include "../schema/type_dispatch.h"
+
+using namespace std;
+using namespace webifc::parsing;
+
+// the lines and their types: the line pages, the type index, type dispatch and the schema of the model
+
+TEST(TypeIndexWithNewLines)
+{
+    TestLoader loader(sampleIfc);
+    ASSERT_EQ(loader.GetExpressIDsWithType(webifc::schema::IFCDOOR).size(), 0u);
+
+    // lines written after loading are appended to their type
+    loader.UpdateLineTape(9, webifc::schema::IFCWALL, 0);
+    loader.UpdateLineTape(8, webifc::schema::IFCDOOR, 0);
+    loader.UpdateLineTape(10, webifc::schema::IFCWALL, 0);
+    auto walls = loader.GetExpressIDsWithType(webifc::schema::IFCWALL);
+    ASSERT_EQ(walls.size(), 3u);
+    ASSERT_EQ(walls[0], 5u);
+    ASSERT_EQ(walls[1], 9u);
+    ASSERT_EQ(walls[2], 10u);
+    ASSERT_EQ(loader.GetExpressIDsWithType(webifc::schema::IFCDOOR)[0], 8u);
+    ASSERT_EQ(loader.GetExpressIDsWithType(webifc::schema::IFCCARTESIANPOINT)[0], 1u);
+}
+
+TEST(SparseExpressIDs)
+{
+    // only the pages holding lines are allocated, iteration skips the ones in between
+    TestLoader loader(TestModel()
+        .Line(3, "IFCCARTESIANPOINT((0.,0.,0.))")
+        .Line(50000000, "IFCDIRECTION((0.,0.,1.))")
+        .Line(50000002, "IFCAXIS2PLACEMENT3D(#3,#50000000,$)")
+        .Text());
+
+    ASSERT_EQ(loader.GetMaxExpressId(), 50000002u);
+    auto lines = loader.GetAllLines();
+    ASSERT_EQ(lines.size(), 3u);
+    ASSERT_EQ(lines[1], 50000000u);
+    ASSERT_EQ(loader.IsValidExpressID(4), false);
+    ASSERT_EQ(loader.GetLineType(4), 0u);
+    ASSERT_EQ(loader.GetNextExpressID(3), 50000000u);
+    ASSERT_EQ(loader.GetNextExpressID(50000000), 50000002u);
+    ASSERT_EQ(loader.GetNextExpressID(50000002), 50000003u);
+    loader.MoveToArgumentOffset(50000002, 1);
+    ASSERT_EQ(loader.GetRefArgument(), 50000000u);
+}
+
+TEST(SchemaTypeTables)
+{
+    using webifc::schema::IfcSchemaManager;
+    // every type maps to a distinct ordinal and back, unknown codes land past the end
+    for (uint32_t ordinal = 0; ordinal < webifc::schema::SCHEMA_TYPE_COUNT; ordinal++)
+    {
+        uint32_t typeCode = IfcSchemaManager::IfcTypeOrdinalToTypeCode(ordinal);
+        ASSERT_EQ(IfcSchemaManager::IfcTypeCodeToOrdinal(typeCode), ordinal);
+        ASSERT_EQ(IfcSchemaManager::IfcTypeToTypeCode(IfcSchemaManager::IfcTypeCodeToLabel(typeCode)), typeCode);
+    }
+    ASSERT_EQ(IfcSchemaManager::IfcTypeCodeToOrdinal(IfcSchemaManager::IfcTypeToTypeCode("IFCNOTATYPE")), webifc::schema::SCHEMA_TYPE_COUNT);
+    ASSERT_EQ(IfcSchemaManager::IfcTypeCodeToLabel(webifc::schema::IFCWALL), string_view("IFCWALL"));
+    ASSERT_EQ(TestSchemaManager().IfcTypeCodeToType(webifc::schema::IFCWALL), string("IfcWall"));
+    ASSERT_EQ(IfcSchemaManager::IsIfcElement(webifc::schema::IFCWALL), true);
+    ASSERT_EQ(IfcSchemaManager::IsIfcElement(webifc::schema::IFCCARTESIANPOINT), false);
+    for (auto type : IfcSchemaManager::GetIfcElementList()) ASSERT_EQ(IfcSchemaManager::IsIfcElement(type), true);
+}
+
+TEST(LineTypeDispatch)
+{
+    TestLoader loader(sampleIfc);
+
+    constexpr std::array<uint32_t, 2> types = {webifc::schema::IFCDIRECTION, webifc::schema::IFCCARTESIANPOINT};
+    const webifc::schema::TypeDispatch dispatch(types);
+    auto dispatched = [&](uint32_t expressID)
+    {
+        switch (dispatch[loader.GetLineTypeOrdinal(expressID)])
+        {
+            case webifc::schema::TypeCase(types, webifc::schema::IFCDIRECTION): return webifc::schema::IFCDIRECTION;
+            case webifc::schema::TypeCase(types, webifc::schema::IFCCARTESIANPOINT): return webifc::schema::IFCCARTESIANPOINT;
+            default: return 0u;
+        }
+    };
+    ASSERT_EQ(loader.GetLineTypeOrdinal(1), webifc::schema::IfcSchemaManager::IfcTypeCodeToOrdinal(webifc::schema::IFCCARTESIANPOINT));
+    ASSERT_EQ(dispatched(1), webifc::schema::IFCCARTESIANPOINT);
+    ASSERT_EQ(dispatched(2), webifc::schema::IFCDIRECTION);
+    ASSERT_EQ(dispatched(3), 0u);
+    loader.RemoveLine(1);
+    ASSERT_EQ(loader.GetLineTypeOrdinal(1), webifc::schema::SCHEMA_TYPE_COUNT);
+    ASSERT_EQ(dispatched(1), 0u);
+}
+
+TEST(SchemaFromHeader)
+{
+    // the schema name is a string in FILE_SCHEMA, releases without tables of their own are read as the longest schema their name starts with
+    const auto schemaOf = [&](const string &header)
+    {
+        TestLoader loader("ISO-10303-21;\nHEADER;\n" + header + "ENDSEC;\nDATA;\n"
+                          "#1=IFCWALL('1',$,$,$,$,$,$,$,$);\n#2=IFCSLAB('2',$,$,$,$,$,$,$,$);\nENDSEC;\nEND-ISO-10303-21;\n");
+        const IFC_SCHEMA schema = loader.GetSchema();
+        // IfcBuiltElement only exists from IFC4X3 on, so the subtype lookup follows the schema that was read
+        ASSERT_EQ(loader.GetExpressIDsWithTypeAndSubtypes(webifc::schema::IFCBUILTELEMENT).size(), schema == IFC4X3 ? 2u : 0u);
+        return schema;
+    };
+    ASSERT_EQ(schemaOf("FILE_SCHEMA(('IFC4X3_ADD2'));\n"), IFC4X3);
+    ASSERT_EQ(schemaOf("FILE_SCHEMA(('IFC4X3'));\n"), IFC4X3);
+    ASSERT_EQ(schemaOf("FILE_SCHEMA(('IFC4'));\n"), IFC4);
+    ASSERT_EQ(schemaOf("FILE_DESCRIPTION((''),'2;1');\nFILE_SCHEMA(('IFC4X1'));\n"), IFC4);
+    ASSERT_EQ(schemaOf("FILE_SCHEMA(('IFC2X3'));\n"), IFC2X3);
+    // unknown or missing schemas fall back to IFC2X3
+    ASSERT_EQ(schemaOf("FILE_SCHEMA(('CIS2'));\n"), IFC2X3);
+    ASSERT_EQ(schemaOf(""), IFC2X3);
+}
+
+TEST(ExpressIDsWithSubtypes)
+{
+    using webifc::schema::IfcSchemaManager;
+    ASSERT_EQ(IfcSchemaManager::GetSupertype(IFC4, webifc::schema::IFCWALLSTANDARDCASE), webifc::schema::IFCWALL);
+    ASSERT_EQ(IfcSchemaManager::IsA(IFC4X3, webifc::schema::IFCWALL, webifc::schema::IFCBUILTELEMENT), true);
+    ASSERT_EQ(IfcSchemaManager::IsA(IFC4X3, webifc::schema::IFCWALL, webifc::schema::IFCBUILDINGELEMENT), false);
+    auto subtypes = IfcSchemaManager::GetSubtypes(IFC4, webifc::schema::IFCWALL);
+    ASSERT_EQ(subtypes.size(), 2u);
+    ASSERT_EQ(std::is_sorted(subtypes.begin(), subtypes.end()), true);
+
+    // IFC4X1 has no tables of its own and is read as IFC4
+    TestLoader loader(TestModel("IFC4X1")
+        .Line(4, "IFCWALLSTANDARDCASE('3',$,$,$,$,$,$,$,$)")
+        .Line(2, "IFCWALL('1',$,$,$,$,$,$,$,$)")
+        .Line(3, "IFCSLAB('2',$,$,$,$,$,$,$,$)")
+        .Line(1, "IFCCARTESIANPOINT((0.,0.,0.))")
+        .Text());
+    ASSERT_EQ(loader.GetSchema(), IFC4);
+
+    loader.MoveToArgumentOffset(2, 0);
+    auto elements = loader.GetExpressIDsWithTypeAndSubtypes(webifc::schema::IFCBUILDINGELEMENT);
+    ASSERT_EQ(elements.size(), 3u);
+    ASSERT_EQ(elements[0], 2u);
+    ASSERT_EQ(elements[1], 3u);
+    ASSERT_EQ(elements[2], 4u);
+    // the read position is left where it was
+    ASSERT_EQ(loader.GetStringArgument(), string_view("1"));
+    ASSERT_EQ(loader.GetExpressIDsWithTypeAndSubtypes(webifc::schema::IFCWALL).size(), 2u);
+    ASSERT_EQ(loader.GetExpressIDsWithTypeAndSubtypes(webifc::schema::IFCCARTESIANPOINT).size(), 1u);
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include "TinyCppTest.hpp"
+#include "../parsing/IfcLoader.h"
+#include "../schema/IfcSchemaManager.h"
+
+// models and loaders shared by the tests of the loader
+
+inline const std::string sampleIfc =
+    "ISO-10303-21;\n"
+    "HEADER;\n"
+    "FILE_DESCRIPTION(('ViewDefinition [CoordinationView]'),'2;1');\n"
+    "FILE_NAME('sample.ifc','2024-01-01T00:00:00',(''),(''),'','','');\n"
+    "FILE_SCHEMA(('IFC4'));\n"
+    "ENDSEC;\n"
+    "DATA;\n"
+    "/* a comment; with 'quotes' */\n"
+    "#1=IFCCARTESIANPOINT((0.,-1.5,2.5E-3));\n"
+    "#2=IFCDIRECTION((0.,0.,1.));\n"
+    "#3=IFCAXIS2PLACEMENT3D(#1,#2,$);\n"
+    "#5=IFCWALL('2O2Fr$t4X7Zf8NOew3FLOH',$,'It''s a wall; really',$,$,#3,$,'T1',.STANDARD.);\n"
+    "#6=IFCPROPERTYSINGLEVALUE('Count',$,IFCINTEGER(42),$);\n"
+    "#7=IFCRELAGGREGATES('0yf_M5JZv9QQXly4dq_zvI',$,$,$,#5,(#1,#2,#3));\n"
+    "ENDSEC;\n"
+    "END-ISO-10303-21;\n";
+
+// sampleIfc as a raw deflate stream
+inline constexpr unsigned char sampleIfcDeflated[] = {
+    0x55, 0x52, 0x6d, 0x6f, 0x9b, 0x30, 0x10, 0xfe, 0xce, 0xaf, 0x40, 0x22, 0xd2, 0x39, 0x95, 0xa1, 0x60, 0xa0, 0xdd, 0x86, 0xf6, 0xc1, 0x32, 0x17,
+    0xe2, 0x89, 0x00, 0x35, 0xac, 0xcb, 0x3a, 0x4d, 0x51, 0xd4, 0x12, 0x0d, 0x29, 0x81, 0x35, 0xa1, 0x8d, 0xb2, 0x5f, 0x3f, 0x3b, 0xe9, 0xa4, 0x4e,
+    0x3a, 0xf9, 0x64, 0x3f, 0x2f, 0xf7, 0x22, 0xcb, 0xba, 0x74, 0x03, 0x3f, 0xf4, 0x43, 0x97, 0x05, 0x89, 0x35, 0x47, 0x9e, 0xa2, 0x4a, 0xac, 0x99,
+    0xcc, 0x71, 0x95, 0x62, 0x2d, 0x94, 0xac, 0x1a, 0x59, 0x16, 0x84, 0xc0, 0x7d, 0xd7, 0x1e, 0xd3, 0x76, 0xd3, 0xf5, 0xdd, 0xd8, 0x0d, 0xbd, 0xfd,
+    0x43, 0x0c, 0xc3, 0xfe, 0xa9, 0xeb, 0xd7, 0xe6, 0x66, 0xb0, 0x9f, 0x30, 0xa5, 0xc0, 0x92, 0x00, 0xa6, 0x6f, 0xf2, 0x82, 0x2f, 0x90, 0xc0, 0x61,
+    0xbd, 0xfb, 0xbd, 0x6d, 0xbd, 0x6e, 0xf3, 0x08, 0x1a, 0xf6, 0x59, 0xe4, 0xfa, 0x81, 0x8e, 0xc6, 0xf7, 0x3f, 0x9d, 0x03, 0x28, 0x01, 0xad, 0x3c,
+    0x1f, 0x00, 0x97, 0xf8, 0xe7, 0x50, 0x8b, 0x39, 0x2e, 0xb8, 0xae, 0x2d, 0x67, 0x22, 0x82, 0xa9, 0x7e, 0xc6, 0x22, 0xad, 0x51, 0x24, 0x56, 0xca,
+    0x1b, 0x9e, 0x58, 0xd7, 0x57, 0xf6, 0xda, 0x7e, 0x1c, 0x76, 0xbb, 0xb6, 0x1f, 0x13, 0xfb, 0xd8, 0x8d, 0xbf, 0x6c, 0x78, 0x7e, 0x19, 0xc6, 0xf6,
+    0x00, 0xf6, 0xd5, 0xb5, 0xe5, 0x04, 0x9f, 0xb5, 0x50, 0x70, 0xd5, 0x60, 0x2d, 0x79, 0x51, 0x95, 0xb2, 0x68, 0x08, 0xf1, 0x3d, 0xea, 0x06, 0x5e,
+    0x4c, 0x99, 0x17, 0xa3, 0x1b, 0x1a, 0x53, 0x87, 0x19, 0x5e, 0x2a, 0x15, 0x8a, 0xcb, 0xac, 0x9a, 0xa2, 0x23, 0xf0, 0xce, 0x60, 0x68, 0x40, 0xbe,
+    0x94, 0x35, 0xab, 0x72, 0x2e, 0x70, 0x81, 0x45, 0x13, 0xa6, 0xc4, 0x09, 0xa8, 0xc3, 0xe8, 0xc4, 0x10, 0x62, 0x43, 0xf8, 0xc6, 0xf3, 0x9c, 0x00,
+    0x2b, 0xd9, 0x6c, 0x3f, 0x19, 0xa3, 0xe5, 0xed, 0xc3, 0xe6, 0x43, 0x51, 0xb6, 0xc7, 0x70, 0x96, 0x97, 0x73, 0xa0, 0x13, 0x0a, 0x72, 0x04, 0x38,
+    0xe8, 0x76, 0x8f, 0xeb, 0xed, 0x36, 0xb1, 0xf7, 0xad, 0x4e, 0x27, 0x03, 0x4c, 0xa8, 0x13, 0x1a, 0xbc, 0x09, 0x80, 0x7a, 0x75, 0xc3, 0x8b, 0x94,
+    0xab, 0xd4, 0x33, 0xbe, 0x37, 0xc6, 0xb7, 0x52, 0x65, 0x85, 0xaa, 0xf9, 0x5e, 0xcb, 0x22, 0xcb, 0xf1, 0x9e, 0xe7, 0x5f, 0xf5, 0x4e, 0xc5, 0xf0,
+    0xd2, 0x8f, 0x46, 0xac, 0x09, 0x7a, 0x26, 0xcc, 0x50, 0x91, 0x88, 0x4d, 0x2f, 0xed, 0xdc, 0x1a, 0x99, 0xc2, 0x9c, 0x67, 0x99, 0xc2, 0x8c, 0xeb,
+    0xd9, 0x09, 0xf8, 0xa7, 0xcd, 0x6a, 0x11, 0x7f, 0x79, 0x78, 0xfd, 0x78, 0x77, 0xb7, 0xdc, 0x9e, 0xa2, 0xa7, 0xe7, 0xd5, 0x9f, 0x57, 0x79, 0x29,
+    0xaf, 0x1b, 0x88, 0xe9, 0xdb, 0x3c, 0x4e, 0xf8, 0x7e, 0xc9, 0x3a, 0xbb, 0xf2, 0xbf, 0xef, 0xf1, 0x17
+};
+
+// one schema manager for all loaders of the tests
+inline const webifc::schema::IfcSchemaManager &TestSchemaManager()
+{
+    static const webifc::schema::IfcSchemaManager schemaManager;
+    return schemaManager;
+}
+
+// a loader with the given settings that has read text, the loader reads evicted chunks again from memory so it keeps its own copy
+struct TestLoader : webifc::parsing::IfcLoader
+{
+    explicit TestLoader(const std::string &text, const webifc::parsing::IfcLoaderSettings &settings = {}) : IfcLoader(settings, TestSchemaManager()), _text(text)
+    {
+        LoadFile(_text.data(), _text.size());
+    }
+
+  private:
+    const std::string _text;
+};
+
+inline std::string Ref(const uint32_t expressID)
+{
+    return "#" + std::to_string(expressID);
+}
+
+// an IFC file put together line by line for tests that need more lines or other ones than sampleIfc
+class TestModel
+{
+  public:
+    explicit TestModel(const std::string &schema = "IFC4") : _text("ISO-10303-21;\nHEADER;\nFILE_SCHEMA(('" + schema + "'));\nENDSEC;\nDATA;\n") {}
+
+    // appends #expressID=entity;
+    TestModel &Line(const uint32_t expressID, const std::string &entity)
+    {
+        _text += Ref(expressID) + "=" + entity + ";\n";
+        return *this;
+    }
+
+    // appends text as it is, such as a comment
+    TestModel &Raw(const std::string &text)
+    {
+        _text += text;
+        return *this;
+    }
+
+    std::string Text() const
+    {
+        return _text + "ENDSEC;\nEND-ISO-10303-21;\n";
+    }
+
+  private:
+    std::string _text;
+};
+
+// checks that a loader read sampleIfc as it is
+inline void CheckSample(webifc::parsing::IfcLoader &loader)
+{
+    using webifc::parsing::IfcTokenType;
+    ASSERT_EQ(loader.GetMaxExpressId(), 7u);
+    ASSERT_EQ(loader.IsValidExpressID(4), false);
+    ASSERT_EQ(loader.GetLineType(5), webifc::schema::IFCWALL);
+
+    loader.MoveToArgumentOffset(1, 0);
+    auto coords = loader.GetSetArgument();
+    ASSERT_EQ(coords.size(), 3u);
+    ASSERT_EQ(loader.GetDoubleArgument(coords[1]), -1.5);
+    ASSERT_EQ(loader.GetDoubleArgument(coords[2]), 2.5E-3);
+
+    loader.MoveToArgumentOffset(5, 2);
+    ASSERT_EQ(loader.GetCurrentLineExpressID(), 5u);
+    ASSERT_EQ(loader.GetDecodedStringArgument(), "It's a wall; really");
+    loader.MoveToArgumentOffset(5, 5);
+    ASSERT_EQ(loader.GetRefArgument(), 3u);
+    loader.MoveToArgumentOffset(5, 8);
+    ASSERT_EQ(loader.GetStringArgument(), "STANDARD");
+
+    loader.MoveToArgumentOffset(6, 2);
+    ASSERT_EQ(loader.GetStringArgument(), "IFCINTEGER");
+    loader.GetTokenType();
+    ASSERT_EQ(loader.GetIntArgument(), 42);
+
+    loader.MoveToArgumentOffset(1, 0);
+    coords = loader.GetSetArgument();
+    ASSERT_EQ(loader.GetTokenType(coords[2]), IfcTokenType::REAL);
+    loader.StepBack();
+    ASSERT_EQ(loader.GetDoubleArgumentAsString(), "2.5E-3");
+
+    loader.MoveToArgumentOffset(7, 5);
+    ASSERT_EQ(loader.GetCurrentLineExpressID(), 7u);
+    auto related = loader.GetSetArgument();
+    ASSERT_EQ(related.size(), 3u);
+    ASSERT_EQ(loader.GetRefArgument(related[2]), 3u);
+
+    auto walls = loader.GetExpressIDsWithType(webifc::schema::IFCWALL);
+    ASSERT_EQ(walls.size(), 1u);
+    ASSERT_EQ(walls[0], 5u);
+}
@@ -0,0 +1,185 @@
+#include "TinyCppTest.hpp"
+#include <string>
+#include <sstream>
+#include <vector>
+#include "loader_models.h"
+
+using namespace std;
+using namespace webifc::parsing;
+
+// writing models back out after edits, in full, incrementally or as a subset, and compacting the edited tape
+
+static void EditSample(IfcLoader &loader)
+{
+    // #3 loses its axis, #6 is removed and #8 is new
+    uint32_t start = loader.GetTotalSize();
+    loader.Push<uint8_t>(IfcTokenType::REF);
+    loader.Push<uint32_t>(3);
+    loader.PushLabel("IFCAXIS2PLACEMENT3D");
+    loader.Push<uint8_t>(IfcTokenType::SET_BEGIN);
+    loader.Push<uint8_t>(IfcTokenType::REF);
+    loader.Push<uint32_t>(1);
+    loader.Push<uint8_t>(IfcTokenType::EMPTY);
+    loader.Push<uint8_t>(IfcTokenType::EMPTY);
+    loader.Push<uint8_t>(IfcTokenType::SET_END);
+    loader.Push<uint8_t>(IfcTokenType::LINE_END);
+    loader.UpdateLineTape(3, webifc::schema::IFCAXIS2PLACEMENT3D, start);
+    loader.RemoveLine(6);
+    start = loader.GetTotalSize();
+    loader.Push<uint8_t>(IfcTokenType::REF);
+    loader.Push<uint32_t>(8);
+    loader.PushLabel("IFCDIRECTION");
+    loader.Push<uint8_t>(IfcTokenType::SET_BEGIN);
+    loader.Push<uint8_t>(IfcTokenType::SET_BEGIN);
+    loader.Push<uint8_t>(IfcTokenType::REAL);
+    loader.PushDouble(1);
+    loader.Push<uint8_t>(IfcTokenType::REAL);
+    loader.PushDouble(0);
+    loader.Push<uint8_t>(IfcTokenType::SET_END);
+    loader.Push<uint8_t>(IfcTokenType::SET_END);
+    loader.Push<uint8_t>(IfcTokenType::LINE_END);
+    loader.UpdateLineTape(8, webifc::schema::IFCDIRECTION, start);
+}
+
+static void WritePlacement(IfcLoader &loader, uint32_t expressID, uint32_t axis)
+{
+    uint32_t start = loader.GetTotalSize();
+    loader.Push<uint8_t>(IfcTokenType::REF);
+    loader.Push<uint32_t>(expressID);
+    loader.PushLabel("IFCAXIS2PLACEMENT3D");
+    loader.Push<uint8_t>(IfcTokenType::SET_BEGIN);
+    loader.Push<uint8_t>(IfcTokenType::REF);
+    loader.Push<uint32_t>(1);
+    loader.Push<uint8_t>(IfcTokenType::REF);
+    loader.Push<uint32_t>(axis);
+    loader.Push<uint8_t>(IfcTokenType::EMPTY);
+    loader.Push<uint8_t>(IfcTokenType::SET_END);
+    loader.Push<uint8_t>(IfcTokenType::LINE_END);
+    loader.UpdateLineTape(expressID, webifc::schema::IFCAXIS2PLACEMENT3D, start);
+}
+
+static void EditPlacements(IfcLoader &loader, uint32_t edits)
+{
+    for (uint32_t i = 0; i < edits; i++) WritePlacement(loader, 3 + (i % 2) * 5, 2);
+    WritePlacement(loader, 9, 2);
+    loader.RemoveLine(9);
+    loader.RemoveLine(6);
+}
+
+static string Saved(const IfcLoader &loader)
+{
+    ostringstream stream;
+    loader.SaveFile(stream);
+    return stream.str();
+}
+
+TEST(SaveSubset)
+{
+    TestLoader loader(sampleIfc);
+
+    ostringstream allStream;
+    loader.SaveSubset(loader.GetAllLines(), allStream, false);
+    ASSERT_EQ(allStream.str(), Saved(loader));
+
+    ostringstream subsetStream;
+    loader.SaveSubset({5}, subsetStream, false);
+    TestLoader reopened(subsetStream.str());
+    ASSERT_EQ(reopened.GetAllLines(), vector<uint32_t>({1, 2, 3, 5}));
+    ASSERT_EQ(reopened.GetSchema(), loader.GetSchema());
+    reopened.MoveToArgumentOffset(5, 5);
+    ASSERT_EQ(reopened.GetRefArgument(), 3u);
+
+    ostringstream renumberedStream;
+    loader.SaveSubset({5, 6}, renumberedStream, true);
+    TestLoader compact(renumberedStream.str());
+    ASSERT_EQ(compact.GetAllLines(), vector<uint32_t>({1, 2, 3, 4, 5}));
+    ASSERT_EQ(compact.GetLineType(4), webifc::schema::IFCWALL);
+    ASSERT_EQ(compact.GetLineType(5), webifc::schema::IFCPROPERTYSINGLEVALUE);
+    compact.MoveToArgumentOffset(4, 5);
+    ASSERT_EQ(compact.GetRefArgument(), 3u);
+}
+
+TEST(ParallelSave)
+{
+    // ranges of 50 lines written by several workers must come out as the single threaded save
+    TestModel model;
+    for (uint32_t i = 1; i <= 3000; i++) model.Line(i, "IFCPROPERTYSINGLEVALUE('P\\X2\\00E9\\X0\\ " + to_string(i) + "',$,IFCREAL(" + to_string(i) + ".25)," + Ref(i + 1) + ")");
+    const string ifc = model.Text();
+
+    TestLoader sequential(ifc, {.TAPE_SIZE = 4096, .LINEWRITER_BUFFER = 50});
+    TestLoader parallel(ifc, {.TAPE_SIZE = 4096, .LINEWRITER_BUFFER = 50, .THREADS = 4});
+    const string saved = Saved(parallel);
+    ASSERT_EQ(saved, Saved(sequential));
+    ASSERT_EQ(saved.find("#3000=IFCPROPERTYSINGLEVALUE('P\\X2\\00E9\\X0\\ 3000',$,IFCREAL(3000.25),#3001);") != string::npos, true);
+}
+
+TEST(IncrementalSave)
+{
+    TestLoader untouched(sampleIfc);
+    ostringstream untouchedStream;
+    untouched.SaveFileIncremental(untouchedStream);
+    ASSERT_EQ(untouchedStream.str(), sampleIfc);
+
+    // comments and the text of all other lines stay as they are in the source, also when it is read in small windows
+    string expected = sampleIfc;
+    expected.replace(expected.find("#3="), expected.find("#5=") - expected.find("#3="), "#3=IFCAXIS2PLACEMENT3D(#1,$,$);\n");
+    expected.erase(expected.find("#6="), expected.find("#7=") - expected.find("#6="));
+    expected.insert(expected.rfind("ENDSEC;"), "#8=IFCDIRECTION((1.,0.));\n");
+
+    TestLoader loader(sampleIfc);
+    EditSample(loader);
+    ostringstream savedStream;
+    loader.SaveFileIncremental(savedStream);
+    ASSERT_EQ(savedStream.str(), expected);
+
+    IfcLoader streamed({.TAPE_SIZE = 64, .MEMORY_LIMIT = 128}, TestSchemaManager());
+    istringstream stream(sampleIfc);
+    streamed.LoadFile(stream);
+    EditSample(streamed);
+    ostringstream streamedStream;
+    streamed.SaveFileIncremental(streamedStream);
+    ASSERT_EQ(streamedStream.str(), expected);
+
+    TestLoader reopened(savedStream.str());
+    ASSERT_EQ(reopened.GetAllLines(), vector<uint32_t>({1, 2, 3, 5, 7, 8}));
+    reopened.MoveToArgumentOffset(5, 2);
+    ASSERT_EQ(reopened.GetDecodedStringArgument(), "It's a wall; really");
+}
+
+TEST(TapeCompaction)
+{
+    TestLoader edited(sampleIfc, {.TAPE_SIZE = 256, .TAPE_GARBAGE_RATIO = 0});
+    EditPlacements(edited, 200);
+    const string expected = Saved(edited);
+
+    // the live lines are all that is left of the written tape, read and saved as before
+    TestLoader compacted(sampleIfc, {.TAPE_SIZE = 256, .TAPE_GARBAGE_RATIO = 0});
+    const uint64_t sourceSize = compacted.GetTotalSize();
+    EditPlacements(compacted, 200);
+    compacted.CompactTape();
+    ASSERT_EQ(compacted.GetTotalSize() < sourceSize + 256, true);
+    ASSERT_EQ(Saved(compacted), expected);
+    ASSERT_EQ(compacted.GetLineType(9), 0u);
+    compacted.MoveToArgumentOffset(8, 1);
+    ASSERT_EQ(compacted.GetCurrentLineExpressID(), 8u);
+    ASSERT_EQ(compacted.GetRefArgument(), 2u);
+    compacted.MoveToArgumentOffset(5, 2);
+    ASSERT_EQ(compacted.GetDecodedStringArgument(), "It's a wall; really");
+
+    // in steps, with edits in between
+    TestLoader stepped(sampleIfc, {.TAPE_SIZE = 256, .TAPE_GARBAGE_RATIO = 0});
+    EditPlacements(stepped, 198);
+    uint32_t steps = 0;
+    while (!stepped.CompactTape(16))
+    {
+        if (steps++ == 1) EditPlacements(stepped, 2);
+    }
+    ASSERT_EQ(steps > 1, true);
+    ASSERT_EQ(Saved(stepped), expected);
+
+    // past the garbage ratio the tape is compacted while editing
+    TestLoader automatic(sampleIfc, {.TAPE_SIZE = 256});
+    EditPlacements(automatic, 200);
+    ASSERT_EQ(automatic.GetTotalSize() < sourceSize + 4 * 256, true);
+    ASSERT_EQ(Saved(automatic), expected);
+}
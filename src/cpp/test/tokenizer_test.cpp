@@ -0,0 +1,252 @@
+#include "TinyCppTest.hpp"
+#include <string>
+#include <sstream>
+#include <cstring>
+#include "loader_models.h"
+
+using namespace std;
+using namespace webifc::parsing;
+
+// reading the source into the tape: in one piece or in windows, sequentially or in parallel, from zip containers and snapshots
+
+TEST(LoadFromMemory)
+{
+    TestLoader loader(sampleIfc);
+    CheckSample(loader);
+}
+
+TEST(LoadFromMemoryWithEviction)
+{
+    // tiny tape chunks and a two chunk budget force chunks to be evicted and re-tokenized
+    TestLoader loader(sampleIfc, {.TAPE_SIZE = 64, .MEMORY_LIMIT = 128});
+    CheckSample(loader);
+    CheckSample(loader);
+}
+
+TEST(LoadFromMemoryWithSpill)
+{
+    // evicted chunks are kept compressed, a pool of 160 bytes only holds a couple of them and the rest are tokenized again
+    for (uint32_t spillLimit : {160u, 268435456u})
+    {
+        TestLoader loader(sampleIfc, {.TAPE_SIZE = 64, .MEMORY_LIMIT = 128, .TAPE_SPILL_LIMIT = spillLimit});
+        CheckSample(loader);
+        CheckSample(loader);
+        auto &stats = loader.GetTapeCacheStats();
+        ASSERT_EQ(stats.spilledBytes <= spillLimit, true);
+        if (spillLimit == 160) ASSERT_EQ(stats.reloadedBytes > 0, true);
+        else
+        {
+            ASSERT_EQ(stats.spillHits, stats.misses);
+            ASSERT_EQ(stats.reloadedBytes, 0u);
+        }
+    }
+}
+
+TEST(LoadFromStreamWithSmallWindow)
+{
+    // the file stream window is as large as a tape chunk, so strings, numbers and labels get split across windows
+    IfcLoader loader({.TAPE_SIZE = 64, .MEMORY_LIMIT = 128}, TestSchemaManager());
+    istringstream stream(sampleIfc);
+    loader.LoadFile(stream);
+    CheckSample(loader);
+}
+
+TEST(TapeChunkEvictionKeepsRecentChunks)
+{
+    // three chunks fit, the chunk holding #1 is read between all other reads and so is never the one evicted
+    TestModel model;
+    for (uint32_t i = 1; i <= 200; i++) model.Line(i, "IFCCARTESIANPOINT((" + to_string(i) + ".,0.,0.))");
+
+    TestLoader loader(model.Text(), {.TAPE_SIZE = 256, .MEMORY_LIMIT = 768, .ARGUMENT_INDEX_BUDGET = 0, .TAPE_SPILL_LIMIT = 0});
+    const auto firstCoordinate = [&](uint32_t expressID)
+    {
+        loader.MoveToArgumentOffset(expressID, 0);
+        return loader.GetDoubleArgument(loader.GetSetArgument()[0]);
+    };
+    const size_t missesAfterLoad = loader.GetTapeCacheStats().misses;
+    for (uint32_t i = 2; i <= 200; i++)
+    {
+        ASSERT_EQ(firstCoordinate(1), 1.0);
+        ASSERT_EQ(firstCoordinate(i), (double)i);
+    }
+    auto &stats = loader.GetTapeCacheStats();
+    // every chunk is reloaded at most once, as in the sequential scan while parsing
+    ASSERT_EQ(stats.misses - missesAfterLoad <= missesAfterLoad + 3, true);
+    ASSERT_EQ(stats.hits > 0, true);
+    ASSERT_EQ(stats.evictions > 0, true);
+}
+
+TEST(LoadFromMemoryParallel)
+{
+    // enough lines for several chunks of several pieces each, with separators inside strings and comments
+    TestModel model;
+    for (uint32_t i = 1; i <= 40000; i++)
+    {
+        model.Line(i, "IFCCARTESIANPOINT((" + to_string(i) + ".5,-1.,2.))");
+        if (i % 1000 == 0) model.Raw("/* ; ' */\n").Line(++i, "IFCLABEL('a;b''c')");
+    }
+    const string ifc = model.Text();
+
+    TestLoader sequential(ifc, {.TAPE_SIZE = 262144});
+    const auto check = [&](IfcLoader &parallel)
+    {
+        ASSERT_EQ(parallel.GetTotalSize(), sequential.GetTotalSize());
+        ASSERT_EQ(parallel.GetMaxExpressId(), sequential.GetMaxExpressId());
+        for (uint32_t i = 1; i <= parallel.GetMaxExpressId(); i += 997)
+        {
+            ASSERT_EQ(parallel.GetLineType(i), sequential.GetLineType(i));
+            parallel.MoveToArgumentOffset(i, 0);
+            sequential.MoveToArgumentOffset(i, 0);
+            ASSERT_EQ(parallel.GetTokenType(), sequential.GetTokenType());
+        }
+        parallel.MoveToArgumentOffset(1001, 0);
+        ASSERT_EQ(parallel.GetStringArgument(), "a;b''c");
+        parallel.MoveToArgumentOffset(40000, 0);
+        auto coords = parallel.GetSetArgument();
+        ASSERT_EQ(parallel.GetDoubleArgument(coords[0]), 40000.5);
+    };
+    TestLoader parallel(ifc, {.TAPE_SIZE = 262144, .THREADS = 4});
+    check(parallel);
+
+    // a stream is read in order, chunk by chunk, and only tokenized in parallel; with a small tape budget evicted chunks are read from it again
+    WorkerPool workers(3);
+    for (uint32_t memoryLimit : {262144u * 2, 2147483648u})
+    {
+        IfcLoader streamed({.TAPE_SIZE = 262144, .MEMORY_LIMIT = memoryLimit, .TAPE_SPILL_LIMIT = 0}, TestSchemaManager(), &workers);
+        istringstream stream(ifc);
+        streamed.LoadFile(stream);
+        check(streamed);
+        check(streamed);
+    }
+}
+
+TEST(SequentialScanWithPrefetch)
+{
+    // with a worker the chunk after the one being read is loaded in the background
+    TestModel model;
+    for (uint32_t i = 1; i <= 2000; i++) model.Line(i, "IFCCARTESIANPOINT((" + to_string(i) + ".,0.,0.))");
+    const string ifc = model.Text();
+
+    for (uint32_t spillLimit : {0u, 268435456u})
+    {
+        TestLoader loader(ifc, {.TAPE_SIZE = 256, .MEMORY_LIMIT = 768, .ARGUMENT_INDEX_BUDGET = 0, .TAPE_SPILL_LIMIT = spillLimit, .THREADS = 2});
+        for (uint32_t pass = 0; pass < 2; pass++)
+        {
+            for (uint32_t i = 1; i <= 2000; i++)
+            {
+                loader.MoveToArgumentOffset(i, 0);
+                ASSERT_EQ(loader.GetDoubleArgument(loader.GetSetArgument()[0]), (double)i);
+            }
+        }
+        ASSERT_EQ(loader.GetTapeCacheStats().prefetchHits > 0, true);
+    }
+}
+
+TEST(SnapshotRoundTrip)
+{
+    TestLoader loader(sampleIfc, {.TAPE_SIZE = 64, .MEMORY_LIMIT = 128});
+    ostringstream snapshotStream;
+    loader.SaveSnapshot(snapshotStream);
+    ostringstream savedStream;
+    loader.SaveFile(savedStream);
+    const string snapshot = snapshotStream.str();
+
+    // a small tape budget so the snapshot chunks are evicted and copied in again
+    for (uint32_t memoryLimit : {128u, 2147483648u})
+    {
+        IfcLoader reopened({.TAPE_SIZE = 64, .MEMORY_LIMIT = memoryLimit}, TestSchemaManager());
+        ASSERT_EQ(reopened.LoadSnapshot(snapshot.data(), snapshot.size()), true);
+        CheckSample(reopened);
+        ASSERT_EQ(reopened.GetSchema(), loader.GetSchema());
+        ostringstream reopenedStream;
+        reopened.SaveFile(reopenedStream);
+        ASSERT_EQ(reopenedStream.str(), savedStream.str());
+    }
+
+    IfcLoader truncated({.TAPE_SIZE = 64, .MEMORY_LIMIT = 128}, TestSchemaManager());
+    ASSERT_EQ(truncated.LoadSnapshot(snapshot.data(), snapshot.size() - 1), false);
+    string otherVersion = snapshot;
+    otherVersion[8]++;
+    IfcLoader outdated({.TAPE_SIZE = 64, .MEMORY_LIMIT = 128}, TestSchemaManager());
+    ASSERT_EQ(outdated.LoadSnapshot(otherVersion.data(), otherVersion.size()), false);
+}
+
+TEST(SnapshotWithDamagedOffsets)
+{
+    TestLoader loader(sampleIfc);
+    ostringstream snapshotStream;
+    loader.SaveSnapshot(snapshotStream);
+    const string snapshot = snapshotStream.str();
+
+    // the header counts sit after the 8 byte magic, the version and the highest expressID
+    const auto field = [&](size_t index)
+    {
+        uint64_t value;
+        memcpy(&value, snapshot.data() + 16 + index * sizeof(value), sizeof(value));
+        return value;
+    };
+    const uint64_t chunkCount = field(0), headerLineCount = field(1), pageCount = field(2), typeCount = field(3), tapeSize = field(5);
+    // a line page holds 1024 types, tape offsets and type ordinals and is written after its index
+    const size_t pageSize = sizeof(uint64_t) + 1024 * (2 * sizeof(uint32_t) + sizeof(uint16_t));
+    const size_t pagesStart = (64 + (chunkCount + headerLineCount) * sizeof(uint64_t) + 7) & ~size_t(7);
+    const size_t firstTapeOffset = pagesStart + sizeof(uint64_t) + 1024 * sizeof(uint32_t);
+    const size_t typeOffsetsStart = pagesStart + pageCount * pageSize + typeCount * sizeof(uint32_t);
+    const auto damaged = [&](size_t pos, uint32_t value)
+    {
+        string copy = snapshot;
+        memcpy(copy.data() + pos, &value, sizeof(value));
+        IfcLoader reopened({}, TestSchemaManager());
+        return reopened.LoadSnapshot(copy.data(), copy.size());
+    };
+    ASSERT_EQ(damaged(firstTapeOffset, 0), true);
+    // #1 past the end of the tape
+    ASSERT_EQ(damaged(firstTapeOffset, (uint32_t)tapeSize), false);
+    // the lines of the first type ending after all lines of the types
+    ASSERT_EQ(damaged(typeOffsetsStart + sizeof(uint32_t), 1000), false);
+}
+
+// a zip local file entry, which is all the loader reads of a zip container
+static string ZipEntry(const string &name, uint16_t method, const string &data, uint32_t size)
+{
+    string entry;
+    const auto put = [&](uint32_t value, int bytes) { for (int i = 0; i < bytes; i++) entry += char((value >> (8 * i)) & 0xFF); };
+    put(0x04034b50, 4);
+    put(20, 2);
+    put(0, 2);
+    put(method, 2);
+    put(0, 4);
+    put(0, 4);
+    put(data.size(), 4);
+    put(size, 4);
+    put(name.size(), 2);
+    put(0, 2);
+    return entry + name + data;
+}
+
+TEST(LoadFromZip)
+{
+    const string notes = ZipEntry("notes.txt", 0, "not the model", 13);
+    const string stored = notes + ZipEntry("sample.ifc", 0, sampleIfc, sampleIfc.size());
+    IfcLoader storedLoader({}, TestSchemaManager());
+    ASSERT_EQ(storedLoader.LoadFile(stored.data(), stored.size()), true);
+    CheckSample(storedLoader);
+
+    const string deflated = notes + ZipEntry("SAMPLE.IFC", 8, string((const char *)sampleIfcDeflated, sizeof(sampleIfcDeflated)), sampleIfc.size());
+    TestLoader deflatedLoader(deflated);
+    CheckSample(deflatedLoader);
+
+    // without a spill pool evicted chunks are read again, which inflates the entry again from its start
+    IfcLoader evictingLoader({.TAPE_SIZE = 64, .MEMORY_LIMIT = 128, .TAPE_SPILL_LIMIT = 0}, TestSchemaManager());
+    istringstream stream(deflated);
+    evictingLoader.LoadFile(stream);
+    CheckSample(evictingLoader);
+    CheckSample(evictingLoader);
+
+    // a container whose model cannot be read fails to load instead of leaving an empty model
+    const string unsupported = ZipEntry("sample.ifc", 99, sampleIfc, sampleIfc.size());
+    IfcLoader failedLoader({}, TestSchemaManager());
+    ASSERT_EQ(failedLoader.LoadFile(unsupported.data(), unsupported.size()), false);
+    istringstream notesStream(notes);
+    IfcLoader notesLoader({}, TestSchemaManager());
+    ASSERT_EQ(notesLoader.LoadFile(notesStream), false);
+}
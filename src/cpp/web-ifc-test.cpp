@@ -6,6 +6,7 @@
 #include <fstream>
 #include <cstdint>
 #include <filesystem>
+#include <thread>
 #include "test/io_helpers.h"
 
 #include "parsing/IfcLoader.h"
@@ -286,6 +287,10 @@ int main()
         uint32_t TAPE_SIZE = 67108864 ; // probably no need for anyone other than web-ifc devs to change this
         uint32_t MEMORY_LIMIT = 2147483648;
         uint16_t LINEWRITER_BUFFER = 10000;
+        uint32_t ARGUMENT_INDEX_BUDGET = 16777216;
+        uint32_t TAPE_SPILL_LIMIT = 268435456;
+        bool INVERSE_INDEX = false;
+        uint32_t TAPE_GARBAGE_RATIO = 50;
     };
 
     LoaderSettings set;
@@ -293,7 +298,16 @@ int main()
     set.OPTIMIZE_PROFILES = true;
 
     webifc::schema::IfcSchemaManager schemaManager;
-    webifc::parsing::IfcLoader loader(set.TAPE_SIZE, set.MEMORY_LIMIT, set.LINEWRITER_BUFFER, schemaManager);
+    webifc::parsing::IfcLoaderSettings loaderSettings;
+    loaderSettings.TAPE_SIZE = set.TAPE_SIZE;
+    loaderSettings.MEMORY_LIMIT = set.MEMORY_LIMIT;
+    loaderSettings.LINEWRITER_BUFFER = set.LINEWRITER_BUFFER;
+    loaderSettings.ARGUMENT_INDEX_BUDGET = set.ARGUMENT_INDEX_BUDGET;
+    loaderSettings.TAPE_SPILL_LIMIT = set.TAPE_SPILL_LIMIT;
+    loaderSettings.INVERSE_INDEX = set.INVERSE_INDEX;
+    loaderSettings.TAPE_GARBAGE_RATIO = set.TAPE_GARBAGE_RATIO;
+    loaderSettings.THREADS = std::thread::hardware_concurrency();
+    webifc::parsing::IfcLoader loader(loaderSettings, schemaManager);
 
     auto start = ms();
     loader.LoadFile([&](char *dest, size_t sourceOffset, size_t destSize)
@@ -35,7 +35,11 @@ int OpenModel(webifc::manager::LoaderSettings settings, emscripten::val callback
         return len;
     };
     
-    manager.GetIfcLoader(modelID)->LoadFile(loaderFunc);
+    if (!manager.GetIfcLoader(modelID)->LoadFile(loaderFunc))
+    {
+        manager.CloseModel(modelID);
+        return -1;
+    }
     return modelID;
 }
 
@@ -49,6 +53,29 @@ void SaveModel(uint32_t modelID, emscripten::val callback)
     );
 }
 
+void SaveModelIncremental(uint32_t modelID, emscripten::val callback)
+{
+    if (!manager.IsModelOpen(modelID)) return;
+    manager.GetIfcLoader(modelID)->SaveFileIncremental([&](char* src, size_t srcSize)
+        {
+            emscripten::val retVal = callback((uint32_t)src, srcSize);
+        }
+    );
+}
+
+void SaveSubset(uint32_t modelID, emscripten::val expressIDs, bool renumber, emscripten::val callback)
+{
+    if (!manager.IsModelOpen(modelID)) return;
+    std::vector<uint32_t> roots;
+    uint32_t size = expressIDs["length"].as<uint32_t>();
+    for (uint32_t i=0; i < size; i++) roots.push_back(expressIDs[std::to_string(i)].as<uint32_t>());
+    manager.GetIfcLoader(modelID)->SaveSubset(roots, [&](char* src, size_t srcSize)
+        {
+            emscripten::val retVal = callback((uint32_t)src, srcSize);
+        }, renumber
+    );
+}
+
 int GetModelSize(uint32_t modelID) {
     return manager.IsModelOpen(modelID) ? manager.GetIfcLoader(modelID)->GetTotalSize() : 0;
 }
@@ -65,7 +92,7 @@ webifc::geometry::IfcFlatMesh GetFlatMesh(uint32_t modelID, uint32_t expressID)
     return mesh;
 }
 
-void StreamMeshes(uint32_t modelID, const std::vector<uint32_t> & expressIds, emscripten::val callback) {
+void StreamMeshes(uint32_t modelID, std::span<const uint32_t> expressIds, emscripten::val callback) {
     if (!manager.IsModelOpen(modelID)) return;    
     auto geomLoader = manager.GetGeometryProcessor(modelID);
     int index = 0;
@@ -266,47 +293,20 @@ std::vector<uint32_t> GetLineIDsWithType(uint32_t modelID, emscripten::val types
     return expressIDs;
 }
 
+std::vector<uint32_t> GetLineIDsWithTypeAndSubtypes(uint32_t modelID, uint32_t type)
+{
+    if (!manager.IsModelOpen(modelID)) return {};
+    auto ids = manager.GetIfcLoader(modelID)->GetExpressIDsWithTypeAndSubtypes(type);
+    return std::vector<uint32_t>(ids.begin(), ids.end());
+}
+
 std::vector<uint32_t> GetInversePropertyForItem(uint32_t modelID, uint32_t expressID, emscripten::val targetTypes, uint32_t position, bool set)
 {
     if (!manager.IsModelOpen(modelID)) return {};
-    auto loader = manager.GetIfcLoader(modelID);
-    std::vector<uint32_t> inverseIDs;
-    auto expressIDs = GetLineIDsWithType(modelID,targetTypes);
-    for (auto foundExpressID : expressIDs)
-    {
-      loader->MoveToLineArgument(foundExpressID, position);
-
-      webifc::parsing::IfcTokenType t = loader->GetTokenType();
-      if (t == webifc::parsing::IfcTokenType::REF) 
-      {
-        loader->StepBack();
-        uint32_t val = loader->GetRefArgument();
-        if (val == expressID)
-        {
-          inverseIDs.push_back(foundExpressID);
-          if (!set) return inverseIDs;
-        }
-      }
-      else if (t == webifc::parsing::IfcTokenType::SET_BEGIN)
-      {
-          while (!loader->IsAtEnd())
-          {
-              webifc::parsing::IfcTokenType setValueType = loader->GetTokenType();
-              if (setValueType == webifc::parsing::IfcTokenType::SET_END) break;
-              if (setValueType == webifc::parsing::IfcTokenType::REF) 
-              {
-                loader->StepBack();
-                uint32_t val = loader->GetRefArgument();
-                if (val == expressID)
-                {
-                  inverseIDs.push_back(foundExpressID);
-                  if (!set) return inverseIDs;
-                }
-              }
-          }
-      }
-    }
-    return inverseIDs;
+    std::vector<uint32_t> types;
+    uint32_t size = targetTypes["length"].as<uint32_t>();
+    for (uint32_t i=0; i < size; i++) types.push_back(targetTypes[std::to_string(i)].as<uint32_t>());
+    return manager.GetIfcLoader(modelID)->GetInversePropertyForItem(expressID, types, position, set);
 }
 
 bool ValidateExpressID(uint32_t modelID, uint32_t expressId) {
@@ -321,6 +321,15 @@ uint32_t GetNextExpressID(uint32_t modelID, uint32_t expressId) {
     return manager.IsModelOpen(modelID) ?  manager.GetIfcLoader(modelID)->GetNextExpressID(expressId) : 0;
 }
 
+std::vector<uint32_t> GetReferenceClosure(uint32_t modelID, emscripten::val expressIDs)
+{
+    if (!manager.IsModelOpen(modelID)) return {};
+    std::vector<uint32_t> roots;
+    uint32_t size = expressIDs["length"].as<uint32_t>();
+    for (uint32_t i=0; i < size; i++) roots.push_back(expressIDs[std::to_string(i)].as<uint32_t>());
+    return manager.GetIfcLoader(modelID)->GetReferenceClosure(roots);
+}
+
 std::vector<uint32_t> GetAllLines(uint32_t modelID) {
     return manager.IsModelOpen(modelID) ? manager.GetIfcLoader(modelID)->GetAllLines() : std::vector<uint32_t>();
 }
@@ -408,7 +417,8 @@ bool WriteSet(uint32_t modelID, emscripten::val& val)
         else if (child["type"].isNumber())
         {
             webifc::parsing::IfcTokenType type = static_cast<webifc::parsing::IfcTokenType>(child["type"].as<uint32_t>());
-            loader->Push(type);
+            // labels push their own token, as a type code when the schema knows them
+            if (type != webifc::parsing::IfcTokenType::LABEL) loader->Push(type);
             switch(type)
             {
                 case webifc::parsing::IfcTokenType::LINE_END:
@@ -431,10 +441,7 @@ bool WriteSet(uint32_t modelID, emscripten::val& val)
                     auto value = child["value"];
 
                     std::string copy = label.as<std::string>();
-
-                    uint16_t length = copy.size();
-                    loader->Push<uint16_t>((uint16_t)length);
-                    loader->Push((void*)copy.c_str(), copy.size());
+                    loader->PushLabel(copy);
 
                     loader->Push<uint8_t>(webifc::parsing::IfcTokenType::SET_BEGIN);
 
@@ -497,9 +504,7 @@ bool WriteHeaderLine(uint32_t modelID,uint32_t type, emscripten::val parameters)
     uint32_t start = loader->GetTotalSize();
     std::string ifcName = manager.GetSchemaManager().IfcTypeCodeToType(type);
     std::transform(ifcName.begin(), ifcName.end(), ifcName.begin(), ::toupper);
-    loader->Push<uint8_t>(webifc::parsing::IfcTokenType::LABEL);
-    loader->Push<uint16_t>((uint16_t)ifcName.size());
-    loader->Push((void*)ifcName.data(), ifcName.size());
+    loader->PushLabel(ifcName);
     bool responseCode = WriteSet(modelID,parameters);
     loader->Push<uint8_t>(webifc::parsing::IfcTokenType::LINE_END);
     loader->AddHeaderLineTape(type, start);
@@ -510,6 +515,11 @@ void RemoveLine(uint32_t modelID, uint32_t expressID) {
     if (manager.IsModelOpen(modelID)) manager.GetIfcLoader(modelID)->RemoveLine(expressID);
 }
 
+bool CompactTape(uint32_t modelID, uint32_t budget) {
+    if (!manager.IsModelOpen(modelID)) return true;
+    return manager.GetIfcLoader(modelID)->CompactTape(budget == 0 ? SIZE_MAX : budget);
+}
+
 bool WriteLine(uint32_t modelID, uint32_t expressID, uint32_t type, emscripten::val parameters)
 {
     if (!manager.IsModelOpen(modelID)) return false;
@@ -523,9 +533,7 @@ bool WriteLine(uint32_t modelID, uint32_t expressID, uint32_t type, emscripten::
     // line TYPE
     std::string ifcName = manager.GetSchemaManager().IfcTypeCodeToType(type);
     std::transform(ifcName.begin(), ifcName.end(), ifcName.begin(), ::toupper);
-    loader->Push<uint8_t>(webifc::parsing::IfcTokenType::LABEL);
-    loader->Push<uint16_t>((uint16_t)ifcName.size());
-    loader->Push((void*)ifcName.data(), ifcName.size());
+    loader->PushLabel(ifcName);
     bool responseCode = WriteSet(modelID,parameters);
     // end line
     loader->Push<uint8_t>(webifc::parsing::IfcTokenType::LINE_END);
@@ -608,8 +616,7 @@ emscripten::val GetArgs(uint32_t modelID, bool inObject=false, bool inList=false
                 auto obj = emscripten::val::object(); 
                 obj.set("type", emscripten::val(static_cast<uint32_t>(webifc::parsing::IfcTokenType::LABEL)));
                 loader->StepBack();
-                auto s=loader->GetStringArgument();
-                auto typeCode = manager.GetSchemaManager().IfcTypeToTypeCode(s);
+                auto typeCode = loader->GetTypeCodeArgument();
                 obj.set("typecode", emscripten::val(typeCode));
                 // read set open
                 loader->GetTokenType();
@@ -726,6 +733,10 @@ EMSCRIPTEN_BINDINGS(my_module) {
         .field("TAPE_SIZE", &webifc::manager::LoaderSettings::TAPE_SIZE)
         .field("MEMORY_LIMIT", &webifc::manager::LoaderSettings::MEMORY_LIMIT)
         .field("LINEWRITER_BUFFER",&webifc::manager::LoaderSettings::LINEWRITER_BUFFER)
+        .field("ARGUMENT_INDEX_BUDGET",&webifc::manager::LoaderSettings::ARGUMENT_INDEX_BUDGET)
+        .field("TAPE_SPILL_LIMIT",&webifc::manager::LoaderSettings::TAPE_SPILL_LIMIT)
+        .field("INVERSE_INDEX",&webifc::manager::LoaderSettings::INVERSE_INDEX)
+        .field("TAPE_GARBAGE_RATIO",&webifc::manager::LoaderSettings::TAPE_GARBAGE_RATIO)
     ;
 
     emscripten::value_array<std::array<double, 16>>("array_double_16")
@@ -822,13 +833,18 @@ EMSCRIPTEN_BINDINGS(my_module) {
     emscripten::function("GetHeaderLine", &GetHeaderLine);
     emscripten::function("WriteLine", &WriteLine);
     emscripten::function("RemoveLine", &RemoveLine);
+    emscripten::function("CompactTape", &CompactTape);
     emscripten::function("WriteHeaderLine", &WriteHeaderLine);
     emscripten::function("SaveModel", &SaveModel);
+    emscripten::function("SaveModelIncremental", &SaveModelIncremental);
+    emscripten::function("SaveSubset", &SaveSubset);
     emscripten::function("ValidateExpressID", &ValidateExpressID);
     emscripten::function("GetNextExpressID", &GetNextExpressID);
     emscripten::function("GetLineIDsWithType", &GetLineIDsWithType);
+    emscripten::function("GetLineIDsWithTypeAndSubtypes", &GetLineIDsWithTypeAndSubtypes);
     emscripten::function("GetInversePropertyForItem", &GetInversePropertyForItem);
     emscripten::function("GetAllLines", &GetAllLines);
+    emscripten::function("GetReferenceClosure", &GetReferenceClosure);
     emscripten::function("SetGeometryTransformation", &SetGeometryTransformation);
     emscripten::function("SetLogLevel", &SetLogLevel);
     emscripten::function("GetNameFromTypeCode", &GetNameFromTypeCode);
@@ -14,6 +14,8 @@ let cppSchema: Array<string> = [];
 let chSchema: Array<string> = [];
 
 let completeifcElementList = new Set<string>();
+// per schema, the supertype label of every entity label that has one
+let schemaSupertypes: Array<Map<string, string>> = [];
 
 let completeEntityList = new Set<string>();
 completeEntityList.add("FILE_SCHEMA");
@@ -110,6 +112,9 @@ for (var i = 0; i < files.length; i++) {
       completeEntityList.add(entities[x].name);
       if (entities[x].isIfcProduct) completeifcElementList.add(entities[x].name);
   }
+  let supertypes = new Map<string, string>();
+  entities.forEach(e => { if (e.parent) supertypes.set(e.name.toUpperCase(), e.parent.toUpperCase()); });
+  schemaSupertypes.push(supertypes);
   
 
   //generate FromRawLineData
@@ -273,37 +278,138 @@ new Set([...completeEntityList,...typeList]).forEach(entity => {
     tsSchema.unshift(`export const ${name} = ${code};`)
 });
 
+let schemaTypes = [...new Set([...completeEntityList,...typeList])].map(entity => ({name: entity, label: entity.toUpperCase(), code: crc32(entity.toUpperCase(),crcTable)}));
+// the position in this order is the dense ordinal of a type
+schemaTypes.sort((a, b) => a.code - b.code);
+let elementLabels = new Set([...completeifcElementList].map(element => element.toUpperCase()));
+
+chSchema.push(`\tstatic const unsigned int SCHEMA_TYPE_COUNT = ${schemaTypes.length};`);
 chSchema.push("}");
 
-cppSchema.push("#include <unordered_set>");
+cppSchema.push("#include <array>");
 cppSchema.push("#include <string>");
+cppSchema.push("#include <string_view>");
 cppSchema.push("#include \"ifc-schema.h\"");
 cppSchema.push("#include \"IfcSchemaManager.h\"");
-cppSchema.push("namespace webifc::schema {")
-cppSchema.push("void IfcSchemaManager::initSchemaData() {");
-completeifcElementList.forEach(element => {
-    cppSchema.push(`_ifcElements.insert(${element.toUpperCase()});`);
+cppSchema.push("namespace webifc::schema {");
+cppSchema.push("namespace {");
+cppSchema.push(`struct SchemaType { uint32_t typeCode; std::string_view name; std::string_view label; bool element; std::array<uint32_t, ${schemaSupertypes.length}> supertypes; };`);
+cppSchema.push("// sorted by type code, the index of a type is its ordinal");
+cppSchema.push("constexpr std::array<SchemaType, SCHEMA_TYPE_COUNT> SCHEMA_TYPES = {{");
+schemaTypes.forEach(type => {
+    cppSchema.push(`{${type.label}, "${type.name}", "${type.label}", ${elementLabels.has(type.label)}, {${schemaSupertypes.map(supertypes => supertypes.get(type.label) ?? 0).join(", ")}}},`);
+});
+cppSchema.push("}};");
+cppSchema.push(`constexpr std::array<uint32_t, ${elementLabels.size}> IFC_ELEMENTS = {{`);
+schemaTypes.filter(type => elementLabels.has(type.label)).forEach(type => {
+    cppSchema.push(`${type.label},`);
 });
+cppSchema.push("}};");
+let schemaNames: Array<string> = [];
 chSchema.push(`enum IFC_SCHEMA {`)
 for (var i = 0; i < files.length; i++) {
   if (!files[i].endsWith(".exp")) continue;
   var schemaName = files[i].replace(".exp","");
   var schemaNameClean = schemaName.replace(".","_");
   chSchema.push(`${schemaNameClean},`)
-  cppSchema.push(`_schemaNames.push_back("${schemaNameClean}");`);
-  cppSchema.push(`_schemas.push_back(${schemaNameClean});`);
+  schemaNames.push(schemaNameClean);
 }
-cppSchema.push("}");
 chSchema.push(`};`)
-
-cppSchema.push("std::string IfcSchemaManager::IfcTypeCodeToType(uint32_t typeCode) const {");
-cppSchema.push("switch(typeCode) {");
-new Set([...completeEntityList,...typeList]).forEach(entity => {
-    cppSchema.push(`case schema::${entity.toUpperCase()}: return "${entity}";`);
+cppSchema.push(`constexpr std::array<IFC_SCHEMA, ${schemaNames.length}> SCHEMAS = {{${schemaNames.join(", ")}}};`);
+cppSchema.push(`constexpr std::array<std::string_view, ${schemaNames.length}> SCHEMA_NAMES = {{${schemaNames.map(name => `"${name}"`).join(", ")}}};`);
+cppSchema.push("// open addressed by the low bits of the type code (already a crc32), slots hold ordinal + 1");
+cppSchema.push("constexpr uint32_t SLOT_BITS = 11;");
+cppSchema.push("constexpr uint32_t SLOT_MASK = (1 << SLOT_BITS) - 1;");
+cppSchema.push("static_assert(SCHEMA_TYPE_COUNT * 3 < (1 << SLOT_BITS) * 2, \"type slots are too full, raise SLOT_BITS\");");
+cppSchema.push("constexpr std::array<uint16_t, 1 << SLOT_BITS> makeTypeSlots() {");
+cppSchema.push("std::array<uint16_t, 1 << SLOT_BITS> slots = {};");
+cppSchema.push("for (uint32_t i = 0; i < SCHEMA_TYPE_COUNT; i++) {");
+cppSchema.push("uint32_t slot = SCHEMA_TYPES[i].typeCode & SLOT_MASK;");
+cppSchema.push("while (slots[slot] != 0) slot = (slot + 1) & SLOT_MASK;");
+cppSchema.push("slots[slot] = i + 1;");
+cppSchema.push("}");
+cppSchema.push("return slots;");
+cppSchema.push("}");
+cppSchema.push("constexpr std::array<uint16_t, 1 << SLOT_BITS> TYPE_SLOTS = makeTypeSlots();");
+cppSchema.push("constexpr uint32_t ordinalOf(const uint32_t typeCode) {");
+cppSchema.push("for (uint32_t slot = typeCode & SLOT_MASK; TYPE_SLOTS[slot] != 0; slot = (slot + 1) & SLOT_MASK) {");
+cppSchema.push("if (SCHEMA_TYPES[TYPE_SLOTS[slot] - 1].typeCode == typeCode) return TYPE_SLOTS[slot] - 1;");
+cppSchema.push("}");
+cppSchema.push("return SCHEMA_TYPE_COUNT;");
+cppSchema.push("}");
+cppSchema.push("// all direct and indirect subtypes of every type of a schema, those of ordinal i are codes[offsets[i], offsets[i + 1]), sorted by type code");
+cppSchema.push("template <size_t SIZE>");
+cppSchema.push("struct Subtypes { std::array<uint32_t, SCHEMA_TYPE_COUNT + 1> offsets; std::array<uint32_t, SIZE> codes; };");
+cppSchema.push("constexpr size_t countSubtypes(const IFC_SCHEMA schema) {");
+cppSchema.push("size_t count = 0;");
+cppSchema.push("for (uint32_t i = 0; i < SCHEMA_TYPE_COUNT; i++) {");
+cppSchema.push("for (uint32_t type = SCHEMA_TYPES[i].supertypes[schema]; type != 0; type = SCHEMA_TYPES[ordinalOf(type)].supertypes[schema]) count++;");
+cppSchema.push("}");
+cppSchema.push("return count;");
+cppSchema.push("}");
+cppSchema.push("template <size_t SIZE>");
+cppSchema.push("constexpr Subtypes<SIZE> makeSubtypes(const IFC_SCHEMA schema) {");
+cppSchema.push("Subtypes<SIZE> subtypes = {};");
+cppSchema.push("for (uint32_t i = 0; i < SCHEMA_TYPE_COUNT; i++) {");
+cppSchema.push("for (uint32_t type = SCHEMA_TYPES[i].supertypes[schema]; type != 0; type = SCHEMA_TYPES[ordinalOf(type)].supertypes[schema]) subtypes.offsets[ordinalOf(type) + 1]++;");
+cppSchema.push("}");
+cppSchema.push("for (uint32_t i = 0; i < SCHEMA_TYPE_COUNT; i++) subtypes.offsets[i + 1] += subtypes.offsets[i];");
+cppSchema.push("std::array<uint32_t, SCHEMA_TYPE_COUNT> filled = {};");
+cppSchema.push("for (uint32_t i = 0; i < SCHEMA_TYPE_COUNT; i++) {");
+cppSchema.push("for (uint32_t type = SCHEMA_TYPES[i].supertypes[schema]; type != 0; type = SCHEMA_TYPES[ordinalOf(type)].supertypes[schema]) {");
+cppSchema.push("const uint32_t ordinal = ordinalOf(type);");
+cppSchema.push("subtypes.codes[subtypes.offsets[ordinal] + filled[ordinal]++] = SCHEMA_TYPES[i].typeCode;");
+cppSchema.push("}");
+cppSchema.push("}");
+cppSchema.push("return subtypes;");
+cppSchema.push("}");
+schemaNames.forEach(name => {
+    cppSchema.push(`constexpr auto SUBTYPES_${name} = makeSubtypes<countSubtypes(${name})>(${name});`);
 });
-
-cppSchema.push(`default: return "<web-ifc-type-unknown>";`);
+cppSchema.push(`constexpr std::array<std::span<const uint32_t>, ${schemaNames.length}> SUBTYPE_OFFSETS = {{${schemaNames.map(name => `SUBTYPES_${name}.offsets`).join(", ")}}};`);
+cppSchema.push(`constexpr std::array<std::span<const uint32_t>, ${schemaNames.length}> SUBTYPE_CODES = {{${schemaNames.map(name => `SUBTYPES_${name}.codes`).join(", ")}}};`);
+cppSchema.push("}");
+cppSchema.push("uint32_t IfcSchemaManager::IfcTypeCodeToOrdinal(const uint32_t typeCode) {");
+cppSchema.push("return ordinalOf(typeCode);");
+cppSchema.push("}");
+cppSchema.push("uint32_t IfcSchemaManager::IfcTypeOrdinalToTypeCode(const uint32_t ordinal) {");
+cppSchema.push("return ordinal < SCHEMA_TYPE_COUNT ? SCHEMA_TYPES[ordinal].typeCode : 0;");
+cppSchema.push("}");
+cppSchema.push("std::string IfcSchemaManager::IfcTypeCodeToType(const uint32_t typeCode) const {");
+cppSchema.push("const uint32_t ordinal = IfcTypeCodeToOrdinal(typeCode);");
+cppSchema.push("return ordinal < SCHEMA_TYPE_COUNT ? std::string(SCHEMA_TYPES[ordinal].name) : \"<web-ifc-type-unknown>\";");
+cppSchema.push("}");
+cppSchema.push("std::string_view IfcSchemaManager::IfcTypeCodeToLabel(const uint32_t typeCode) {");
+cppSchema.push("const uint32_t ordinal = IfcTypeCodeToOrdinal(typeCode);");
+cppSchema.push("return ordinal < SCHEMA_TYPE_COUNT ? SCHEMA_TYPES[ordinal].label : \"\";");
+cppSchema.push("}");
+cppSchema.push("bool IfcSchemaManager::IsIfcElement(const uint32_t typeCode) {");
+cppSchema.push("const uint32_t ordinal = IfcTypeCodeToOrdinal(typeCode);");
+cppSchema.push("return ordinal < SCHEMA_TYPE_COUNT && SCHEMA_TYPES[ordinal].element;");
+cppSchema.push("}");
+cppSchema.push("std::span<const uint32_t> IfcSchemaManager::GetIfcElementList() {");
+cppSchema.push("return IFC_ELEMENTS;");
+cppSchema.push("}");
+cppSchema.push("std::span<const IFC_SCHEMA> IfcSchemaManager::GetAvailableSchemas() {");
+cppSchema.push("return SCHEMAS;");
+cppSchema.push("}");
+cppSchema.push("std::string_view IfcSchemaManager::GetSchemaName(const IFC_SCHEMA schema) {");
+cppSchema.push("return SCHEMA_NAMES[schema];");
+cppSchema.push("}");
+cppSchema.push("uint32_t IfcSchemaManager::GetSupertype(const IFC_SCHEMA schema, const uint32_t typeCode) {");
+cppSchema.push("const uint32_t ordinal = IfcTypeCodeToOrdinal(typeCode);");
+cppSchema.push("return ordinal < SCHEMA_TYPE_COUNT ? SCHEMA_TYPES[ordinal].supertypes[schema] : 0;");
+cppSchema.push("}");
+cppSchema.push("std::span<const uint32_t> IfcSchemaManager::GetSubtypes(const IFC_SCHEMA schema, const uint32_t typeCode) {");
+cppSchema.push("const uint32_t ordinal = IfcTypeCodeToOrdinal(typeCode);");
+cppSchema.push("if (ordinal == SCHEMA_TYPE_COUNT) return {};");
+cppSchema.push("return SUBTYPE_CODES[schema].subspan(SUBTYPE_OFFSETS[schema][ordinal], SUBTYPE_OFFSETS[schema][ordinal + 1] - SUBTYPE_OFFSETS[schema][ordinal]);");
+cppSchema.push("}");
+cppSchema.push("bool IfcSchemaManager::IsA(const IFC_SCHEMA schema, const uint32_t typeCode, const uint32_t supertypeCode) {");
+cppSchema.push("for (uint32_t type = typeCode; type != 0; type = GetSupertype(schema, type)) {");
+cppSchema.push("if (type == supertypeCode) return true;");
 cppSchema.push("}");
+cppSchema.push("return false;");
 cppSchema.push("}");
 cppSchema.push("}");
 
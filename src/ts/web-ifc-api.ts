@@ -60,6 +60,10 @@ export const INTEGER = 10;
  * @property {number} MEMORY_LIMIT - The amount of memory to be reserved for storing IFC data in memory
  * @property {number} TAPE_SIZE - Size of the tape for the loader.
  * @property {number} LINEWRITER_BUFFER - The number of lines to write to memory at a time when writing an IFC file.
+ * @property {number} ARGUMENT_INDEX_BUDGET - The amount of memory used to cache argument positions of accessed lines, 0 disables the cache.
+ * @property {number} TAPE_SPILL_LIMIT - The amount of memory used to keep tape evicted under MEMORY_LIMIT compressed instead of reading it again, 0 disables it.
+ * @property {boolean} INVERSE_INDEX - If true, the references between lines are indexed while loading so inverse properties are found without scanning the model.
+ * @property {number} TAPE_GARBAGE_RATIO - Percentage of written tape left unused by edited and removed lines at which the tape is compacted while editing, 0 disables it.
  */
 export interface LoaderSettings {
     OPTIMIZE_PROFILES?: boolean;
@@ -68,6 +72,10 @@ export interface LoaderSettings {
     MEMORY_LIMIT?: number;
     TAPE_SIZE? : number;
     LINEWRITER_BUFFER?: number;
+    ARGUMENT_INDEX_BUDGET?: number;
+    TAPE_SPILL_LIMIT?: number;
+    INVERSE_INDEX?: boolean;
+    TAPE_GARBAGE_RATIO?: number;
 }
 
 export interface Vector<T> extends Iterable<T> {
@@ -233,6 +241,10 @@ export class IfcAPI {
             TAPE_SIZE: 67108864,
             MEMORY_LIMIT: 2147483648,
             LINEWRITER_BUFFER: 10000,
+            ARGUMENT_INDEX_BUDGET: 16777216,
+            TAPE_SPILL_LIMIT: 268435456,
+            INVERSE_INDEX: false,
+            TAPE_GARBAGE_RATIO: 50,
             ...settings
         };
         return s;
@@ -253,7 +265,7 @@ export class IfcAPI {
 
     /**
      * Opens a model and returns a modelID number
-     * @param data Buffer containing IFC data (bytes)
+     * @param data Buffer containing IFC data (bytes), or a zip container (.ifczip) holding the IFC file
      * @param settings Settings for loading the model @see LoaderSettings
 	 * @returns ModelID or -1 if model fails to open
     */
@@ -266,6 +278,7 @@ export class IfcAPI {
             dest.set(src);
             return srcSize;
         });
+        if (result == -1) return -1;
         this.deletedLines.set(result,new Set());
         var schemaName = this.GetHeaderLine(result, FILE_SCHEMA).arguments[0][0].value;
         this.modelSchemaList[result] = this.LookupSchemaId(schemaName);
@@ -295,6 +308,7 @@ export class IfcAPI {
             dest.set(data);
             return srcSize;
         });
+        if (result == -1) return -1;
         this.deletedLines.set(result,new Set());
         var schemaName = this.GetHeaderLine(result, FILE_SCHEMA).arguments[0][0].value;
         this.modelSchemaList[result] = this.LookupSchemaId(schemaName);
@@ -363,11 +377,13 @@ export class IfcAPI {
 	/**
 	 * Saves a model to a Buffer
 	 * @param modelID Model ID
+	 * @param incremental if true, lines not edited since opening are copied from the source data as they are
 	 * @returns Buffer containing the model data
 	 */
-    SaveModel(modelID: number): Uint8Array {
+    SaveModel(modelID: number, incremental: boolean = false): Uint8Array {
         let dataBuffer:Uint8Array = new Uint8Array(0);
-        this.wasmModule.SaveModel(modelID, (srcPtr: number, srcSize: number) => {
+        let save = incremental ? this.wasmModule.SaveModelIncremental : this.wasmModule.SaveModel;
+        save(modelID, (srcPtr: number, srcSize: number) => {
             let origSize: number = dataBuffer.byteLength;
             let src = this.wasmModule.HEAPU8.subarray(srcPtr, srcPtr + srcSize);
             let newBuffer = new Uint8Array(origSize+srcSize);
@@ -378,13 +394,38 @@ export class IfcAPI {
        return dataBuffer;
     }
 
+    /**
+     * Saves some lines of a model, together with every line they reference, as a model of its own
+     * @param modelID Model ID
+     * @param expressIDs the lines to save
+     * @param renumber if true, the saved lines are numbered from 1 in the order of their express IDs
+     * @returns Buffer containing the model data
+     */
+    SaveSubset(modelID: number, expressIDs: Array<number>, renumber: boolean = false): Uint8Array {
+        let chunks: Uint8Array[] = [];
+        let size = 0;
+        this.wasmModule.SaveSubset(modelID, expressIDs, renumber, (srcPtr: number, srcSize: number) => {
+            chunks.push(this.wasmModule.HEAPU8.slice(srcPtr, srcPtr + srcSize));
+            size += srcSize;
+        });
+        let dataBuffer = new Uint8Array(size);
+        let offset = 0;
+        for (let chunk of chunks) {
+            dataBuffer.set(chunk, offset);
+            offset += chunk.byteLength;
+        }
+        return dataBuffer;
+    }
+
     /**
      * Saves a model to a Buffer
      * @param modelID Model ID
+     * @param incremental if true, lines not edited since opening are copied from the source data as they are
      * @returns Buffer containing the model data
      */
-    SaveModelToCallback(modelID: number, callback: ModelSaveCallback) {
-        this.wasmModule.SaveModel(modelID, (srcPtr: number, srcSize: number) => {
+    SaveModelToCallback(modelID: number, callback: ModelSaveCallback, incremental: boolean = false) {
+        let save = incremental ? this.wasmModule.SaveModelIncremental : this.wasmModule.SaveModel;
+        save(modelID, (srcPtr: number, srcSize: number) => {
             let src = this.wasmModule.HEAPU8.subarray(srcPtr, srcPtr + srcSize);
             let newBuffer = new Uint8Array(srcSize);
             newBuffer.set(src);
@@ -580,6 +621,16 @@ export class IfcAPI {
         this.deletedLines.get(modelID)!.add(expressID);
     }
 
+    /**
+     * Frees the memory held by old versions of written and deleted lines. Also happens on its own while editing, see TAPE_GARBAGE_RATIO
+     * @param modelID Model handle retrieved by OpenModel
+     * @param budget bytes of lines to move before returning, so the work can be spread over idle time. 0 finishes the compaction
+     * @returns true once the compaction is done
+     */
+    CompactTape(modelID: number, budget: number = 0): boolean {
+        return this.wasmModule.CompactTape(modelID, budget);
+    }
+
 	/**
      * Writes a line to the model, can be used to write new lines or to update existing lines
      * @param modelID Model handle retrieved by OpenModel
@@ -687,13 +738,8 @@ export class IfcAPI {
 	 * @returns vector of line IDs
 	 */
     GetLineIDsWithType(modelID: number, type: number, includeInherited: boolean = false): Vector<number> {
-        let types: Array<number> = [];
-        types.push(type);
-        if (includeInherited && typeof InheritanceDef[this.modelSchemaList[modelID]][type] != "undefined")
-        {
-          types = types.concat(InheritanceDef[this.modelSchemaList[modelID]][type]);
-        } 
-        let lineIds = this.wasmModule.GetLineIDsWithType(modelID, types);
+        // subtypes are resolved natively from the schema of the model
+        let lineIds = includeInherited ? this.wasmModule.GetLineIDsWithTypeAndSubtypes(modelID, type) : this.wasmModule.GetLineIDsWithType(modelID, [type]);
         lineIds[Symbol.iterator] = function*() { for (let i=0; i < lineIds.size();i++) yield lineIds.get(i); }
         return lineIds;
     }
@@ -709,6 +755,18 @@ export class IfcAPI {
         return lineIds;
     }
 
+	/**
+	 * Get the IDs of the given lines and of every line they reference, directly or indirectly
+	 * @param modelID model ID
+	 * @param expressIDs the lines to start from
+	 * @returns vector of line IDs sorted by expressID
+	 */
+    GetReferenceClosure(modelID: number, expressIDs: Array<number>): Vector<number> {
+        let lineIds = this.wasmModule.GetReferenceClosure(modelID, expressIDs);
+        lineIds[Symbol.iterator] = function*() { for (let i=0; i < lineIds.size();i++) yield lineIds.get(i); }
+        return lineIds;
+    }
+
     /**
      * Returns all crossSections in 2D contained in IFCSECTIONEDSOLID, IFCSECTIONEDSURFACE, IFCSECTIONEDSOLIDHORIZONTAL (IFC4x3 or superior) 
      * @param modelID model ID
@@ -2,8 +2,6 @@ import * as fs from "fs";
 import * as path from "path";
 import * as os from 'os';
 import * as WebIFC from '../../dist/web-ifc-api-node';
-// @ts-ignore
-import AdmZip from 'adm-zip';
 
 let newIfcAPI = new WebIFC.IfcAPI();
 const OUTPUT_FILE = './benchmark.md';
@@ -115,12 +113,9 @@ async function BenchmarkIfcFile(module: any, filename: string): Promise<FileResu
 
     const ifcFilePath = path.join(filename);
     let ifcFileContent;
-    if (filename.includes(".ifczip"))  {
-        let zip = new AdmZip(filename);
-        zip.getEntries().forEach(function (zipEntry:any) {
-            ifcFileContent = zipEntry.getData();
-        });
-    } else ifcFileContent = await StreamFileToString(ifcFilePath);
+    // .ifczip files are inflated by the loader itself
+    if (filename.includes(".ifczip")) ifcFileContent = fs.readFileSync(ifcFilePath);
+    else ifcFileContent = await StreamFileToString(ifcFilePath);
     
     let startTime = ms();
     let modelID : number = module.OpenModel(ifcFileContent);